@@ -449,8 +449,11 @@ ColladaParser::ColladaParser(IOSystem *pIOHandler, const std::string &pFile) :
         }
     }
 
-    // generate a XML reader for it
-    if (!mXmlParser.parse(daeFile.get())) {
+    // generate a XML reader for it, the bulk data is parsed while streaming the file
+    const auto onElement = [this](XmlStreamReader &reader, XmlNode &parent) {
+        return ReadStreamedElement(reader, parent);
+    };
+    if (!mXmlParser.parse(daeFile.get(), onElement)) {
         throw DeadlyImportError("Unable to read file, malformed XML");
     }
     // start reading
@@ -1485,24 +1488,74 @@ void ColladaParser::ReadDataArray(XmlNode &node) {
                 SkipSpacesAndLineEnd(&content, end);
             }
         } else {
-            data.mValues.reserve(count);
+            data.mValues.resize(count);
 
-            for (unsigned int a = 0; a < count; a++) {
-                if (*content == 0) {
-                    throw DeadlyImportError("Expected more values while reading float_array contents.");
-                }
-
-                // read a number
-                ai_real value;
-                content = fast_atoreal_move<ai_real>(content, value);
-                data.mValues.push_back(value);
-                // skip whitespace after it
-                SkipSpacesAndLineEnd(&content, end);
+            size_t numRead = 0;
+            fast_atoreal_array<ai_real>(content, end, data.mValues.data(), count, &numRead);
+            if (numRead < count) {
+                throw DeadlyImportError("Expected more values while reading float_array contents.");
             }
         }
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Parses the large numeric contents of the geometry and animation libraries while the file is
+// streamed, so the text of these elements never ends up in the document
+bool ColladaParser::ReadStreamedElement(XmlStreamReader &reader, XmlNode &parent) {
+    const std::string &name = reader.getName();
+    const bool isStringArray = (name == "IDREF_array" || name == "Name_array");
+    const bool isDataArray = isStringArray || name == "float_array";
+    if (!isDataArray && name != "p") {
+        return false;
+    }
+
+    // only data arrays of <source> elements are read by ReadSource
+    if (isDataArray && std::strcmp(parent.name(), "source") != 0) {
+        return false;
+    }
+
+    std::string library;
+    for (XmlNode node = parent; !node.empty(); node = node.parent()) {
+        library = node.name();
+        if (library == "library_geometries" || library == "library_animations") {
+            break;
+        }
+    }
+    if (library != "library_geometries" && (library != "library_animations" || !isDataArray)) {
+        return false;
+    }
+
+    if (name == "p") {
+        XmlNode node = parent.append_child("p");
+        reader.readIndices(mStreamedIndices[node]);
+        return reader.skipElement();
+    }
+
+    // same as ReadDataArray, with the values parsed from the stream
+    std::string id, count;
+    reader.getAttribute("id", id);
+    reader.getAttribute("count", count);
+    const unsigned int numValues = strtoul10(count.c_str());
+
+    mDataLibrary[id] = Data();
+    Data &data = mDataLibrary[id];
+    data.mIsStringArray = isStringArray;
+    if (isStringArray) {
+        data.mStrings.reserve(numValues);
+        if (reader.readTokens(data.mStrings, numValues) < numValues) {
+            throw DeadlyImportError("Expected more values while reading IDREF_array contents.");
+        }
+    } else {
+        data.mValues.resize(numValues);
+        if (reader.readReals(data.mValues.data(), numValues) < numValues) {
+            throw DeadlyImportError("Expected more values while reading float_array contents.");
+        }
+    }
+
+    return reader.skipElement();
+}
+
 // ------------------------------------------------------------------------------------------------
 // Reads an accessor and stores it in the global library
 void ColladaParser::ReadAccessor(XmlNode &node, const std::string &pID) {
@@ -1777,7 +1830,11 @@ size_t ColladaParser::ReadPrimitives(XmlNode &node, Mesh &pMesh, std::vector<Inp
     }
 
     // It is possible to not contain any indices
-    if (pNumPrimitives > 0) {
+    auto streamed = mStreamedIndices.find(node);
+    if (pNumPrimitives > 0 && streamed != mStreamedIndices.end()) {
+        indices = std::move(streamed->second);
+        mStreamedIndices.erase(streamed);
+    } else if (pNumPrimitives > 0) {
         std::string v;
         XmlParser::getValueAsString(node, v);
         const char *content = v.c_str();
@@ -165,6 +165,10 @@ public:
     /// Currently supported are array of floats and arrays of strings.
     void ReadDataArray(XmlNode &node);
 
+    /// Called by the streaming xml parser for each start tag. Parses the data arrays and <p>
+    /// index lists of the geometry and animation libraries straight from the file buffer.
+    bool ReadStreamedElement(XmlStreamReader &reader, XmlNode &parent);
+
     /// Reads an accessor and stores it in the global library under the given ID -
     /// accessors use the ID of the parent <source> element
     void ReadAccessor(XmlNode &node, const std::string &pID);
@@ -233,6 +237,9 @@ private:
     /// XML reader, member for everyday use
     XmlParser mXmlParser;
 
+    /// Index lists of <p> elements which were parsed while streaming the file
+    std::map<XmlNode, std::vector<size_t>> mStreamedIndices;
+
     /// All data arrays found in the file by ID. Might be referred to by actually
     ///     everyone. Collada, you are a steaming pile of indirection.
     using DataLibrary = std::map<std::string, Collada::Data> ;
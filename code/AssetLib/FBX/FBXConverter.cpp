@@ -52,6 +52,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXParser.h"
 #include "FBXProperties.h"
 #include "FBXUtil.h"
+#include "Common/ParallelFor.h"
 
 #include <assimp/MathFunctions.h>
 #include <assimp/StringComparison.h>
@@ -152,6 +153,7 @@ FBXConverter::FBXConverter(aiScene *out, const Document &doc, bool removeEmptyBo
         ConvertOrphanedEmbeddedTextures();
     }
     ConvertRootNode();
+    ConvertPendingMeshes();
 
     if (doc.Settings().readAllMaterials) {
         // unfortunately this means we have to evaluate all objects
@@ -1124,6 +1126,22 @@ unsigned int FBXConverter::ConvertMeshSingleMaterial(const MeshGeometry &mesh, c
     const MatIndexArray &mindices = mesh.GetMaterialIndices();
     aiMesh *const out_mesh = SetupEmptyMesh(mesh, parent);
 
+    if (!doc.Settings().readMaterials || mindices.empty()) {
+        FBXImporter::LogError("no material assigned to mesh, setting default material");
+        out_mesh->mMaterialIndex = GetDefaultMaterial();
+    } else {
+        ConvertMaterialForMesh(out_mesh, model, mesh, mindices[0]);
+    }
+
+    // the data arrays are filled by ConvertPendingMeshes()
+    mPendingMeshes.push_back({ out_mesh, &mesh, absolute_transform, parent, 0, false });
+    return static_cast<unsigned int>(mMeshes.size() - 1);
+}
+
+void FBXConverter::FillMeshSingleMaterial(const PendingMesh &pending) {
+    const MeshGeometry &mesh = *pending.mGeometry;
+    aiMesh *const out_mesh = pending.mMesh;
+
     const std::vector<aiVector3D> &vertices = mesh.GetVertices();
     const std::vector<unsigned int> &faces = mesh.GetFaceIndexCounts();
 
@@ -1231,22 +1249,9 @@ unsigned int FBXConverter::ConvertMeshSingleMaterial(const MeshGeometry &mesh, c
         std::copy(colors.begin(), colors.end(), out_mesh->mColors[i]);
     }
 
-    if (!doc.Settings().readMaterials || mindices.empty()) {
-        FBXImporter::LogError("no material assigned to mesh, setting default material");
-        out_mesh->mMaterialIndex = GetDefaultMaterial();
-    } else {
-        ConvertMaterialForMesh(out_mesh, model, mesh, mindices[0]);
-    }
-
-    if (doc.Settings().readWeights && mesh.DeformerSkin() != nullptr && !doc.Settings().useSkeleton) {
-        ConvertWeights(out_mesh, mesh, absolute_transform, parent, NO_MATERIAL_SEPARATION, nullptr);
-    } else if (doc.Settings().readWeights && mesh.DeformerSkin() != nullptr && doc.Settings().useSkeleton) {
-        SkeletonBoneContainer sbc;
-        ConvertWeightsToSkeleton(out_mesh, mesh, absolute_transform, parent, NO_MATERIAL_SEPARATION, nullptr, sbc);
-        aiSkeleton *skeleton = createAiSkeleton(sbc);
-        if (skeleton != nullptr) {
-            mSkeletons.emplace_back(skeleton);
-        }
+    // skeletons are collected afterwards by ConvertPendingMeshes()
+    if (doc.Settings().readWeights && mesh.DeformerSkin() != nullptr) {
+        ConvertWeights(out_mesh, mesh, pending.mAbsoluteTransform, pending.mParent, NO_MATERIAL_SEPARATION, nullptr);
     }
 
     std::vector<aiAnimMesh *> animMeshes;
@@ -1297,7 +1302,6 @@ unsigned int FBXConverter::ConvertMeshSingleMaterial(const MeshGeometry &mesh, c
             out_mesh->mAnimMeshes[i] = animMeshes.at(i);
         }
     }
-    return static_cast<unsigned int>(mMeshes.size() - 1);
 }
 
 std::vector<unsigned int>
@@ -1306,6 +1310,12 @@ FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, const Model &mo
     const MatIndexArray &mindices = mesh.GetMaterialIndices();
     ai_assert(mindices.size());
 
+    // FaceForVertexIndex() sets up its lookup table on first use, do this now
+    // since the meshes split by material are filled concurrently
+    if (doc.Settings().readWeights && mesh.DeformerSkin() != nullptr) {
+        mesh.FaceForVertexIndex(0);
+    }
+
     std::set<MatIndexArray::value_type> had;
     std::vector<unsigned int> indices;
 
@@ -1323,6 +1333,17 @@ FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, const Model &mo
 unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, const Model &model, const aiMatrix4x4 &absolute_transform,
         MatIndexArray::value_type index, aiNode *parent, aiNode *) {
     aiMesh *const out_mesh = SetupEmptyMesh(mesh, parent);
+    ConvertMaterialForMesh(out_mesh, model, mesh, index);
+
+    // the data arrays are filled by ConvertPendingMeshes()
+    mPendingMeshes.push_back({ out_mesh, &mesh, absolute_transform, parent, index, true });
+    return static_cast<unsigned int>(mMeshes.size() - 1);
+}
+
+void FBXConverter::FillMeshMultiMaterial(const PendingMesh &pending) {
+    const MeshGeometry &mesh = *pending.mGeometry;
+    aiMesh *const out_mesh = pending.mMesh;
+    const MatIndexArray::value_type index = pending.mMaterialIndex;
 
     const MatIndexArray &mindices = mesh.GetMaterialIndices();
     const std::vector<aiVector3D> &vertices = mesh.GetVertices();
@@ -1481,10 +1502,8 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
         }
     }
 
-    ConvertMaterialForMesh(out_mesh, model, mesh, index);
-
     if (process_weights) {
-        ConvertWeights(out_mesh, mesh, absolute_transform, parent, index, &reverseMapping);
+        ConvertWeights(out_mesh, mesh, pending.mAbsoluteTransform, pending.mParent, index, &reverseMapping);
     }
 
     std::vector<aiAnimMesh *> animMeshes;
@@ -1529,8 +1548,35 @@ unsigned int FBXConverter::ConvertMeshMultiMaterial(const MeshGeometry &mesh, co
             out_mesh->mAnimMeshes[i] = animMeshes.at(i);
         }
     }
+}
 
-    return static_cast<unsigned int>(mMeshes.size() - 1);
+void FBXConverter::ConvertPendingMeshes() {
+    // every mesh only touches its own output, all shared state has been
+    // set up by the serial node traversal
+    ParallelFor(doc.Settings().numThreads, static_cast<unsigned int>(mPendingMeshes.size()), [this](unsigned int i) {
+        const PendingMesh &pending = mPendingMeshes[i];
+        if (pending.mSplitByMaterial) {
+            FillMeshMultiMaterial(pending);
+        } else {
+            FillMeshSingleMaterial(pending);
+        }
+    });
+
+    // skeletons are collected in mesh order
+    if (doc.Settings().readWeights && doc.Settings().useSkeleton) {
+        for (const PendingMesh &pending : mPendingMeshes) {
+            if (pending.mSplitByMaterial || pending.mGeometry->DeformerSkin() == nullptr) {
+                continue;
+            }
+            SkeletonBoneContainer sbc;
+            CollectSkeletonBones(pending.mMesh, sbc);
+            aiSkeleton *skeleton = createAiSkeleton(sbc);
+            if (skeleton != nullptr) {
+                mSkeletons.emplace_back(skeleton);
+            }
+        }
+    }
+    mPendingMeshes.clear();
 }
 
 static void copyBoneToSkeletonBone(aiMesh *mesh, aiBone *bone, aiSkeletonBone *skeletonBone ) {
@@ -1544,14 +1590,11 @@ static void copyBoneToSkeletonBone(aiMesh *mesh, aiBone *bone, aiSkeletonBone *s
     skeletonBone->mParent = -1;
 }
 
-void FBXConverter::ConvertWeightsToSkeleton(aiMesh *out, const MeshGeometry &geo, const aiMatrix4x4 &absolute_transform, aiNode *parent, unsigned int materialIndex,
-        std::vector<unsigned int> *outputVertStartIndices, SkeletonBoneContainer &skeletonContainer) {
-
+void FBXConverter::CollectSkeletonBones(aiMesh *out, SkeletonBoneContainer &skeletonContainer) {
     if (skeletonContainer.SkeletonBoneToMeshLookup.find(out) != skeletonContainer.SkeletonBoneToMeshLookup.end()) {
         return;
     }
 
-    ConvertWeights(out, geo, absolute_transform, parent, materialIndex, outputVertStartIndices);
     skeletonContainer.MeshArray.emplace_back(out);
     SkeletonBoneArray *ba = new SkeletonBoneArray;
     for (size_t i = 0; i < out->mNumBones; ++i) {
@@ -1576,6 +1619,7 @@ void FBXConverter::ConvertWeights(aiMesh *out, const MeshGeometry &geo, const ai
     const Skin &sk = *geo.DeformerSkin();
 
     std::vector<aiBone*> bones;
+    BoneMap bone_map;
     const bool no_mat_check = materialIndex == NO_MATERIAL_SEPARATION;
     ai_assert(no_mat_check || outputVertStartIndices);
 
@@ -1635,10 +1679,8 @@ void FBXConverter::ConvertWeights(aiMesh *out, const MeshGeometry &geo, const ai
             // XXX this could be heavily simplified by collecting the bone
             // data in a single step.
             ConvertCluster(bones, cluster, out_indices, index_out_indices,
-                    count_out_indices, absolute_transform, parent);
+                    count_out_indices, absolute_transform, parent, bone_map);
         }
-
-        bone_map.clear();
     } catch (std::exception &) {
         std::for_each(bones.begin(), bones.end(), Util::delete_fun<aiBone>());
         throw;
@@ -1658,7 +1700,7 @@ void FBXConverter::ConvertWeights(aiMesh *out, const MeshGeometry &geo, const ai
 void FBXConverter::ConvertCluster(std::vector<aiBone*> &local_mesh_bones, const Cluster *cluster,
         std::vector<size_t> &out_indices, std::vector<size_t> &index_out_indices,
         std::vector<size_t> &count_out_indices, const aiMatrix4x4 &absolute_transform,
-        aiNode *) {
+        aiNode *, BoneMap &bone_map) {
     ai_assert(cluster != nullptr); // make sure cluster valid
 
     std::string deformer_name = cluster->TargetNode()->Name();
@@ -203,10 +203,30 @@ private:
     // ------------------------------------------------------------------------------------------------
     aiMesh* SetupEmptyMesh(const Geometry& mesh, aiNode *parent);
 
+    // ------------------------------------------------------------------------------------------------
+    // Mesh whose slot, name and material have been assigned, but whose data arrays are
+    // only filled by ConvertPendingMeshes().
+    struct PendingMesh {
+        aiMesh *mMesh;
+        const MeshGeometry *mGeometry;
+        aiMatrix4x4 mAbsoluteTransform;
+        aiNode *mParent;
+        // material the faces were selected by if mSplitByMaterial is set
+        MatIndexArray::value_type mMaterialIndex;
+        bool mSplitByMaterial;
+    };
+
+    // ------------------------------------------------------------------------------------------------
+    // Fill the vertex, face, weight and blend shape data of all pending meshes, in parallel
+    void ConvertPendingMeshes();
+
     // ------------------------------------------------------------------------------------------------
     unsigned int ConvertMeshSingleMaterial(const MeshGeometry &mesh, const Model &model, const aiMatrix4x4 &absolute_transform,
                                            aiNode *parent, aiNode *root_node);
 
+    // ------------------------------------------------------------------------------------------------
+    void FillMeshSingleMaterial(const PendingMesh &pending);
+
     // ------------------------------------------------------------------------------------------------
     std::vector<unsigned int>
     ConvertMeshMultiMaterial(const MeshGeometry &mesh, const Model &model, const aiMatrix4x4 &absolute_transform, aiNode *parent, aiNode *root_node);
@@ -215,6 +235,9 @@ private:
     unsigned int ConvertMeshMultiMaterial(const MeshGeometry &mesh, const Model &model, const aiMatrix4x4 &absolute_transform, MatIndexArray::value_type index,
                                           aiNode *parent, aiNode *root_node);
 
+    // ------------------------------------------------------------------------------------------------
+    void FillMeshMultiMaterial(const PendingMesh &pending);
+
     // ------------------------------------------------------------------------------------------------
     static const unsigned int NO_MATERIAL_SEPARATION = /* std::numeric_limits<unsigned int>::max() */
         static_cast<unsigned int>(-1);
@@ -231,14 +254,18 @@ private:
             std::vector<unsigned int> *outputVertStartIndices = nullptr);
 
     // ------------------------------------------------------------------------------------------------
-    void ConvertWeightsToSkeleton(aiMesh *out, const MeshGeometry &geo, const aiMatrix4x4 &absolute_transform,
-            aiNode *parent, unsigned int materialIndex, std::vector<unsigned int> *outputVertStartIndices,
-            SkeletonBoneContainer &skeletonContainer);
+    // Collect the bones ConvertWeights() generated for a mesh as skeleton bones
+    void CollectSkeletonBones(aiMesh *out, SkeletonBoneContainer &skeletonContainer);
 
     // ------------------------------------------------------------------------------------------------
+    // Deformer name is not the same as a bone name - it does contain the bone name though :)
+    // Deformer names in FBX are always unique in an FBX file.
+    using BoneMap = std::map<const std::string, aiBone *>;
+
     void ConvertCluster(std::vector<aiBone *> &local_mesh_bones, const Cluster *cl,
                         std::vector<size_t> &out_indices, std::vector<size_t> &index_out_indices,
-            std::vector<size_t> &count_out_indices, const aiMatrix4x4 &absolute_transform, aiNode *parent);
+            std::vector<size_t> &count_out_indices, const aiMatrix4x4 &absolute_transform, aiNode *parent,
+            BoneMap &bone_map);
 
     // ------------------------------------------------------------------------------------------------
     void ConvertMaterialForMesh(aiMesh* out, const Model& model, const MeshGeometry& geo,
@@ -455,9 +482,8 @@ private:
     using NodeNameCache = std::fbx_unordered_map<std::string, unsigned int>;
     NodeNameCache mNodeNames;
 
-    // Deformer name is not the same as a bone name - it does contain the bone name though :)
-    // Deformer names in FBX are always unique in an FBX file.
-    std::map<const std::string, aiBone *> bone_map;
+    // meshes converted by ConvertPendingMeshes(), in output order
+    std::vector<PendingMesh> mPendingMeshes;
 
     double anim_fps;
 
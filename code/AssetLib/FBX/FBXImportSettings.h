@@ -159,6 +159,10 @@ struct ImportSettings {
 
     // Set to true to ignore the axis configuration in the file
     bool ignoreUpDirection = false;
+
+    /** Number of worker threads, 0 for the hardware concurrency.
+     *  Default value is 1 (serial import). */
+    unsigned int numThreads = 1;
 };
 
 } // namespace FBX
@@ -52,8 +52,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FBXParser.h"
 #include "FBXTokenizer.h"
 #include "FBXUtil.h"
+#include "Common/Importer.h"
 
 #include <assimp/MemoryIOWrapper.h>
+#include <assimp/ParsingUtils.h>
+#include <assimp/Profiler.h>
 #include <assimp/StreamReader.h>
 #include <assimp/importerdesc.h>
 #include <assimp/Importer.hpp>
@@ -84,6 +87,26 @@ namespace {
 	    0,
 	    "fbx"
     };
+
+    // ------------------------------------------------------------------------------------------------
+    // Collects the objects whose data arrays are read while the document is converted. Geometry,
+    // deformers and animation curves are only reached through their connections, all other
+    // objects keep no data arrays which are read.
+    std::vector<const Element *> CollectConvertedObjects(const Document &doc) {
+        std::vector<const Element *> out;
+        for (const auto &entry : doc.Objects()) {
+            // id 0 is the implicit root node, its element is the whole 'Objects' scope
+            if (entry.first == 0 || doc.ConnectionsBySource().count(entry.first) == 0) {
+                continue;
+            }
+            const Element &element = entry.second->GetElement();
+            const std::string type = element.KeyToken().StringContents();
+            if (type == "Geometry" || type == "Deformer" || type == "AnimationCurve") {
+                out.push_back(&element);
+            }
+        }
+        return out;
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -119,6 +142,9 @@ void FBXImporter::SetupProperties(const Importer *pImp) {
     mSettings.convertToMeters = pImp->GetPropertyBool(AI_CONFIG_FBX_CONVERT_TO_M, false);
     mSettings.ignoreUpDirection = pImp->GetPropertyBool(AI_CONFIG_IMPORT_FBX_IGNORE_UP_DIRECTION, false);
     mSettings.useSkeleton = pImp->GetPropertyBool(AI_CONFIG_FBX_USE_SKELETON_BONE_CONTAINER, false);
+    const int threads = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 1);
+    mSettings.numThreads = threads > 0 ? static_cast<unsigned int>(threads) : 0u;
+    mProfiler = pImp->Pimpl()->mProfiler;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -139,11 +165,26 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 	// then becomes very large, too. Assimp doesn't support
 	// streaming for its output data structures so the net win with
 	// streaming input data would be very low.
+	// Files are tokenized in place if the stream keeps the file in memory
+	// (memory mapped files, ReadFileFromMemory). Text files are only used
+	// in place if they do not end in the middle of a token, the number
+	// parsers rely on a delimiter following each token.
 	std::vector<char> contents;
-	contents.resize(stream->FileSize() + 1);
-	stream->Read(&*contents.begin(), 1, contents.size() - 1);
-	contents[contents.size() - 1] = 0;
-	const char *const begin = &*contents.begin();
+	const char *begin = reinterpret_cast<const char *>(stream->GetMappedData());
+	size_t length = stream->FileSize();
+	if (begin != nullptr && (length < 18 || strncmp(begin, "Kaydara FBX Binary", 18))) {
+		if (length == 0 || (begin[length - 1] != '}' && !IsSpaceOrNewLine(begin[length - 1]))) {
+			begin = nullptr;
+		}
+	}
+	if (begin == nullptr) {
+		Profiling::ProfileScope scope(mProfiler, "FBX read");
+		contents.resize(length + 1);
+		stream->Read(&*contents.begin(), 1, length);
+		contents[length] = 0;
+		scope.AddBytes(length);
+		begin = &*contents.begin();
+	}
 
 	// broad-phase tokenized pass in which we identify the core
 	// syntax elements of FBX (brackets, commas, key:value mappings)
@@ -151,22 +192,41 @@ void FBXImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
     Assimp::StackAllocator tempAllocator;
     try {
 		bool is_binary = false;
-		if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
-			is_binary = true;
-            TokenizeBinary(tokens, begin, contents.size(), tempAllocator);
-		} else {
-            Tokenize(tokens, begin, tempAllocator);
+		{
+			Profiling::ProfileScope scope(mProfiler, "FBX tokenize");
+			scope.AddBytes(stream->FileSize());
+			if (!strncmp(begin, "Kaydara FBX Binary", 18)) {
+				is_binary = true;
+				TokenizeBinary(tokens, begin, length, tempAllocator);
+			} else {
+				Tokenize(tokens, begin, length, tempAllocator);
+			}
 		}
 
 		// use this information to construct a very rudimentary
 		// parse-tree representing the FBX scope structure
+		std::unique_ptr<Profiling::ProfileScope> parseScope(new Profiling::ProfileScope(mProfiler, "FBX parse"));
         Parser parser(tokens, tempAllocator, is_binary);
 
 		// take the raw parse-tree and convert it to a FBX DOM
 		Document doc(parser, mSettings);
 
+		// the objects are only parsed on demand, so the compressed data arrays of the
+		// objects the converter is going to read can be inflated up front if we may use
+		// more than one thread
+		if (is_binary && mSettings.numThreads != 1) {
+			parser.InflateBinaryArrays(CollectConvertedObjects(doc), mSettings.numThreads);
+		}
+		parseScope.reset();
+
 		// convert the FBX DOM to aiScene
-		ConvertToAssimpScene(pScene, doc, mSettings.removeEmptyBones);
+		{
+			Profiling::ProfileScope scope(mProfiler, "FBX convert");
+			ConvertToAssimpScene(pScene, doc, mSettings.removeEmptyBones);
+		}
+		if (const size_t unused = parser.ReleaseInflatedArrays()) {
+			ASSIMP_LOG_DEBUG("Released ", unused, " inflated binary FBX data arrays which were never read");
+		}
 
 		// size relative to cm
 		float size_relative_to_cm = doc.GlobalSettings().UnitScaleFactor();
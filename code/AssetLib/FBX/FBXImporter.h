@@ -62,6 +62,10 @@ typedef class basic_formatter<char, std::char_traits<char>, std::allocator<char>
 
 } // namespace Formatter
 
+namespace Profiling {
+class Profiler;
+} // namespace Profiling
+
 // -------------------------------------------------------------------------------------------
 /// Loads the Autodesk FBX file format.
 ///
@@ -92,6 +96,9 @@ protected:
 
 private:
     FBX::ImportSettings mSettings;
+
+    /// Profiler of the current import, nullptr if time measurement is disabled.
+    Profiling::Profiler *mProfiler = nullptr;
 }; // !class FBXImporter
 
 } // end of namespace Assimp
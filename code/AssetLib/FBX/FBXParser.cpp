@@ -46,6 +46,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef ASSIMP_BUILD_NO_FBX_IMPORTER
 
 #include "Common/Compression.h"
+#include "Common/ParallelFor.h"
 
 #include "FBXTokenizer.h"
 #include "FBXParser.h"
@@ -112,7 +113,7 @@ namespace FBX {
 
 // ------------------------------------------------------------------------------------------------
 Element::Element(const Token& key_token, Parser& parser) :
-    key_token(key_token), compound(nullptr)
+    parser(parser), key_token(key_token), compound(nullptr)
 {
     TokenPtr n = nullptr;
     StackAllocator &allocator = parser.GetAllocator();
@@ -528,9 +529,42 @@ void ReadBinaryDataArrayHead(const char*& data, const char* end, char& type, uin
 
 
 // ------------------------------------------------------------------------------------------------
-// read binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header)
-void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const char* end,
-        std::vector<char>& buff, const Element& /*el*/) {
+// get the size of a single binary data array entry, 0 if the type is not known
+uint32_t GetBinaryDataArrayStride(char type) {
+    switch(type)
+    {
+        case 'f':
+        case 'i':
+            return 4;
+
+        case 'd':
+        case 'l':
+            return 8;
+
+        default:
+            return 0;
+    };
+}
+
+// ------------------------------------------------------------------------------------------------
+// check whether a token holds a zlib compressed binary data array
+bool IsCompressedDataArray(const Token& t) {
+    if (!t.IsBinary() || t.Type() != TokenType_DATA || static_cast<size_t>(t.end() - t.begin()) < 13) {
+        return false;
+    }
+    if (!GetBinaryDataArrayStride(*t.begin())) {
+        return false;
+    }
+
+    BE_NCONST uint32_t encmode = SafeParse<uint32_t>(t.begin() + 5, t.end());
+    AI_SWAP4(encmode);
+    return encmode == 1;
+}
+
+// ------------------------------------------------------------------------------------------------
+// decode binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header)
+void DecodeBinaryDataArray(char type, uint32_t count, const char*& data, const char* end,
+        std::vector<char>& buff) {
     BE_NCONST uint32_t encmode = SafeParse<uint32_t>(data, end);
     AI_SWAP4(encmode);
     data += 4;
@@ -543,22 +577,8 @@ void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const cha
     ai_assert(data + comp_len == end);
 
     // determine the length of the uncompressed data by looking at the type signature
-    uint32_t stride = 0;
-    switch(type)
-    {
-        case 'f':
-        case 'i':
-            stride = 4;
-            break;
-
-        case 'd':
-        case 'l':
-            stride = 8;
-            break;
-
-        default:
-            ai_assert(false);
-    };
+    const uint32_t stride = GetBinaryDataArrayStride(type);
+    ai_assert(stride != 0);
 
     const uint32_t full_length = stride * count;
     buff.resize(full_length);
@@ -589,8 +609,104 @@ void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const cha
     ai_assert(data == end);
 }
 
+// ------------------------------------------------------------------------------------------------
+// read binary data array, assume cursor points to the 'compression mode' field (i.e. behind the header)
+void ReadBinaryDataArray(char type, uint32_t count, const char*& data, const char* end,
+        std::vector<char>& buff, const Element& el) {
+    // use the contents inflated by Parser::InflateBinaryArrays() if available
+    if (el.GetParser().TakeInflatedArray(*el.Tokens()[0], buff)) {
+        data = end;
+        return;
+    }
+    DecodeBinaryDataArray(type, count, data, end, buff);
+}
+
+// ------------------------------------------------------------------------------------------------
+// collect the compressed binary data arrays below a scope, the edge list of a geometry is never read
+void CollectCompressedDataArrays(const Scope& sc, std::vector<TokenPtr>& out) {
+    for (const auto& entry : sc.Elements()) {
+        if (entry.first == "Edges") {
+            continue;
+        }
+        const Element& el = *entry.second;
+        const TokenList& tok = el.Tokens();
+        if (!tok.empty() && IsCompressedDataArray(*tok[0])) {
+            out.push_back(tok[0]);
+        }
+        if (el.Compound()) {
+            CollectCompressedDataArrays(*el.Compound(), out);
+        }
+    }
+}
+
 } // !anon
 
+// ------------------------------------------------------------------------------------------------
+size_t Parser::InflateBinaryArrays(const std::vector<const Element*> &elements, unsigned int numThreads)
+{
+    std::vector<TokenPtr> arrays;
+    for (const Element* el : elements) {
+        if (el->Compound()) {
+            CollectCompressedDataArrays(*el->Compound(), arrays);
+        }
+    }
+    if (arrays.empty()) {
+        return 0;
+    }
+
+    // create all map entries up front so the workers only touch their own buffer
+    std::vector<std::vector<char>*> buffers;
+    buffers.reserve(arrays.size());
+    for (TokenPtr t : arrays) {
+        buffers.push_back(&inflated_arrays[t]);
+    }
+
+    ParallelFor(numThreads, static_cast<unsigned int>(arrays.size()), [&](unsigned int i) {
+        const char* data = arrays[i]->begin();
+        const char* const end = arrays[i]->end();
+
+        const char type = *data;
+        BE_NCONST uint32_t count = SafeParse<uint32_t>(data + 1, end);
+        AI_SWAP4(count);
+        data += 5;
+
+        try {
+            DecodeBinaryDataArray(type, count, data, end, *buffers[i]);
+        } catch (const DeadlyImportError&) {
+            // leave it to ParseVectorDataArray() to report the error with proper context
+            buffers[i]->clear();
+        }
+    });
+
+    ASSIMP_LOG_DEBUG("Inflated ", arrays.size(), " binary FBX data arrays");
+    return arrays.size();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool Parser::TakeInflatedArray(const Token &token, std::vector<char> &out) const
+{
+    auto it = inflated_arrays.find(&token);
+    if (it == inflated_arrays.end() || it->second.empty()) {
+        return false;
+    }
+    out.swap(it->second);
+    it->second.clear();
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t Parser::ReleaseInflatedArrays()
+{
+    size_t unused = 0;
+    for (const auto& entry : inflated_arrays) {
+        if (!entry.second.empty()) {
+            ++unused;
+        }
+    }
+    std::fbx_unordered_map<const Token*, std::vector<char>>().swap(inflated_arrays);
+    return unused;
+}
+
 
 // ------------------------------------------------------------------------------------------------
 // read an array of float3 tuples
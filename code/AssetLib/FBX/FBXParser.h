@@ -101,7 +101,12 @@ public:
         return tokens;
     }
 
+    const Parser& GetParser() const {
+        return parser;
+    }
+
 private:
+    const Parser& parser;
     const Token& key_token;
     TokenList tokens;
     Scope* compound;
@@ -174,6 +179,22 @@ public:
         return allocator;
     }
 
+    /** Inflate the zlib compressed binary data arrays below some elements
+     *  in parallel, so ParseVectorDataArray() does not need to do it on the fly.
+     *  @param elements The elements whose arrays are going to be read.
+     *  @param numThreads Number of threads to use, 0 for all cores.
+     *  @return Number of arrays inflated. */
+    size_t InflateBinaryArrays(const std::vector<const Element*> &elements, unsigned int numThreads);
+
+    /** Free the inflated arrays which were never taken.
+     *  @return Number of arrays freed. */
+    size_t ReleaseInflatedArrays();
+
+    /** Hand over the inflated contents of a binary data array token
+     *  to the caller. Each array can be taken only once.
+     *  @return false if the array was not inflated up front. */
+    bool TakeInflatedArray(const Token &token, std::vector<char> &out) const;
+
 private:
     friend class Scope;
     friend class Element;
@@ -190,6 +211,9 @@ private:
     Scope *root;
 
     const bool is_binary;
+
+    // binary array token -> inflated contents, see InflateBinaryArrays()
+    mutable std::fbx_unordered_map<const Token*, std::vector<char>> inflated_arrays;
 };
 
 
@@ -131,7 +131,7 @@ void ProcessDataToken(TokenList &output_tokens, StackAllocator &token_allocator,
 }
 
 // ------------------------------------------------------------------------------------------------
-void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &token_allocator) {
+void Tokenize(TokenList &output_tokens, const char *input, size_t length, StackAllocator &token_allocator) {
 	ai_assert(input);
 	ASSIMP_LOG_DEBUG("Tokenizing ASCII FBX file");
 
@@ -144,7 +144,8 @@ void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &token
     bool pending_data_token = false;
 
     const char *token_begin = nullptr, *token_end = nullptr;
-    for (const char* cur = input;*cur;column += (*cur == '\t' ? ASSIMP_FBX_TAB_WIDTH : 1), ++cur) {
+    const char *const input_end = input + length;
+    for (const char* cur = input;cur != input_end && *cur;column += (*cur == '\t' ? ASSIMP_FBX_TAB_WIDTH : 1), ++cur) {
         const char c = *cur;
 
         if (IsLineEnd(c)) {
@@ -217,7 +218,7 @@ void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &token
                 // peek ahead and check if the next token is a colon in which
                 // case this counts as KEY token.
                 TokenType type = TokenType_DATA;
-                for (const char* peek = cur;  *peek && IsSpaceOrNewLine(*peek); ++peek) {
+                for (const char* peek = cur; peek != input_end && *peek && IsSpaceOrNewLine(*peek); ++peek) {
                     if (*peek == ':') {
                         type = TokenType_KEY;
                         cur = peek;
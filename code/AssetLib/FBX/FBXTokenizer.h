@@ -166,9 +166,11 @@ typedef std::vector< TokenPtr > TokenList;
  *  Skips over comments and generates line and column numbers.
  *
  * @param output_tokens Receives a list of all tokens in the input data.
- * @param input_buffer Textual input buffer to be processed, 0-terminated.
+ * @param input_buffer Textual input buffer to be processed. Tokenization stops at
+ *   the end of the buffer or at the first 0-character, whichever comes first.
+ * @param length Length of input buffer, in bytes.
  * @throw DeadlyImportError if something goes wrong */
-void Tokenize(TokenList &output_tokens, const char *input, StackAllocator &tokenAllocator);
+void Tokenize(TokenList &output_tokens, const char *input, size_t length, StackAllocator &tokenAllocator);
 
 
 /** Tokenizer function for binary FBX files.
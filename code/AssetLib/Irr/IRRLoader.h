@@ -280,6 +280,9 @@ private:
     /// Configuration option: speed flag was set?
     bool configSpeedFlag;
 
+    /// Configuration option: threads used to load external files
+    unsigned int numThreads;
+
     std::vector<aiCamera*> cameras;
     std::vector<aiLight*> lights;
     unsigned int guessedMeshCnt;
@@ -142,7 +142,8 @@ LWSImporter::LWSImporter() :
         first(),
         last(),
         fps(),
-        noSkeletonMesh() {
+        noSkeletonMesh(),
+        numThreads(1) {
     // nothing to do here
 }
 
@@ -183,6 +184,10 @@ void LWSImporter::SetupProperties(const Importer *pImp) {
     }
 
     noSkeletonMesh = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_NO_SKELETON_MESHES, 0) != 0;
+
+    // AI_CONFIG_IMPORT_NUM_THREADS
+    const int threads = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 1);
+    numThreads = threads > 0 ? static_cast<unsigned int>(threads) : 0u;
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -513,6 +518,7 @@ void LWSImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     // Construct a Batch-importer to read more files recursively
     BatchLoader batch(pIOHandler);
+    batch.setNumThreads(numThreads);
 
     // Construct an array to receive the flat output graph
     std::list<LWS::NodeDesc> nodes;
@@ -230,6 +230,7 @@ private:
     IOSystem *io;
     double first, last, fps;
     bool noSkeletonMesh;
+    unsigned int numThreads;
 };
 
 } // end of namespace Assimp
@@ -59,29 +59,41 @@ struct Material;
 // ------------------------------------------------------------------------------------------------
 //! \struct Face
 //! \brief  Data structure for a simple obj-face, describes discredit,l.ation and materials
+//!
+//! A face does not own its indices: they are stored back to back in the index arrays of
+//! the mesh the face belongs to, the face only stores where its range starts and how long
+//! it is. This keeps the parser from allocating for every single face.
 // ------------------------------------------------------------------------------------------------
 struct Face {
-    using IndexArray = std::vector<unsigned int>;
-
     //! Primitive type
     aiPrimitiveType mPrimitiveType;
-    //! Vertex indices
-    IndexArray m_vertices;
-    //! Normal indices
-    IndexArray m_normals;
-    //! Texture coordinates indices
-    IndexArray m_texturCoords;
+    //! Offset of the first vertex index in Mesh::m_vertexIndices
+    unsigned int m_vertexOffset;
+    //! Number of vertex indices
+    unsigned int m_numVertices;
+    //! Offset of the first normal index in Mesh::m_normalIndices
+    unsigned int m_normalOffset;
+    //! Number of normal indices
+    unsigned int m_numNormals;
+    //! Offset of the first texture coordinate index in Mesh::m_texCoordIndices
+    unsigned int m_texCoordOffset;
+    //! Number of texture coordinate indices
+    unsigned int m_numTexCoords;
     //! Pointer to assigned material
     Material *m_pMaterial;
 
     //! \brief  Default constructor
     Face(aiPrimitiveType pt = aiPrimitiveType_POLYGON) :
-            mPrimitiveType(pt), m_vertices(), m_normals(), m_texturCoords(), m_pMaterial(nullptr) {
+            mPrimitiveType(pt),
+            m_vertexOffset(0),
+            m_numVertices(0),
+            m_normalOffset(0),
+            m_numNormals(0),
+            m_texCoordOffset(0),
+            m_numTexCoords(0),
+            m_pMaterial(nullptr) {
         // empty
     }
-
-    //! \brief  Destructor
-    ~Face() = default;
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -227,8 +239,14 @@ struct Mesh {
     static const unsigned int NoMaterial = ~0u;
     /// The name for the mesh
     std::string m_name;
-    /// Array with pointer to all stored faces
-    std::vector<Face*> m_Faces;
+    /// Array with all stored faces
+    std::vector<Face> m_Faces;
+    /// Vertex indices of all faces, referenced by Face::m_vertexOffset
+    std::vector<unsigned int> m_vertexIndices;
+    /// Normal indices of all faces, referenced by Face::m_normalOffset
+    std::vector<unsigned int> m_normalIndices;
+    /// Texture coordinate indices of all faces, referenced by Face::m_texCoordOffset
+    std::vector<unsigned int> m_texCoordIndices;
     /// Assigned material
     Material *m_pMaterial;
     /// Number of stored indices.
@@ -251,12 +269,7 @@ struct Mesh {
     }
 
     /// Destructor
-    ~Mesh() {
-        for (std::vector<Face *>::iterator it = m_Faces.begin();
-                it != m_Faces.end(); ++it) {
-            delete *it;
-        }
-    }
+    ~Mesh() = default;
 };
 
 // ------------------------------------------------------------------------------------------------
@@ -78,7 +78,8 @@ using namespace std;
 ObjFileImporter::ObjFileImporter() :
         m_Buffer(),
         m_pRootObject(nullptr),
-        m_strAbsPath(std::string(1, DefaultIOSystem().getOsSeparator())) {
+        m_strAbsPath(std::string(1, DefaultIOSystem().getOsSeparator())),
+        m_numThreads(1) {
     // empty
 }
 
@@ -95,6 +96,12 @@ bool ObjFileImporter::CanRead(const std::string &pFile, IOSystem *pIOHandler, bo
     return BaseImporter::SearchFileHeaderForToken(pIOHandler, pFile, tokens, AI_COUNT_OF(tokens), 200, false, true);
 }
 
+// ------------------------------------------------------------------------------------------------
+void ObjFileImporter::SetupProperties(const Importer *pImp) {
+    const int threads = pImp->GetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 1);
+    m_numThreads = threads > 0 ? static_cast<unsigned int>(threads) : 0u;
+}
+
 // ------------------------------------------------------------------------------------------------
 const aiImporterDesc *ObjFileImporter::GetInfo() const {
     return &desc;
@@ -124,12 +131,6 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
         throw DeadlyImportError("OBJ-file is too small.");
     }
 
-    IOStreamBuffer<char> streamedBuffer;
-    streamedBuffer.open(fileStream.get());
-
-    // Allocate buffer and read file into it
-    //TextFileToBuffer( fileStream.get(),m_Buffer);
-
     // Get the model name
     std::string modelName, folderName;
     std::string::size_type pos = file.find_last_of("\\/");
@@ -144,12 +145,27 @@ void ObjFileImporter::InternReadFile(const std::string &file, aiScene *pScene, I
     }
 
     // parse the file into a temporary representation
-    ObjFileParser parser(streamedBuffer, modelName, pIOHandler, m_progress, file);
+    std::unique_ptr<ObjFileParser> parser;
+    if (m_numThreads != 1) {
+        // the parallel parser needs the whole file, use it in place if the stream keeps it in memory
+        const char *data = reinterpret_cast<const char *>(fileStream->GetMappedData());
+        if (data == nullptr) {
+            m_Buffer.resize(fileSize);
+            if (fileStream->Read(m_Buffer.data(), 1, fileSize) != fileSize) {
+                throw DeadlyImportError("OBJ: Failed to read file ", file, ".");
+            }
+            data = m_Buffer.data();
+        }
+        parser.reset(new ObjFileParser(data, fileSize, modelName, pIOHandler, m_progress, file, m_numThreads));
+    } else {
+        IOStreamBuffer<char> streamedBuffer;
+        streamedBuffer.open(fileStream.get());
+        parser.reset(new ObjFileParser(streamedBuffer, modelName, pIOHandler, m_progress, file));
+        streamedBuffer.close();
+    }
 
     // And create the proper return structures out of it
-    CreateDataFromImport(parser.GetModel(), pScene);
-
-    streamedBuffer.close();
+    CreateDataFromImport(parser->GetModel(), pScene);
 
     // Clean up allocated storage for the next import
     m_Buffer.clear();
@@ -328,21 +344,16 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
         pMesh->mName.Set(pObjMesh->m_name);
     }
 
-    for (size_t index = 0; index < pObjMesh->m_Faces.size(); index++) {
-        const ObjFile::Face *inp = pObjMesh->m_Faces[index];
-        if (inp == nullptr) {
-            continue;
-        }
-
-        if (inp->mPrimitiveType == aiPrimitiveType_LINE) {
-            pMesh->mNumFaces += static_cast<unsigned int>(inp->m_vertices.size() - 1);
+    for (const ObjFile::Face &inp : pObjMesh->m_Faces) {
+        if (inp.mPrimitiveType == aiPrimitiveType_LINE) {
+            pMesh->mNumFaces += inp.m_numVertices - 1;
             pMesh->mPrimitiveTypes |= aiPrimitiveType_LINE;
-        } else if (inp->mPrimitiveType == aiPrimitiveType_POINT) {
-            pMesh->mNumFaces += static_cast<unsigned int>(inp->m_vertices.size());
+        } else if (inp.mPrimitiveType == aiPrimitiveType_POINT) {
+            pMesh->mNumFaces += inp.m_numVertices;
             pMesh->mPrimitiveTypes |= aiPrimitiveType_POINT;
         } else {
             ++pMesh->mNumFaces;
-            if (inp->m_vertices.size() > 3) {
+            if (inp.m_numVertices > 3) {
                 pMesh->mPrimitiveTypes |= aiPrimitiveType_POLYGON;
             } else {
                 pMesh->mPrimitiveTypes |= aiPrimitiveType_TRIANGLE;
@@ -360,17 +371,16 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
         unsigned int outIndex = 0u;
 
         // Copy all data from all stored meshes
-        for (auto &face : pObjMesh->m_Faces) {
-            const ObjFile::Face *inp = face;
-            if (inp->mPrimitiveType == aiPrimitiveType_LINE) {
-                for (size_t i = 0; i < inp->m_vertices.size() - 1; ++i) {
+        for (const ObjFile::Face &inp : pObjMesh->m_Faces) {
+            if (inp.mPrimitiveType == aiPrimitiveType_LINE) {
+                for (unsigned int i = 0; i + 1 < inp.m_numVertices; ++i) {
                     aiFace &f = pMesh->mFaces[outIndex++];
                     uiIdxCount += f.mNumIndices = 2;
                     f.mIndices = new unsigned int[2];
                 }
                 continue;
-            } else if (inp->mPrimitiveType == aiPrimitiveType_POINT) {
-                for (size_t i = 0; i < inp->m_vertices.size(); ++i) {
+            } else if (inp.mPrimitiveType == aiPrimitiveType_POINT) {
+                for (unsigned int i = 0; i < inp.m_numVertices; ++i) {
                     aiFace &f = pMesh->mFaces[outIndex++];
                     uiIdxCount += f.mNumIndices = 1;
                     f.mIndices = new unsigned int[1];
@@ -379,7 +389,7 @@ std::unique_ptr<aiMesh> ObjFileImporter::createTopology(const ObjFile::Model *pM
             }
 
             aiFace *pFace = &pMesh->mFaces[outIndex++];
-            const unsigned int uiNumIndices = (unsigned int)face->m_vertices.size();
+            const unsigned int uiNumIndices = inp.m_numVertices;
             uiIdxCount += pFace->mNumIndices = (unsigned int)uiNumIndices;
             if (pFace->mNumIndices > 0) {
                 pFace->mIndices = new unsigned int[uiNumIndices];
@@ -442,10 +452,14 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
     // Copy vertices, normals and textures into aiMesh instance
     bool normalsok = true, uvok = true;
     unsigned int newIndex = 0, outIndex = 0;
-    for (auto sourceFace : pObjMesh->m_Faces) {
+    for (const ObjFile::Face &sourceFace : pObjMesh->m_Faces) {
+        const unsigned int *vertexIndices = pObjMesh->m_vertexIndices.data() + sourceFace.m_vertexOffset;
+        const unsigned int *normalIndices = pObjMesh->m_normalIndices.data() + sourceFace.m_normalOffset;
+        const unsigned int *texCoordIndices = pObjMesh->m_texCoordIndices.data() + sourceFace.m_texCoordOffset;
+
         // Copy all index arrays
-        for (size_t vertexIndex = 0, outVertexIndex = 0; vertexIndex < sourceFace->m_vertices.size(); vertexIndex++) {
-            const unsigned int vertex = sourceFace->m_vertices.at(vertexIndex);
+        for (unsigned int vertexIndex = 0, outVertexIndex = 0; vertexIndex < sourceFace.m_numVertices; vertexIndex++) {
+            const unsigned int vertex = vertexIndices[vertexIndex];
             if (vertex >= pModel->mVertices.size()) {
                 throw DeadlyImportError("OBJ: vertex index out of range");
             }
@@ -457,8 +471,8 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
             pMesh->mVertices[newIndex] = pModel->mVertices[vertex];
 
             // Copy all normals
-            if (normalsok && !pModel->mNormals.empty() && vertexIndex < sourceFace->m_normals.size()) {
-                const unsigned int normal = sourceFace->m_normals.at(vertexIndex);
+            if (normalsok && !pModel->mNormals.empty() && vertexIndex < sourceFace.m_numNormals) {
+                const unsigned int normal = normalIndices[vertexIndex];
                 if (normal >= pModel->mNormals.size()) {
                     normalsok = false;
                 } else {
@@ -473,8 +487,8 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
             }
 
             // Copy all texture coordinates
-            if (uvok && !pModel->mTextureCoord.empty() && vertexIndex < sourceFace->m_texturCoords.size()) {
-                const unsigned int tex = sourceFace->m_texturCoords.at(vertexIndex);
+            if (uvok && !pModel->mTextureCoord.empty() && vertexIndex < sourceFace.m_numTexCoords) {
+                const unsigned int tex = texCoordIndices[vertexIndex];
 
                 if (tex >= pModel->mTextureCoord.size()) {
                     uvok = false;
@@ -487,16 +501,16 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
             // Get destination face
             aiFace *pDestFace = &pMesh->mFaces[outIndex];
 
-            const bool last = (vertexIndex == sourceFace->m_vertices.size() - 1);
-            if (sourceFace->mPrimitiveType != aiPrimitiveType_LINE || !last) {
+            const bool last = (vertexIndex == sourceFace.m_numVertices - 1);
+            if (sourceFace.mPrimitiveType != aiPrimitiveType_LINE || !last) {
                 pDestFace->mIndices[outVertexIndex] = newIndex;
                 outVertexIndex++;
             }
 
-            if (sourceFace->mPrimitiveType == aiPrimitiveType_POINT) {
+            if (sourceFace.mPrimitiveType == aiPrimitiveType_POINT) {
                 outIndex++;
                 outVertexIndex = 0;
-            } else if (sourceFace->mPrimitiveType == aiPrimitiveType_LINE) {
+            } else if (sourceFace.mPrimitiveType == aiPrimitiveType_LINE) {
                 outVertexIndex = 0;
 
                 if (!last)
@@ -509,7 +523,7 @@ void ObjFileImporter::createVertexArray(const ObjFile::Model *pModel,
                         }
 
                         pMesh->mVertices[newIndex + 1] = pMesh->mVertices[newIndex];
-                        if (!sourceFace->m_normals.empty() && !pModel->mNormals.empty()) {
+                        if (sourceFace.m_numNormals > 0 && !pModel->mNormals.empty()) {
                             pMesh->mNormals[newIndex + 1] = pMesh->mNormals[newIndex];
                         }
                         if (!pModel->mTextureCoord.empty()) {
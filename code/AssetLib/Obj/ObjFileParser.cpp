@@ -44,12 +44,15 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ObjFileData.h"
 #include "ObjFileMtlImporter.h"
 #include "ObjTools.h"
+#include "Common/ParallelFor.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/ParsingUtils.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/Importer.hpp>
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -84,6 +87,33 @@ ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::stri
     std::fill_n(m_buffer, Buffersize, '\0');
 
     // Create the model instance to store all the data
+    createModel(modelName);
+
+    // Start parsing the file
+    parseFile(streamBuffer);
+}
+
+ObjFileParser::ObjFileParser(const char *data, size_t size, const std::string &modelName,
+        IOSystem *io, ProgressHandler *progress,
+        const std::string &originalObjFileName, unsigned int numThreads) :
+        m_DataIt(),
+        m_DataItEnd(),
+        m_pModel(nullptr),
+        m_uiLine(0),
+        m_buffer(),
+        m_pIO(io),
+        m_progress(progress),
+        m_originalObjFileName(originalObjFileName) {
+    std::fill_n(m_buffer, Buffersize, '\0');
+
+    // Create the model instance to store all the data
+    createModel(modelName);
+
+    // Start parsing the file
+    parseFileParallel(data, size, numThreads);
+}
+
+void ObjFileParser::createModel(const std::string &modelName) {
     m_pModel.reset(new ObjFile::Model());
     m_pModel->mModelName = modelName;
 
@@ -92,9 +122,6 @@ ObjFileParser::ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::stri
     m_pModel->mDefaultMaterial->MaterialName.Set(DEFAULT_MATERIAL);
     m_pModel->mMaterialLib.emplace_back(DEFAULT_MATERIAL);
     m_pModel->mMaterialMap[DEFAULT_MATERIAL] = m_pModel->mDefaultMaterial;
-
-    // Start parsing the file
-    parseFile(streamBuffer);
 }
 
 void ObjFileParser::setBuffer(std::vector<char> &buffer) {
@@ -129,128 +156,361 @@ void ObjFileParser::parseFile(IOStreamBuffer<char> &streamBuffer) {
             m_progress->UpdateFileRead(processed, progressTotal);
         }
 
-        // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
-        if (insideCstype) {
-            switch (*m_DataIt) {
-            case 'e': {
-                std::string name;
-                getNameNoSpace(m_DataIt, m_DataItEnd, name);
-                insideCstype = name != "end";
-            } break;
-            }
-            goto pf_skip_line;
-        }
+        parseLine(insideCstype);
+    }
+}
 
-        // parse line
+void ObjFileParser::parseLine(bool &insideCstype) {
+    // handle c-stype section end (http://paulbourke.net/dataformats/obj/)
+    if (insideCstype) {
         switch (*m_DataIt) {
-        case 'v': // Parse a vertex texture coordinate
-        {
-            ++m_DataIt;
-            if (*m_DataIt == ' ' || *m_DataIt == '\t') {
-                size_t numComponents = getNumComponentsInDataDefinition();
-                if (numComponents == 3) {
-                    // read in vertex definition
-                    getVector3(m_pModel->mVertices);
-                } else if (numComponents == 4) {
-                    // read in vertex definition (homogeneous coords)
-                    getHomogeneousVector3(m_pModel->mVertices);
-                } else if (numComponents == 6) {
-                    // fill previous omitted vertex-colors by default
-                    if (m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
-                        m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
-                    }
-                    // read vertex and vertex-color
-                    getTwoVectors3(m_pModel->mVertices, m_pModel->mVertexColors);
-                }
-                // append omitted vertex-colors as default for the end if any vertex-color exists
-                if (!m_pModel->mVertexColors.empty() && m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
-                    m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
-                }
-            } else if (*m_DataIt == 't') {
-                // read in texture coordinate ( 2D or 3D )
-                ++m_DataIt;
-                size_t dim = getTexCoordVector(m_pModel->mTextureCoord);
-                m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, (unsigned int)dim);
-            } else if (*m_DataIt == 'n') {
-                // Read in normal vector definition
-                ++m_DataIt;
-                getVector3(m_pModel->mNormals);
-            }
+        case 'e': {
+            std::string name;
+            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+            insideCstype = name != "end";
         } break;
+        }
+        goto pf_skip_line;
+    }
 
-        case 'p': // Parse a face, line or point statement
-        case 'l':
-        case 'f': {
-            getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
-        } break;
+    // parse line
+    switch (*m_DataIt) {
+    case 'v': // Parse a vertex, texture coordinate or normal
+    {
+        getVertexData();
+    } break;
 
-        case '#': // Parse a comment
-        {
-            getComment();
-        } break;
+    case 'p': // Parse a face, line or point statement
+    case 'l':
+    case 'f': {
+        getFace(*m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT));
+    } break;
 
-        case 'u': // Parse a material desc. setter
-        {
-            std::string name;
+    case '#': // Parse a comment
+    {
+        getComment();
+    } break;
 
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+    case 'u': // Parse a material desc. setter
+    {
+        std::string name;
+
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
+
+        if (name == "usemtl") {
+            getMaterialDesc();
+        }
+    } break;
+
+    case 'm': // Parse a material library or merging group ('mg')
+    {
+        std::string name;
+
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
 
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
+        size_t nextSpace = name.find(' ');
+        if (nextSpace != std::string::npos)
+            name = name.substr(0, nextSpace);
 
-            if (name == "usemtl") {
-                getMaterialDesc();
+        if (name == "mg")
+            getGroupNumberAndResolution();
+        else if (name == "mtllib")
+            getMaterialLib();
+        else
+            goto pf_skip_line;
+    } break;
+
+    case 'g': // Parse group name
+    {
+        getGroupName();
+    } break;
+
+    case 's': // Parse group number
+    {
+        getGroupNumber();
+    } break;
+
+    case 'o': // Parse object name
+    {
+        getObjectName();
+    } break;
+
+    case 'c': // handle cstype section start
+    {
+        std::string name;
+        getNameNoSpace(m_DataIt, m_DataItEnd, name);
+        insideCstype = name == "cstype";
+        goto pf_skip_line;
+    }
+
+    default: {
+    pf_skip_line:
+        m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+    } break;
+    }
+}
+
+// -------------------------------------------------------------------
+//  Parallel parsing: the file is split into chunks which start at the beginning of a
+//  line. Each chunk is parsed on a worker thread. Vertex data goes into arrays of the
+//  chunk, faces are only tokenized because their relative indices, the current object
+//  and the current material depend on everything in front of them. Faces and all other
+//  statements are recorded and replayed in file order when the chunks are merged.
+struct ObjFileParser::Chunk {
+    /// A face or another statement which has to be replayed in file order
+    struct Record {
+        /// Offset of the line in the file, used for statements which are no faces
+        size_t lineOffset;
+        /// The aiPrimitiveType of a face, 0 for other statements
+        unsigned int type;
+        /// Range of the face in the tokens of the chunk
+        unsigned int firstToken;
+        unsigned int numTokens;
+        /// Number of vertices, texture coordinates and normals of the chunk in front of the face
+        unsigned int numVertices;
+        unsigned int numTexCoords;
+        unsigned int numNormals;
+        /// True if the face is a point statement with index separators
+        bool separatorInPoint;
+    };
+
+    size_t begin = 0;
+    size_t end = 0;
+    std::vector<aiVector3D> vertices;
+    std::vector<aiVector3D> vertexColors;
+    std::vector<aiVector3D> normals;
+    std::vector<aiVector3D> texCoords;
+    unsigned int texCoordDim = 0;
+    std::vector<FaceToken> tokens;
+    std::vector<Record> records;
+    /// True if the chunk contains free-form geometry (cstype sections)
+    bool hasFreeForm = false;
+};
+
+// Copies the data line starting at pos into buffer and joins continued lines, like
+// IOStreamBuffer::getNextDataLine() does. Returns the start of the next line.
+static const char *getDataLine(const char *pos, const char *end, std::vector<char> &buffer) {
+    buffer.clear();
+    while (pos < end) {
+        if (*pos == '\\' && pos + 1 < end && IsLineEnd(pos[1])) {
+            while (pos < end && *pos != '\n') {
+                ++pos;
             }
-        } break;
+            if (pos < end) {
+                ++pos;
+            }
+            continue;
+        }
+        if (IsLineEnd(*pos)) {
+            break;
+        }
+        buffer.push_back(*pos);
+        ++pos;
+    }
 
-        case 'm': // Parse a material library or merging group ('mg')
-        {
-            std::string name;
+    // terminate the line, the padding keeps the end of the line apart from the end of the buffer
+    buffer.push_back('\n');
+    buffer.push_back('\0');
+    buffer.push_back('\0');
 
-            getNameNoSpace(m_DataIt, m_DataItEnd, name);
+    return pos < end ? pos + 1 : end;
+}
 
-            size_t nextSpace = name.find(' ');
-            if (nextSpace != std::string::npos)
-                name = name.substr(0, nextSpace);
+// Returns the first position at or after pos where a data line starts, i.e. the position
+// behind a line break which does not belong to a continued line.
+static size_t findDataLineStart(const char *data, size_t size, size_t pos) {
+    while (pos < size) {
+        const char *lineEnd = static_cast<const char *>(::memchr(data + pos, '\n', size - pos));
+        if (lineEnd == nullptr) {
+            return size;
+        }
 
-            if (name == "mg")
-                getGroupNumberAndResolution();
-            else if (name == "mtllib")
-                getMaterialLib();
-            else
-                goto pf_skip_line;
-        } break;
+        // look for a continuation token in the physical line in front of the line break
+        const char *lineBegin = lineEnd;
+        while (lineBegin > data && lineBegin[-1] != '\n') {
+            --lineBegin;
+        }
+        bool continued = false;
+        for (const char *it = lineBegin; it < lineEnd && !continued; ++it) {
+            continued = (*it == '\\' && IsLineEnd(it[1]));
+        }
 
-        case 'g': // Parse group name
-        {
-            getGroupName();
-        } break;
+        pos = static_cast<size_t>(lineEnd - data) + 1;
+        if (!continued) {
+            return pos;
+        }
+    }
+    return size;
+}
+
+void ObjFileParser::parseFileParallel(const char *data, size_t size, unsigned int numThreads) {
+    static constexpr size_t MinChunkSize = 64 * 1024;
+
+    // Split the file into one chunk per thread
+    const size_t numChunks = std::max<size_t>(1, std::min<size_t>(GetNumWorkerThreads(numThreads), size / MinChunkSize));
+    std::vector<Chunk> chunks;
+    chunks.reserve(numChunks);
+    size_t begin = 0;
+    for (size_t i = 1; i <= numChunks && begin < size; ++i) {
+        const size_t end = (i == numChunks) ? size : findDataLineStart(data, size, std::max(begin, size / numChunks * i));
+        if (end > begin) {
+            chunks.emplace_back();
+            chunks.back().begin = begin;
+            chunks.back().end = end;
+            begin = end;
+        }
+    }
+
+    ParallelFor(numThreads, static_cast<unsigned int>(chunks.size()), [&](unsigned int i) {
+        ObjFileParser worker;
+        worker.m_pModel.reset(new ObjFile::Model());
+        worker.parseChunk(data, chunks[i]);
+    });
+    m_progress->UpdateFileRead(static_cast<unsigned int>(size / 2), static_cast<unsigned int>(size));
 
-        case 's': // Parse group number
-        {
-            getGroupNumber();
+    std::vector<char> buffer;
+    auto setLine = [&]() {
+        m_DataIt = buffer.begin();
+        m_DataItEnd = buffer.end();
+        mEnd = buffer.data() + buffer.size();
+    };
+
+    // Free-form sections can hide any statement, leave those files to the serial parser
+    bool insideCstype = false;
+    for (const Chunk &chunk : chunks) {
+        if (chunk.hasFreeForm) {
+            ASSIMP_LOG_INFO("OBJ: Free-form geometry found, parsing the file serially");
+            chunks.clear();
+            for (const char *pos = data; pos < data + size;) {
+                pos = getDataLine(pos, data + size, buffer);
+                setLine();
+                parseLine(insideCstype);
+            }
+            m_progress->UpdateFileRead(static_cast<unsigned int>(size), static_cast<unsigned int>(size));
+            return;
+        }
+    }
+
+    // Merge the vertex data of all chunks
+    size_t numVertices = 0, numNormals = 0, numTexCoords = 0;
+    bool hasVertexColors = false;
+    for (const Chunk &chunk : chunks) {
+        numVertices += chunk.vertices.size();
+        numNormals += chunk.normals.size();
+        numTexCoords += chunk.texCoords.size();
+        hasVertexColors = hasVertexColors || !chunk.vertexColors.empty();
+    }
+    m_pModel->mVertices.reserve(numVertices);
+    m_pModel->mNormals.reserve(numNormals);
+    m_pModel->mTextureCoord.reserve(numTexCoords);
+    if (hasVertexColors) {
+        m_pModel->mVertexColors.reserve(numVertices);
+    }
+    for (Chunk &chunk : chunks) {
+        m_pModel->mVertices.insert(m_pModel->mVertices.end(), chunk.vertices.begin(), chunk.vertices.end());
+        m_pModel->mNormals.insert(m_pModel->mNormals.end(), chunk.normals.begin(), chunk.normals.end());
+        m_pModel->mTextureCoord.insert(m_pModel->mTextureCoord.end(), chunk.texCoords.begin(), chunk.texCoords.end());
+        if (hasVertexColors) {
+            // vertices without a color get the default color, as in a serial run
+            chunk.vertexColors.resize(chunk.vertices.size(), aiVector3D(0, 0, 0));
+            m_pModel->mVertexColors.insert(m_pModel->mVertexColors.end(), chunk.vertexColors.begin(), chunk.vertexColors.end());
+        }
+        m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, chunk.texCoordDim);
+        std::vector<aiVector3D>().swap(chunk.vertexColors);
+    }
+
+    // Replay faces and all other statements in file order
+    size_t vertexBase = 0, normalBase = 0, texCoordBase = 0;
+    for (Chunk &chunk : chunks) {
+        for (const Chunk::Record &record : chunk.records) {
+            if (record.type != 0) {
+                storeFace(static_cast<aiPrimitiveType>(record.type), chunk.tokens.data() + record.firstToken, record.numTokens,
+                        vertexBase + record.numVertices, texCoordBase + record.numTexCoords, normalBase + record.numNormals,
+                        record.separatorInPoint);
+            } else {
+                getDataLine(data + record.lineOffset, data + chunk.end, buffer);
+                setLine();
+                parseLine(insideCstype);
+            }
+        }
+
+        vertexBase += chunk.vertices.size();
+        normalBase += chunk.normals.size();
+        texCoordBase += chunk.texCoords.size();
+        chunk = Chunk();
+    }
+    m_progress->UpdateFileRead(static_cast<unsigned int>(size), static_cast<unsigned int>(size));
+}
+
+void ObjFileParser::parseChunk(const char *data, Chunk &chunk) {
+    std::vector<char> buffer;
+    const char *end = data + chunk.end;
+    for (const char *pos = data + chunk.begin; pos < end;) {
+        const size_t lineOffset = static_cast<size_t>(pos - data);
+        pos = getDataLine(pos, end, buffer);
+        m_DataIt = buffer.begin();
+        m_DataItEnd = buffer.end();
+        mEnd = buffer.data() + buffer.size();
+
+        switch (*m_DataIt) {
+        case 'v': {
+            getVertexData();
         } break;
 
-        case 'o': // Parse object name
-        {
-            getObjectName();
+        case 'p':
+        case 'l':
+        case 'f': {
+            const aiPrimitiveType type = *m_DataIt == 'f' ? aiPrimitiveType_POLYGON : (*m_DataIt == 'l' ? aiPrimitiveType_LINE : aiPrimitiveType_POINT);
+            m_DataIt = getNextToken<DataArrayIt>(m_DataIt, m_DataItEnd);
+            if (m_DataIt == m_DataItEnd || *m_DataIt == '\0') {
+                break;
+            }
+
+            Chunk::Record record = {};
+            record.lineOffset = lineOffset;
+            record.type = type;
+            record.firstToken = static_cast<unsigned int>(chunk.tokens.size());
+            const char *begin = &(*m_DataIt);
+            tokenizeFace(begin, begin + (m_DataItEnd - m_DataIt), type, chunk.tokens, record.separatorInPoint);
+            record.numTokens = static_cast<unsigned int>(chunk.tokens.size()) - record.firstToken;
+            record.numVertices = static_cast<unsigned int>(m_pModel->mVertices.size());
+            record.numTexCoords = static_cast<unsigned int>(m_pModel->mTextureCoord.size());
+            record.numNormals = static_cast<unsigned int>(m_pModel->mNormals.size());
+            chunk.records.push_back(record);
         } break;
 
-        case 'c': // handle cstype section start
-        {
+        case '#': // comments and smoothing groups carry no data
+        case 's':
+            break;
+
+        case 'c': {
             std::string name;
             getNameNoSpace(m_DataIt, m_DataItEnd, name);
-            insideCstype = name == "cstype";
-            goto pf_skip_line;
-        }
+            if (name == "cstype") {
+                chunk.hasFreeForm = true;
+                return;
+            }
+        } break;
 
         default: {
-        pf_skip_line:
-            m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+            if (!IsLineEnd(*m_DataIt)) {
+                Chunk::Record record = {};
+                record.lineOffset = lineOffset;
+                chunk.records.push_back(record);
+            }
         } break;
         }
     }
+
+    chunk.vertices.swap(m_pModel->mVertices);
+    chunk.vertexColors.swap(m_pModel->mVertexColors);
+    chunk.normals.swap(m_pModel->mNormals);
+    chunk.texCoords.swap(m_pModel->mTextureCoord);
+    chunk.texCoordDim = m_pModel->mTextureCoordDim;
 }
 
 void ObjFileParser::copyNextWord(char *pBuffer, size_t length) {
@@ -432,111 +692,170 @@ void ObjFileParser::getVector2(std::vector<aiVector2D> &point2d_array) {
 
 static constexpr char DefaultObjName[] = "defaultobject";
 
+void ObjFileParser::getVertexData() {
+    ++m_DataIt;
+    if (*m_DataIt == ' ' || *m_DataIt == '\t') {
+        size_t numComponents = getNumComponentsInDataDefinition();
+        if (numComponents == 3) {
+            // read in vertex definition
+            getVector3(m_pModel->mVertices);
+        } else if (numComponents == 4) {
+            // read in vertex definition (homogeneous coords)
+            getHomogeneousVector3(m_pModel->mVertices);
+        } else if (numComponents == 6) {
+            // fill previous omitted vertex-colors by default
+            if (m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
+                m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
+            }
+            // read vertex and vertex-color
+            getTwoVectors3(m_pModel->mVertices, m_pModel->mVertexColors);
+        }
+        // append omitted vertex-colors as default for the end if any vertex-color exists
+        if (!m_pModel->mVertexColors.empty() && m_pModel->mVertexColors.size() < m_pModel->mVertices.size()) {
+            m_pModel->mVertexColors.resize(m_pModel->mVertices.size(), aiVector3D(0, 0, 0));
+        }
+    } else if (*m_DataIt == 't') {
+        // read in texture coordinate ( 2D or 3D )
+        ++m_DataIt;
+        size_t dim = getTexCoordVector(m_pModel->mTextureCoord);
+        m_pModel->mTextureCoordDim = std::max(m_pModel->mTextureCoordDim, (unsigned int)dim);
+    } else if (*m_DataIt == 'n') {
+        // Read in normal vector definition
+        ++m_DataIt;
+        getVector3(m_pModel->mNormals);
+    }
+}
+
 void ObjFileParser::getFace(aiPrimitiveType type) {
     m_DataIt = getNextToken<DataArrayIt>(m_DataIt, m_DataItEnd);
     if (m_DataIt == m_DataItEnd || *m_DataIt == '\0') {
         return;
     }
 
-    ObjFile::Face *face = new ObjFile::Face(type);
-    bool hasNormal = false;
-
-    const int vSize = static_cast<unsigned int>(m_pModel->mVertices.size());
-    const int vtSize = static_cast<unsigned int>(m_pModel->mTextureCoord.size());
-    const int vnSize = static_cast<unsigned int>(m_pModel->mNormals.size());
+    const char *begin = &(*m_DataIt);
+    bool separatorInPoint = false;
+    m_faceTokens.clear();
+    tokenizeFace(begin, begin + (m_DataItEnd - m_DataIt), type, m_faceTokens, separatorInPoint);
+    storeFace(type, m_faceTokens.data(), m_faceTokens.size(), m_pModel->mVertices.size(),
+            m_pModel->mTextureCoord.size(), m_pModel->mNormals.size(), separatorInPoint);
 
-    const bool vt = (!m_pModel->mTextureCoord.empty());
-    const bool vn = (!m_pModel->mNormals.empty());
-    int iPos = 0;
-    while (m_DataIt < m_DataItEnd) {
-        int iStep = 1;
+    // Skip the rest of the line
+    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
+}
 
-        if (IsLineEnd(*m_DataIt) || *m_DataIt == '#') {
+void ObjFileParser::tokenizeFace(const char *begin, const char *end, aiPrimitiveType type,
+        std::vector<FaceToken> &tokens, bool &separatorInPoint) {
+    unsigned int slot = 0;
+    bool vertexStart = true;
+    const char *it = begin;
+    while (it < end) {
+        if (IsLineEnd(*it) || *it == '#') {
             break;
         }
 
-        if (*m_DataIt == '/') {
+        if (*it == '/') {
             if (type == aiPrimitiveType_POINT) {
-                ASSIMP_LOG_ERROR("Obj: Separator unexpected in point statement");
+                separatorInPoint = true;
             }
-            iPos++;
-        } else if (IsSpaceOrNewLine(*m_DataIt)) {
-            iPos = 0;
+            ++slot;
+            ++it;
+        } else if (IsSpaceOrNewLine(*it)) {
+            slot = 0;
+            vertexStart = true;
+            ++it;
         } else {
             //OBJ USES 1 Base ARRAYS!!!!
-            int iVal;
-            auto end = m_DataIt;
-            // find either the buffer end or the '\0'
-            while (end < m_DataItEnd && *end != '\0')
-                ++end;
-            // avoid temporary string allocation if there is a zero
-            if (end != m_DataItEnd) {
-                iVal = ::atoi(&(*m_DataIt));
-            } else {
-                // otherwise make a zero terminated copy, which is safe to pass to atoi
-                std::string number(&(*m_DataIt), m_DataItEnd - m_DataIt);
-                iVal = ::atoi(number.c_str());
+            // anything which is not a number yields 0, which is rejected as invalid index
+            const char *start = it;
+            const bool negative = (*it == '-');
+            if (*it == '-' || *it == '+') {
+                ++it;
             }
-
-            // increment iStep position based off of the sign and # of digits
-            int tmp = iVal;
-            if (iVal < 0) {
-                ++iStep;
+            int value = 0;
+            while (it < end && *it >= '0' && *it <= '9') {
+                value = value * 10 + (*it - '0');
+                ++it;
             }
-            while ((tmp = tmp / 10) != 0) {
-                ++iStep;
+            if (it == start) {
+                ++it;
             }
+            tokens.push_back({ negative ? -value : value, slot, vertexStart });
+            vertexStart = false;
+        }
+    }
+}
 
-            if (iPos == 1 && !vt && vn) {
-                iPos = 2; // skip texture coords for normals if there are no tex coords
-            }
+void ObjFileParser::storeFace(aiPrimitiveType type, const FaceToken *tokens, size_t numTokens,
+        size_t numVertices, size_t numTexCoords, size_t numNormals, bool separatorInPoint) {
+    if (separatorInPoint) {
+        ASSIMP_LOG_ERROR("Obj: Separator unexpected in point statement");
+    }
+
+    m_faceVertices.clear();
+    m_faceNormals.clear();
+    m_faceTexCoords.clear();
+
+    const int vSize = static_cast<int>(numVertices);
+    const int vtSize = static_cast<int>(numTexCoords);
+    const int vnSize = static_cast<int>(numNormals);
+
+    const bool vt = (numTexCoords > 0);
+    const bool vn = (numNormals > 0);
+    unsigned int shift = 0;
+    for (size_t i = 0; i < numTokens; ++i) {
+        const FaceToken &token = tokens[i];
+        if (token.vertexStart) {
+            shift = 0;
+        }
+
+        unsigned int iPos = token.slot + shift;
+        if (iPos == 1 && !vt && vn) {
+            iPos = 2; // skip texture coords for normals if there are no tex coords
+            shift = 1;
+        }
+
+        const int iVal = token.value;
+        if (iPos > 2) {
+            reportErrorTokenInFace();
+            break;
+        }
 
-            if (iVal > 0) {
-                // Store parsed index
-                if (0 == iPos) {
-                    face->m_vertices.push_back(iVal - 1);
-                } else if (1 == iPos) {
-                    face->m_texturCoords.push_back(iVal - 1);
-                } else if (2 == iPos) {
-                    face->m_normals.push_back(iVal - 1);
-                    hasNormal = true;
-                } else {
-                    reportErrorTokenInFace();
-                }
-            } else if (iVal < 0) {
-                // Store relatively index
-                if (0 == iPos) {
-                    face->m_vertices.push_back(vSize + iVal);
-                } else if (1 == iPos) {
-                    face->m_texturCoords.push_back(vtSize + iVal);
-                } else if (2 == iPos) {
-                    face->m_normals.push_back(vnSize + iVal);
-                    hasNormal = true;
-                } else {
-                    reportErrorTokenInFace();
-                }
+        if (iVal > 0) {
+            // Store parsed index
+            if (0 == iPos) {
+                m_faceVertices.push_back(iVal - 1);
+            } else if (1 == iPos) {
+                m_faceTexCoords.push_back(iVal - 1);
+            } else {
+                m_faceNormals.push_back(iVal - 1);
+            }
+        } else if (iVal < 0) {
+            // Store relatively index
+            if (0 == iPos) {
+                m_faceVertices.push_back(vSize + iVal);
+            } else if (1 == iPos) {
+                m_faceTexCoords.push_back(vtSize + iVal);
             } else {
-                //On error, std::atoi will return 0 which is not a valid value
-                delete face;
-                throw DeadlyImportError("OBJ: Invalid face index.");
+                m_faceNormals.push_back(vnSize + iVal);
             }
+        } else {
+            //On error, std::atoi will return 0 which is not a valid value
+            throw DeadlyImportError("OBJ: Invalid face index.");
         }
-        m_DataIt += iStep;
     }
 
-    if (face->m_vertices.empty()) {
+    if (m_faceVertices.empty()) {
         ASSIMP_LOG_ERROR("Obj: Ignoring empty face");
-        // skip line and clean up
-        m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
-        delete face;
         return;
     }
 
+    ObjFile::Face face(type);
+
     // Set active material, if one set
     if (nullptr != m_pModel->mCurrentMaterial) {
-        face->m_pMaterial = m_pModel->mCurrentMaterial;
+        face.m_pMaterial = m_pModel->mCurrentMaterial;
     } else {
-        face->m_pMaterial = m_pModel->mDefaultMaterial;
+        face.m_pMaterial = m_pModel->mDefaultMaterial;
     }
 
     // Create a default object, if nothing is there
@@ -549,15 +868,24 @@ void ObjFileParser::getFace(aiPrimitiveType type) {
         createMesh(DefaultObjName);
     }
 
-    // Store the face
-    m_pModel->mCurrentMesh->m_Faces.emplace_back(face);
-    m_pModel->mCurrentMesh->m_uiNumIndices += static_cast<unsigned int>(face->m_vertices.size());
-    m_pModel->mCurrentMesh->m_uiUVCoordinates[0] += static_cast<unsigned int>(face->m_texturCoords.size());
-    if (!m_pModel->mCurrentMesh->m_hasNormals && hasNormal) {
-        m_pModel->mCurrentMesh->m_hasNormals = true;
+    // Store the face, its indices are appended to the index arrays of the mesh
+    ObjFile::Mesh *mesh = m_pModel->mCurrentMesh;
+    face.m_vertexOffset = static_cast<unsigned int>(mesh->m_vertexIndices.size());
+    face.m_numVertices = static_cast<unsigned int>(m_faceVertices.size());
+    face.m_normalOffset = static_cast<unsigned int>(mesh->m_normalIndices.size());
+    face.m_numNormals = static_cast<unsigned int>(m_faceNormals.size());
+    face.m_texCoordOffset = static_cast<unsigned int>(mesh->m_texCoordIndices.size());
+    face.m_numTexCoords = static_cast<unsigned int>(m_faceTexCoords.size());
+    mesh->m_vertexIndices.insert(mesh->m_vertexIndices.end(), m_faceVertices.begin(), m_faceVertices.end());
+    mesh->m_normalIndices.insert(mesh->m_normalIndices.end(), m_faceNormals.begin(), m_faceNormals.end());
+    mesh->m_texCoordIndices.insert(mesh->m_texCoordIndices.end(), m_faceTexCoords.begin(), m_faceTexCoords.end());
+    mesh->m_Faces.push_back(face);
+
+    mesh->m_uiNumIndices += face.m_numVertices;
+    mesh->m_uiUVCoordinates[0] += face.m_numTexCoords;
+    if (!mesh->m_hasNormals && face.m_numNormals > 0) {
+        mesh->m_hasNormals = true;
     }
-    // Skip the rest of the line
-    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
 }
 
 void ObjFileParser::getMaterialDesc() {
@@ -871,7 +1199,6 @@ bool ObjFileParser::needsNewMesh(const std::string &materialName) {
 // -------------------------------------------------------------------
 //  Shows an error in parsing process.
 void ObjFileParser::reportErrorTokenInFace() {
-    m_DataIt = skipLine<DataArrayIt>(m_DataIt, m_DataItEnd, m_uiLine);
     ASSIMP_LOG_ERROR("OBJ: Not supported token in face description detected");
 }
 
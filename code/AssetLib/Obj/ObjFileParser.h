@@ -75,6 +75,8 @@ public:
     ObjFileParser();
     /// @brief  Constructor with data array.
     ObjFileParser(IOStreamBuffer<char> &streamBuffer, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName);
+    /// @brief  Constructor with the complete file contents, which are parsed in chunks on several threads.
+    ObjFileParser(const char *data, size_t size, const std::string &modelName, IOSystem *io, ProgressHandler *progress, const std::string &originalObjFileName, unsigned int numThreads);
     /// @brief  Destructor
     ~ObjFileParser() = default;
     /// @brief  If you want to load in-core data.
@@ -86,8 +88,22 @@ public:
     ObjFileParser &operator=(const ObjFileParser& ) = delete;
 
 protected:
+    /// One index of a face statement, as it appears in the file
+    struct FaceToken {
+        /// The index, not yet resolved against the number of vertices
+        int value;
+        /// Number of '/' separators in front of the index, 0 for vertices
+        unsigned int slot;
+        /// True for the first index of a vertex
+        bool vertexStart;
+    };
+
     /// Parse the loaded file
     void parseFile(IOStreamBuffer<char> &streamBuffer);
+    /// Parse the complete file contents in chunks on several threads
+    void parseFileParallel(const char *data, size_t size, unsigned int numThreads);
+    /// Parse the line the data iterators point to.
+    void parseLine(bool &insideCstype);
     /// Method to copy the new delimited word in the current line.
     void copyNextWord(char *pBuffer, size_t length);
     /// Get the number of components in a line.
@@ -102,8 +118,16 @@ protected:
     void getTwoVectors3(std::vector<aiVector3D> &point3d_array_a, std::vector<aiVector3D> &point3d_array_b);
     /// Stores the following 3d vector.
     void getVector2(std::vector<aiVector2D> &point2d_array);
+    /// Stores the following vertex, texture coordinate or normal.
+    void getVertexData();
     /// Stores the following face.
     void getFace(aiPrimitiveType type);
+    /// Resolves the tokens of a face against the current element counts and stores the face.
+    void storeFace(aiPrimitiveType type, const FaceToken *tokens, size_t numTokens,
+            size_t numVertices, size_t numTexCoords, size_t numNormals, bool separatorInPoint);
+    /// Splits the indices of a face statement into tokens.
+    static void tokenizeFace(const char *begin, const char *end, aiPrimitiveType type,
+            std::vector<FaceToken> &tokens, bool &separatorInPoint);
     /// Reads the material description.
     void getMaterialDesc();
     /// Gets a comment.
@@ -132,6 +156,13 @@ protected:
     void reportErrorTokenInFace();
 
 private:
+    struct Chunk;
+
+    /// Creates the model instance and its default material.
+    void createModel(const std::string &modelName);
+    /// Parses the vertex data of a chunk and tokenizes its faces, runs on a worker thread.
+    void parseChunk(const char *data, Chunk &chunk);
+
     /// Default material name
     static constexpr const char DEFAULT_MATERIAL[] = AI_DEFAULT_MATERIAL_NAME;
     //! Iterator to current position in buffer
@@ -152,6 +183,12 @@ private:
     ProgressHandler *m_progress;
     /// Path to the current model, name of the obj file where the buffer comes from
     const std::string m_originalObjFileName;
+    /// Scratch index buffers of the face being parsed, reused for every face
+    std::vector<unsigned int> m_faceVertices;
+    std::vector<unsigned int> m_faceNormals;
+    std::vector<unsigned int> m_faceTexCoords;
+    /// Scratch token buffer of the face being parsed
+    std::vector<FaceToken> m_faceTokens;
 };
 
 } // Namespace Assimp
@@ -51,7 +51,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/importerdesc.h>
 #include <assimp/scene.h>
 #include <assimp/IOSystem.hpp>
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <type_traits>
 
 namespace Assimp {
 
@@ -672,6 +675,202 @@ void PLYImporter::LoadFace(const PLY::Element *pcElement, const PLY::ElementInst
     }
 }
 
+// ------------------------------------------------------------------------------------------------
+// Compiles the vertex element header into a decoding plan (the offset of each vertex component
+// within the fixed size record) and converts all records straight into the mesh arrays.
+bool PLYImporter::LoadVerticesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char *&pCur, unsigned int &bufferSize, const PLY::Element *pcElement, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+
+    // additional vertex elements are left to LoadVertex
+    if (0 == pcElement->NumOccur || (nullptr != mGeneratedMesh && nullptr != mGeneratedMesh->mVertices)) {
+        return false;
+    }
+
+    // one slot per vertex semantic, from EST_XCoord to EST_Alpha
+    static constexpr unsigned int NumSlots = EST_Alpha + 1;
+    ai_uint offsets[NumSlots];
+    PLY::EDataType types[NumSlots];
+    std::fill(offsets, offsets + NumSlots, NotSet);
+    std::fill(types, types + NumSlots, EDT_Char);
+
+    unsigned int stride = 0, cnt = 0;
+    for (const PLY::Property &prop : pcElement->alProperties) {
+        const unsigned int size = PLY::PropertyInstance::GetSizeBinary(prop.eType);
+        if (prop.bIsList || 0 == size) {
+            return false;
+        }
+        if (prop.Semantic < NumSlots) {
+            offsets[prop.Semantic] = stride;
+            types[prop.Semantic] = prop.eType;
+            ++cnt;
+        }
+        stride += size;
+    }
+    if (0 == cnt) {
+        return false;
+    }
+
+    const auto isSet = [&](unsigned int first, unsigned int num) {
+        return std::any_of(offsets + first, offsets + first + num, [](ai_uint offset) { return NotSet != offset; });
+    };
+    const auto isPackedFloat3 = [&](unsigned int first) {
+        return std::is_same<ai_real, float>::value && !p_bBE &&
+               EDT_Float == types[first] && EDT_Float == types[first + 1] && EDT_Float == types[first + 2] &&
+               NotSet != offsets[first] && offsets[first + 1] == offsets[first] + 4 && offsets[first + 2] == offsets[first] + 8;
+    };
+    const auto readReal = [&](const char *record, unsigned int slot) {
+        if (NotSet == offsets[slot]) {
+            return ai_real(0.0);
+        }
+        return PLY::PropertyInstance::ConvertTo<ai_real>(
+                PLY::PropertyInstance::DecodeValueBinary(record + offsets[slot], types[slot], p_bBE), types[slot]);
+    };
+    const auto readColor = [&](const char *record, unsigned int slot, ai_real def) {
+        if (NotSet == offsets[slot]) {
+            return def;
+        }
+        return NormalizeColorValue(PLY::PropertyInstance::DecodeValueBinary(record + offsets[slot], types[slot], p_bBE), types[slot]);
+    };
+
+    // create aiMesh if needed
+    if (nullptr == mGeneratedMesh) {
+        mGeneratedMesh = new aiMesh();
+        mGeneratedMesh->mMaterialIndex = 0;
+    }
+
+    const unsigned int numVertices = pcElement->NumOccur;
+    mGeneratedMesh->mNumVertices = numVertices;
+    aiVector3D *vertices = mGeneratedMesh->mVertices = new aiVector3D[numVertices];
+    aiVector3D *normals = nullptr;
+    if (isSet(EST_XNormal, 3)) {
+        normals = mGeneratedMesh->mNormals = new aiVector3D[numVertices];
+    }
+    aiColor4D *colors = nullptr;
+    if (isSet(EST_Red, 4)) {
+        colors = mGeneratedMesh->mColors[0] = new aiColor4D[numVertices];
+    }
+    aiVector3D *texCoords = nullptr;
+    if (isSet(EST_UTextureCoord, 2)) {
+        mGeneratedMesh->mNumUVComponents[0] = 2;
+        texCoords = mGeneratedMesh->mTextureCoords[0] = new aiVector3D[numVertices];
+    }
+
+    const bool packedPositions = isPackedFloat3(EST_XCoord);
+    const bool packedNormals = isPackedFloat3(EST_XNormal);
+    for (unsigned int i = 0; i < numVertices; ++i) {
+        PLY::PropertyInstance::FetchBinary(streamBuffer, buffer, pCur, bufferSize, stride);
+        const char *record = pCur;
+
+        if (packedPositions) {
+            memcpy(&vertices[i], record + offsets[EST_XCoord], sizeof(aiVector3D));
+        } else {
+            vertices[i].Set(readReal(record, EST_XCoord), readReal(record, EST_YCoord), readReal(record, EST_ZCoord));
+        }
+
+        if (packedNormals) {
+            memcpy(&normals[i], record + offsets[EST_XNormal], sizeof(aiVector3D));
+        } else if (nullptr != normals) {
+            normals[i].Set(readReal(record, EST_XNormal), readReal(record, EST_YNormal), readReal(record, EST_ZNormal));
+        }
+
+        if (nullptr != colors) {
+            // assume 1.0 for the alpha channel if it is not set
+            colors[i] = aiColor4D(readColor(record, EST_Red, 0.0), readColor(record, EST_Green, 0.0),
+                    readColor(record, EST_Blue, 0.0), readColor(record, EST_Alpha, 1.0));
+        }
+
+        if (nullptr != texCoords) {
+            texCoords[i].Set(readReal(record, EST_UTextureCoord), readReal(record, EST_VTextureCoord), 0);
+        }
+
+        pCur += stride;
+        bufferSize -= stride;
+    }
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Converts a face element with a single vertex index list straight into the face array. The
+// remaining properties of each record are skipped.
+bool PLYImporter::LoadFacesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char *&pCur, unsigned int &bufferSize, const PLY::Element *pcElement, bool p_bBE) {
+    ai_assert(nullptr != pcElement);
+
+    // errors and additional face elements are left to LoadFace
+    if (0 == pcElement->NumOccur || nullptr == mGeneratedMesh || nullptr != mGeneratedMesh->mFaces) {
+        return false;
+    }
+
+    // index of the vertex index list, per-face texture coordinates need the DOM
+    unsigned int iProperty = NotSet;
+    for (unsigned int a = 0; a < pcElement->alProperties.size(); ++a) {
+        const PLY::Property &prop = pcElement->alProperties[a];
+        if (0 == PLY::PropertyInstance::GetSizeBinary(prop.eType) ||
+                (prop.bIsList && 0 == PLY::PropertyInstance::GetSizeBinary(prop.eFirstType))) {
+            return false;
+        }
+        if (!prop.bIsList) {
+            continue;
+        }
+        if (PLY::EST_VertexIndex == prop.Semantic) {
+            iProperty = a;
+        } else if (PLY::EST_TextureCoordinates == prop.Semantic) {
+            return false;
+        }
+    }
+    if (NotSet == iProperty) {
+        return false;
+    }
+
+    mGeneratedMesh->mNumFaces = pcElement->NumOccur;
+    mGeneratedMesh->mFaces = new aiFace[mGeneratedMesh->mNumFaces];
+    for (unsigned int i = 0; i < mGeneratedMesh->mNumFaces; ++i) {
+        for (unsigned int a = 0; a < pcElement->alProperties.size(); ++a) {
+            const PLY::Property &prop = pcElement->alProperties[a];
+            const unsigned int size = PLY::PropertyInstance::GetSizeBinary(prop.eType);
+            if (!prop.bIsList) {
+                PLY::PropertyInstance::FetchBinary(streamBuffer, buffer, pCur, bufferSize, size);
+                pCur += size;
+                bufferSize -= size;
+                continue;
+            }
+
+            // parse the number of elements in the list
+            const unsigned int countSize = PLY::PropertyInstance::GetSizeBinary(prop.eFirstType);
+            PLY::PropertyInstance::FetchBinary(streamBuffer, buffer, pCur, bufferSize, countSize);
+            const unsigned int iNum = PLY::PropertyInstance::ConvertTo<unsigned int>(
+                    PLY::PropertyInstance::DecodeValueBinary(pCur, prop.eFirstType, p_bBE), prop.eFirstType);
+            pCur += countSize;
+            bufferSize -= countSize;
+
+            if (iNum > std::numeric_limits<unsigned int>::max() / size) {
+                throw DeadlyImportError("Invalid .ply file: List too long");
+            }
+            const unsigned int listSize = iNum * size;
+            PLY::PropertyInstance::FetchBinary(streamBuffer, buffer, pCur, bufferSize, listSize);
+            if (a == iProperty) {
+                aiFace &face = mGeneratedMesh->mFaces[i];
+                face.mNumIndices = iNum;
+                face.mIndices = new unsigned int[iNum];
+                if (!p_bBE && (EDT_Int == prop.eType || EDT_UInt == prop.eType)) {
+                    memcpy(face.mIndices, pCur, listSize);
+                } else {
+                    for (unsigned int b = 0; b < iNum; ++b) {
+                        face.mIndices[b] = PLY::PropertyInstance::ConvertTo<unsigned int>(
+                                PLY::PropertyInstance::DecodeValueBinary(pCur + b * size, prop.eType, p_bBE), prop.eType);
+                    }
+                }
+            }
+            pCur += listSize;
+            bufferSize -= listSize;
+        }
+    }
+
+    return true;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Get a RGBA color in [0...1] range
 void PLYImporter::GetMaterialColor(const std::vector<PLY::PropertyInstance> &avList,
@@ -84,6 +84,22 @@ public:
     */
     void LoadFace(const PLY::Element *pcElement, const PLY::ElementInstance *instElement, unsigned int pos);
 
+    // -------------------------------------------------------------------
+    /** Extract all vertices of a binary element straight from the file
+     *  buffer. Only elements with a fixed record size are handled.
+     *  @return false if the element needs to go through the DOM
+     */
+    bool LoadVerticesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+            const char *&pCur, unsigned int &bufferSize, const PLY::Element *pcElement, bool p_bBE);
+
+    // -------------------------------------------------------------------
+    /** Extract all faces of a binary element straight from the file
+     *  buffer. Only elements with a single vertex index list are handled.
+     *  @return false if the element needs to go through the DOM
+     */
+    bool LoadFacesBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+            const char *&pCur, unsigned int &bufferSize, const PLY::Element *pcElement, bool p_bBE);
+
 protected:
     // -------------------------------------------------------------------
     /** Return importer meta information.
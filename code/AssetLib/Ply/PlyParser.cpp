@@ -631,6 +631,17 @@ bool PLY::ElementInstanceList::ParseInstanceListBinary(
         bool p_bBE /* = false */) {
     ai_assert(nullptr != pcElement);
 
+    // common vertex and face layouts are decoded straight into the mesh,
+    // without building an ElementInstance for each of them
+    if (nullptr == p_pcOut && nullptr != loader) {
+        if (pcElement->eSemantic == EEST_Vertex && loader->LoadVerticesBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, p_bBE)) {
+            return true;
+        }
+        if (pcElement->eSemantic == EEST_Face && loader->LoadFacesBinary(streamBuffer, buffer, pCur, bufferSize, pcElement, p_bBE)) {
+            return true;
+        }
+    }
+
     // we can add special handling code for unknown element semantics since
     // we can't skip it as a whole block (we don't know its exact size
     // due to the fact that lists could be contained in the property list
@@ -858,137 +869,152 @@ bool PLY::PropertyInstance::ParseValueBinary(IOStreamBuffer<char> &streamBuffer,
     ai_assert(nullptr != out);
 
     // calc element size
-    unsigned int lsize = 0;
+    const unsigned int lsize = GetSizeBinary(eType);
+    if (0 == lsize) {
+        return false;
+    }
+
+    // read the next file block if needed
+    FetchBinary(streamBuffer, buffer, pCur, bufferSize, lsize);
+
+    *out = DecodeValueBinary(pCur, eType, p_bBE);
+    pCur += lsize;
+    bufferSize -= lsize;
+
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int PLY::PropertyInstance::GetSizeBinary(PLY::EDataType eType) {
     switch (eType) {
     case EDT_Char:
     case EDT_UChar:
-        lsize = 1;
-        break;
+        return 1;
 
     case EDT_UShort:
     case EDT_Short:
-        lsize = 2;
-        break;
+        return 2;
 
     case EDT_UInt:
     case EDT_Int:
     case EDT_Float:
-        lsize = 4;
-        break;
+        return 4;
 
     case EDT_Double:
-        lsize = 8;
-        break;
+        return 8;
 
     case EDT_INVALID:
     default:
         break;
     }
+    return 0;
+}
 
-    // read the next file block if needed
-    if (bufferSize < lsize) {
+// ------------------------------------------------------------------------------------------------
+void PLY::PropertyInstance::FetchBinary(IOStreamBuffer<char> &streamBuffer,
+        std::vector<char> &buffer,
+        const char *&pCur,
+        unsigned int &bufferSize,
+        unsigned int size) {
+    while (bufferSize < size) {
         std::vector<char> nbuffer;
-        if (streamBuffer.getNextBlock(nbuffer)) {
-            // concat buffer contents
-            buffer = std::vector<char>(buffer.end() - bufferSize, buffer.end());
-            buffer.insert(buffer.end(), nbuffer.begin(), nbuffer.end());
-            nbuffer.clear();
-            bufferSize = static_cast<unsigned int>(buffer.size());
-            pCur = (char *)&buffer[0];
-        } else {
+        if (!streamBuffer.getNextBlock(nbuffer)) {
             throw DeadlyImportError("Invalid .ply file: File corrupted");
         }
+
+        // concat buffer contents
+        buffer = std::vector<char>(buffer.end() - bufferSize, buffer.end());
+        buffer.insert(buffer.end(), nbuffer.begin(), nbuffer.end());
+        bufferSize = static_cast<unsigned int>(buffer.size());
+        pCur = (char *)&buffer[0];
     }
+}
+
+// ------------------------------------------------------------------------------------------------
+PLY::PropertyInstance::ValueUnion PLY::PropertyInstance::DecodeValueBinary(const char *pCur,
+        PLY::EDataType eType,
+        bool p_bBE) {
+    ValueUnion out;
+    out.iUInt = 0;
 
-    bool ret = true;
     switch (eType) {
     case EDT_UInt: {
         uint32_t t;
         memcpy(&t, pCur, sizeof(uint32_t));
-        pCur += sizeof(uint32_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iUInt = t;
+        out.iUInt = t;
         break;
     }
 
     case EDT_UShort: {
         uint16_t t;
         memcpy(&t, pCur, sizeof(uint16_t));
-        pCur += sizeof(uint16_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iUInt = t;
+        out.iUInt = t;
         break;
     }
 
     case EDT_UChar: {
         uint8_t t;
         memcpy(&t, pCur, sizeof(uint8_t));
-        pCur += sizeof(uint8_t);
-        out->iUInt = t;
+        out.iUInt = t;
         break;
     }
 
     case EDT_Int: {
         int32_t t;
         memcpy(&t, pCur, sizeof(int32_t));
-        pCur += sizeof(int32_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iInt = t;
+        out.iInt = t;
         break;
     }
 
     case EDT_Short: {
         int16_t t;
         memcpy(&t, pCur, sizeof(int16_t));
-        pCur += sizeof(int16_t);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->iInt = t;
+        out.iInt = t;
         break;
     }
 
     case EDT_Char: {
         int8_t t;
         memcpy(&t, pCur, sizeof(int8_t));
-        pCur += sizeof(int8_t);
-        out->iInt = t;
+        out.iInt = t;
         break;
     }
 
     case EDT_Float: {
         float t;
         memcpy(&t, pCur, sizeof(float));
-        pCur += sizeof(float);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->fFloat = t;
+        out.fFloat = t;
         break;
     }
     case EDT_Double: {
         double t;
         memcpy(&t, pCur, sizeof(double));
-        pCur += sizeof(double);
 
         // Swap endianness
         if (p_bBE) ByteSwap::Swap(&t);
-        out->fDouble = t;
+        out.fDouble = t;
         break;
     }
     default:
-        ret = false;
+        break;
     }
 
-    bufferSize -= lsize;
-
-    return ret;
+    return out;
 }
 
 } // namespace Assimp
@@ -345,6 +345,19 @@ public:
     static bool ParseValueBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
         const char* &pCur, unsigned int &bufferSize, EDataType eType, ValueUnion* out, bool p_bBE);
 
+    // -------------------------------------------------------------------
+    //! Get the size of a binary value in bytes, 0 for invalid types
+    static unsigned int GetSizeBinary(EDataType eType);
+
+    // -------------------------------------------------------------------
+    //! Make sure at least size bytes of binary data are available at pCur
+    static void FetchBinary(IOStreamBuffer<char> &streamBuffer, std::vector<char> &buffer,
+        const char* &pCur, unsigned int &bufferSize, unsigned int size);
+
+    // -------------------------------------------------------------------
+    //! Decode a binary value at pCur, the caller makes sure it is available
+    static ValueUnion DecodeValueBinary(const char* pCur, EDataType eType, bool p_bBE);
+
     // -------------------------------------------------------------------
     //! Convert a property value to a given type TYPE
     template <typename TYPE>
@@ -50,6 +50,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/IOSystem.hpp>
+#include <assimp/Importer.hpp>
+#include <cmath>
 #include <memory>
 
 namespace Assimp {
@@ -121,6 +123,207 @@ static bool IsAsciiSTL(const char *buffer, size_t fileSize) {
     }
     return isASCII;
 }
+
+// Decodes the 15 bit color of a binary facet, Materialise files store the channels reversed.
+static aiColor4D DecodeFacetColor(uint16_t color, bool materialise) {
+    const ai_real invVal((ai_real)1.0 / (ai_real)31.0);
+    const ai_real lo = (color & 0x1fu) * invVal;
+    const ai_real mid = ((color & (0x1fu << 5)) >> 5u) * invVal;
+    const ai_real hi = ((color & (0x1fu << 10)) >> 10u) * invVal;
+    return materialise ? aiColor4D(lo, mid, hi, 1.0) : aiColor4D(hi, mid, lo, 1.0);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Merges facet corners with the same position and attribute into one vertex while the facets are
+// decoded. The facet normals are dropped, one normal per facet would split the vertices again.
+// The vertices found so far are kept in an open addressing hash table. With an epsilon the
+// positions are hashed by grid cells twice the epsilon wide, so a close vertex is always in one
+// of the eight cells next to the corner.
+class VertexWelder {
+public:
+    VertexWelder(size_t numCorners, ai_real epsilon) :
+            mEpsilon(epsilon), mCellSize(static_cast<double>(epsilon) * 2.0) {
+        // closed meshes have about one vertex for six facet corners
+        const size_t expected = numCorners / 6 + 1;
+        mPositions.reserve(expected);
+        mAttributes.reserve(expected);
+        Rehash(expected + expected / 3);
+    }
+
+    unsigned int Add(const aiVector3D &position, uint32_t attribute) {
+        const unsigned int found = mEpsilon > 0 ? FindNear(position, attribute) : FindExact(position, attribute);
+        if (found != Empty) {
+            return found;
+        }
+
+        const unsigned int index = static_cast<unsigned int>(mPositions.size());
+        mPositions.push_back(position);
+        mAttributes.push_back(attribute);
+        if (mPositions.size() * 4 > mTable.size() * 3) {
+            Rehash(mTable.size() * 2);
+        } else {
+            Insert(index);
+        }
+        return index;
+    }
+
+    // Moves the vertices into the mesh and releases the hash table.
+    void ToMesh(aiMesh *mesh) {
+        std::vector<unsigned int>().swap(mTable);
+        mesh->mNumVertices = static_cast<unsigned int>(mPositions.size());
+        mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+        std::copy(mPositions.begin(), mPositions.end(), mesh->mVertices);
+        std::vector<aiVector3D>().swap(mPositions);
+    }
+
+    const std::vector<uint32_t> &GetAttributes() const {
+        return mAttributes;
+    }
+
+private:
+    static constexpr unsigned int Empty = ~0u;
+
+    static uint64_t Mix(uint64_t a, uint64_t b, uint64_t c, uint32_t attribute) {
+        uint64_t h = a * 0x9E3779B185EBCA87ull;
+        h ^= (b + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+        h ^= (c + 0x165667B19E3779F9ull) * 0x27D4EB2F165667C5ull;
+        h ^= attribute * 0x94D049BB133111EBull;
+        h ^= h >> 31;
+        h *= 0xBF58476D1CE4E5B9ull;
+        return h ^ (h >> 29);
+    }
+
+    static uint64_t Bits(ai_real value) {
+        // 0 and -0 are the same position
+        const ai_real v = value == 0 ? ai_real(0) : value;
+        uint64_t bits = 0;
+        ::memcpy(&bits, &v, sizeof(v));
+        return bits;
+    }
+
+    int64_t Cell(ai_real value) const {
+        const double c = std::floor(value / mCellSize);
+        return static_cast<int64_t>(std::max(-4.0e18, std::min(4.0e18, c)));
+    }
+
+    uint64_t Hash(const aiVector3D &p, uint32_t attribute) const {
+        if (mEpsilon > 0) {
+            return Mix(Cell(p.x), Cell(p.y), Cell(p.z), attribute);
+        }
+        return Mix(Bits(p.x), Bits(p.y), Bits(p.z), attribute);
+    }
+
+    unsigned int FindExact(const aiVector3D &p, uint32_t attribute) const {
+        for (size_t slot = Hash(p, attribute) & mMask;; slot = (slot + 1) & mMask) {
+            const unsigned int index = mTable[slot];
+            if (index == Empty || (mPositions[index] == p && mAttributes[index] == attribute)) {
+                return index;
+            }
+        }
+    }
+
+    unsigned int FindNear(const aiVector3D &p, uint32_t attribute) const {
+        const ai_real epsilonSquared = mEpsilon * mEpsilon;
+        int64_t cells[3][2];
+        for (int axis = 0; axis < 3; ++axis) {
+            const double scaled = p[axis] / mCellSize;
+            const int64_t cell = Cell(p[axis]);
+            cells[axis][0] = cell;
+            cells[axis][1] = scaled - std::floor(scaled) < 0.5 ? cell - 1 : cell + 1;
+        }
+        for (int n = 0; n < 8; ++n) {
+            const uint64_t hash = Mix(cells[0][n & 1], cells[1][(n >> 1) & 1], cells[2][(n >> 2) & 1], attribute);
+            for (size_t slot = hash & mMask;; slot = (slot + 1) & mMask) {
+                const unsigned int index = mTable[slot];
+                if (index == Empty) {
+                    break;
+                }
+                if (mAttributes[index] == attribute && (mPositions[index] - p).SquareLength() <= epsilonSquared) {
+                    return index;
+                }
+            }
+        }
+        return Empty;
+    }
+
+    void Insert(unsigned int index) {
+        size_t slot = Hash(mPositions[index], mAttributes[index]) & mMask;
+        while (mTable[slot] != Empty) {
+            slot = (slot + 1) & mMask;
+        }
+        mTable[slot] = index;
+    }
+
+    void Rehash(size_t minSize) {
+        size_t size = 16;
+        while (size < minSize) {
+            size <<= 1;
+        }
+        mTable.assign(size, Empty);
+        mMask = size - 1;
+        for (unsigned int i = 0; i < mPositions.size(); ++i) {
+            Insert(i);
+        }
+    }
+
+    const ai_real mEpsilon;
+    const double mCellSize;
+    std::vector<aiVector3D> mPositions;
+    std::vector<uint32_t> mAttributes;
+    std::vector<unsigned int> mTable;
+    size_t mMask = 0;
+};
+
+// Builds an indexed mesh from the corners of the facets read from an ASCII file.
+static void WeldCorners(aiMesh *pMesh, const std::vector<aiVector3D> &positions, ai_real epsilon) {
+    VertexWelder welder(positions.size(), epsilon);
+    pMesh->mNumFaces = static_cast<unsigned int>(positions.size() / 3);
+    pMesh->mFaces = new aiFace[pMesh->mNumFaces];
+    for (unsigned int i = 0, p = 0; i < pMesh->mNumFaces; ++i) {
+        aiFace &face = pMesh->mFaces[i];
+        face.mIndices = new unsigned int[face.mNumIndices = 3];
+        for (unsigned int o = 0; o < 3; ++o, ++p) {
+            face.mIndices[o] = welder.Add(positions[p], 0);
+        }
+    }
+    welder.ToMesh(pMesh);
+}
+
+// Builds an indexed mesh from the facets of a binary file, facets with different colors
+// do not share vertices.
+static bool WeldBinaryFacets(aiMesh *pMesh, const unsigned char *sz, bool materialise,
+        const aiColor4D &defaultColor, ai_real epsilon) {
+    VertexWelder welder(pMesh->mNumFaces * 3ull, epsilon);
+    bool hasColors = false;
+    pMesh->mFaces = new aiFace[pMesh->mNumFaces];
+    for (unsigned int i = 0; i < pMesh->mNumFaces; ++i, sz += 50) {
+        // normal and three corners, followed by the color. The normal is skipped.
+        aiVector3f v[4];
+        ::memcpy(v, sz, sizeof(v));
+        uint16_t color;
+        ::memcpy(&color, sz + sizeof(v), sizeof(color));
+        const uint32_t attribute = (color & (1u << 15)) ? color : 0u;
+        hasColors = hasColors || attribute != 0;
+
+        aiFace &face = pMesh->mFaces[i];
+        face.mIndices = new unsigned int[face.mNumIndices = 3];
+        for (unsigned int o = 0; o < 3; ++o) {
+            face.mIndices[o] = welder.Add(aiVector3D(v[o + 1].x, v[o + 1].y, v[o + 1].z), attribute);
+        }
+    }
+    welder.ToMesh(pMesh);
+
+    if (hasColors) {
+        ASSIMP_LOG_INFO("STL: Mesh has vertex colors");
+        const std::vector<uint32_t> &attributes = welder.GetAttributes();
+        pMesh->mColors[0] = new aiColor4D[pMesh->mNumVertices];
+        for (unsigned int j = 0; j < pMesh->mNumVertices; ++j) {
+            pMesh->mColors[0][j] = attributes[j] ? DecodeFacetColor(static_cast<uint16_t>(attributes[j]), materialise) : defaultColor;
+        }
+    }
+    return hasColors;
+}
+
 } // namespace
 
 // ------------------------------------------------------------------------------------------------
@@ -128,7 +331,9 @@ static bool IsAsciiSTL(const char *buffer, size_t fileSize) {
 STLImporter::STLImporter() :
         mBuffer(),
         mFileSize(0),
-        mScene() {
+        mScene(),
+        mWeldVertices(false),
+        mWeldEpsilon(0) {
     // empty
 }
 
@@ -143,6 +348,12 @@ bool STLImporter::CanRead(const std::string &pFile, IOSystem *pIOHandler, bool /
     return SearchFileHeaderForToken(pIOHandler, pFile, tokens, AI_COUNT_OF(tokens));
 }
 
+// ------------------------------------------------------------------------------------------------
+void STLImporter::SetupProperties(const Importer *pImp) {
+    mWeldVertices = pImp->GetPropertyBool(AI_CONFIG_IMPORT_STL_WELD_VERTICES, false);
+    mWeldEpsilon = std::max(ai_real(0), pImp->GetPropertyFloat(AI_CONFIG_IMPORT_STL_WELD_EPSILON, 0.0f));
+}
+
 // ------------------------------------------------------------------------------------------------
 const aiImporterDesc *STLImporter::GetInfo() const {
     return &desc;
@@ -172,13 +383,19 @@ void STLImporter::InternReadFile(const std::string &pFile, aiScene *pScene, IOSy
 
     mFileSize = file->FileSize();
 
-    // allocate storage and copy the contents of the file to a memory buffer
-    // (terminate it with zero)
+    // binary files are read in place if the stream keeps the file in memory,
+    // otherwise allocate storage and copy the contents of the file to a memory
+    // buffer (terminate it with zero)
     std::vector<char> buffer2;
-    TextFileToBuffer(file.get(), buffer2);
+    const char *mapped = reinterpret_cast<const char *>(file->GetMappedData());
+    if (mapped != nullptr && IsBinarySTL(mapped, mFileSize)) {
+        mBuffer = mapped;
+    } else {
+        TextFileToBuffer(file.get(), buffer2);
+        mBuffer = &buffer2[0];
+    }
 
     mScene = pScene;
-    mBuffer = &buffer2[0];
 
     // the default vertex color is light gray.
     mClrColorDefault.r = mClrColorDefault.g = mClrColorDefault.b = mClrColorDefault.a = 0.6f;
@@ -349,6 +566,13 @@ void STLImporter::LoadASCIIFile(aiNode *root) {
             throw DeadlyImportError("Normal buffer size does not match position buffer size");
         }
 
+        if (mWeldVertices && !positionBuffer.empty()) {
+            // build an indexed mesh right away
+            WeldCorners(pMesh, positionBuffer, mWeldEpsilon);
+            positionBuffer.clear();
+            normalBuffer.clear();
+        }
+
         // only process position buffer when filled, else exception when accessing with index operator
         // see line 353: only warning is triggered
         // see line 373(now): access to empty position buffer with index operator forced exception
@@ -374,8 +598,10 @@ void STLImporter::LoadASCIIFile(aiNode *root) {
             normalBuffer.clear();
         }
 
-        // now copy faces
-        addFacesToMesh(pMesh);
+        // now copy faces, a welded mesh has them already
+        if (nullptr == pMesh->mFaces) {
+            addFacesToMesh(pMesh);
+        }
 
         // assign the meshes to the current node
         pushMeshesToNode(meshIndices, node);
@@ -445,6 +671,12 @@ bool STLImporter::LoadBinaryFile() {
         throw DeadlyImportError("STL: file is empty. There are no facets defined");
     }
 
+    if (mWeldVertices) {
+        const bool hasColors = WeldBinaryFacets(pMesh, sz, bIsMaterialise, mClrColorDefault, mWeldEpsilon);
+        AddBinaryNode();
+        return bIsMaterialise && !hasColors;
+    }
+
     pMesh->mNumVertices = pMesh->mNumFaces * 3;
 
     aiVector3D *vp = pMesh->mVertices = new aiVector3D[pMesh->mNumVertices];
@@ -510,18 +742,7 @@ bool STLImporter::LoadBinaryFile() {
                 ASSIMP_LOG_INFO("STL: Mesh has vertex colors");
             }
             aiColor4D *clr = &pMesh->mColors[0][i * 3];
-            clr->a = 1.0;
-            const ai_real invVal((ai_real)1.0 / (ai_real)31.0);
-            if (bIsMaterialise) // this is reversed
-            {
-                clr->r = (color & 0x1fu) * invVal;
-                clr->g = ((color & (0x1fu << 5)) >> 5u) * invVal;
-                clr->b = ((color & (0x1fu << 10)) >> 10u) * invVal;
-            } else {
-                clr->b = (color & 0x1fu) * invVal;
-                clr->g = ((color & (0x1fu << 5)) >> 5u) * invVal;
-                clr->r = ((color & (0x1fu << 10)) >> 10u) * invVal;
-            }
+            *clr = DecodeFacetColor(color, bIsMaterialise);
             // assign the color to all vertices of the face
             *(clr + 1) = *clr;
             *(clr + 2) = *clr;
@@ -530,7 +751,18 @@ bool STLImporter::LoadBinaryFile() {
 
     // now copy faces
     addFacesToMesh(pMesh);
+    AddBinaryNode();
 
+    if (bIsMaterialise && !pMesh->mColors[0]) {
+        // use the color as diffuse material color
+        return true;
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Adds the single node holding the mesh of a binary file
+void STLImporter::AddBinaryNode() {
     aiNode *root = mScene->mRootNode;
 
     // allocate one node
@@ -547,12 +779,6 @@ bool STLImporter::LoadBinaryFile() {
     for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
         node->mMeshes[i] = i;
     }
-
-    if (bIsMaterialise && !pMesh->mColors[0]) {
-        // use the color as diffuse material color
-        return true;
-    }
-    return false;
 }
 
 void STLImporter::pushMeshesToNode(std::vector<unsigned int> &meshIndices, aiNode *node) {
@@ -83,6 +83,12 @@ protected:
      */
     const aiImporterDesc* GetInfo () const override;
 
+    /**
+     * @brief   Reads the vertex welding settings.
+     *  See #BaseImporter::SetupProperties for the details
+     */
+    void SetupProperties(const Importer* pImp) override;
+
     /**
      * @brief   Imports the given file into the given scene structure.
     * See BaseImporter::InternReadFile() for details
@@ -103,6 +109,11 @@ protected:
 
     void pushMeshesToNode( std::vector<unsigned int> &meshIndices, aiNode *node );
 
+    /**
+     * @brief   Adds the node holding the mesh of a binary .stl file
+     */
+    void AddBinaryNode();
+
 protected:
 
     /** Buffer to hold the loaded file */
@@ -116,6 +127,12 @@ protected:
 
     /** Default vertex color */
     aiColor4D mClrColorDefault;
+
+    /** Merge facet corners into shared vertices, see #AI_CONFIG_IMPORT_STL_WELD_VERTICES */
+    bool mWeldVertices;
+
+    /** Distance below which corners are merged, see #AI_CONFIG_IMPORT_STL_WELD_EPSILON */
+    ai_real mWeldEpsilon;
 };
 
 } // end of namespace Assimp
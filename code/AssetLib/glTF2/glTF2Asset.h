@@ -54,6 +54,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *   KHR_materials_ior full
  *   KHR_materials_emissive_strength full
  *   KHR_materials_anisotropy full
+ *   EXT_meshopt_compression full
+ *   KHR_mesh_quantization full
+ *   EXT_mesh_gpu_instancing full
  */
 #ifndef GLTF2ASSET_H_INC
 #define GLTF2ASSET_H_INC
@@ -68,6 +71,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 // clang-format off
@@ -120,6 +124,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/GltfMaterial.h>
 
 #include "AssetLib/glTFCommon/glTFCommon.h"
+#include "AssetLib/glTF2/glTF2Meshopt.h"
 
 namespace glTF2 {
 
@@ -457,6 +462,7 @@ public:
     size_t byteLength; //!< The length of the buffer in bytes. (default: 0)
     //std::string type; //!< XMLHttpRequest responseType (default: "arraybuffer")
     size_t capacity = 0; //!< The capacity of the buffer in bytes. (default: 0)
+    bool meshoptFallback = false; //!< The buffer has no data, EXT_meshopt_compression views decode into it. (default: false)
 
     Type type;
 
@@ -498,7 +504,9 @@ public:
 
     void Read(Value &obj, Asset &r);
 
-    bool LoadFromStream(IOStream &stream, size_t length = 0, size_t baseOffset = 0);
+    /// Loads the buffer contents from a stream. If the stream keeps the file in memory the
+    /// buffer references that memory and keeps the stream alive instead of copying it.
+    bool LoadFromStream(const std::shared_ptr<IOStream> &stream, size_t length = 0, size_t baseOffset = 0);
 
     /// \fn void EncodedRegion_Mark(const size_t pOffset, const size_t pEncodedData_Length, uint8_t* pDecodedData, const size_t pDecodedData_Length, const std::string& pID)
     /// Mark region of "bufferView" as encoded. When data is request from such region then "bufferView" use decoded data.
@@ -527,6 +535,9 @@ public:
     size_t AppendData(uint8_t *data, size_t length);
     void Grow(size_t amount);
 
+    /// Allocates zero initialized data of byteLength bytes for a buffer without data.
+    void AllocateData();
+
     uint8_t *GetPointer() { return mData.get(); }
 
     void MarkAsSpecial() { mIsSpecial = true; }
@@ -547,8 +558,23 @@ struct BufferView : public Object {
 
     BufferViewTarget target; //! The target that the WebGL buffer should be bound to.
 
+    //! Location of the EXT_meshopt_compression stream the view is decoded from (export only)
+    struct MeshoptCompression {
+        Ref<Buffer> buffer;
+        size_t byteOffset;
+        size_t byteLength;
+        size_t byteStride;
+        size_t count;
+        Meshopt::Mode mode;
+        Meshopt::Filter filter;
+    };
+    std::unique_ptr<MeshoptCompression> meshopt;
+
     void Read(Value &obj, Asset &r);
     uint8_t *GetPointerAndTailSize(size_t accOffset, size_t& outTailSize);
+
+private:
+    void DecodeMeshoptCompression(Value &ext, Asset &r);
 };
 
 //! A typed view into a BufferView. A BufferView contains raw binary data.
@@ -562,6 +588,7 @@ struct Accessor : public Object {
     ComponentType componentType; //!< The datatype of components in the attribute. (required)
     size_t count; //!< The number of attributes referenced by this accessor. (required)
     AttribType::Value type; //!< Specifies if the attribute is a scalar, vector, or matrix. (required)
+    bool normalized = false; //!< Whether integer values are mapped to [0, 1] or [-1, 1] when converted to float. (default: false)
     std::vector<double> max; //!< Maximum value of each component in this attribute.
     std::vector<double> min; //!< Minimum value of each component in this attribute.
     std::unique_ptr<Sparse> sparse;
@@ -942,6 +969,14 @@ struct Node : public Object {
 
     Ref<Node> parent; //!< This is not part of the glTF specification. Used as a helper.
 
+    //! Per instance transformations from EXT_mesh_gpu_instancing
+    struct Instancing {
+        Ref<Accessor> translation;
+        Ref<Accessor> rotation;
+        Ref<Accessor> scale;
+    };
+    Nullable<Instancing> instancing;
+
     Node() = default;
     void Read(Value &obj, Asset &r);
 };
@@ -1150,6 +1185,9 @@ public:
         bool KHR_draco_mesh_compression;
         bool FB_ngon_encoding;
         bool KHR_texture_basisu;
+        bool EXT_meshopt_compression;
+        bool KHR_mesh_quantization;
+        bool EXT_mesh_gpu_instancing;
 
         Extensions() :
                 KHR_materials_pbrSpecularGlossiness(false),
@@ -1166,7 +1204,10 @@ public:
                 KHR_materials_anisotropy(false),
                 KHR_draco_mesh_compression(false),
                 FB_ngon_encoding(false),
-                KHR_texture_basisu(false) {
+                KHR_texture_basisu(false),
+                EXT_meshopt_compression(false),
+                KHR_mesh_quantization(false),
+                EXT_mesh_gpu_instancing(false) {
             // empty
         }
     } extensionsUsed;
@@ -1175,8 +1216,14 @@ public:
     struct RequiredExtensions {
         bool KHR_draco_mesh_compression;
         bool KHR_texture_basisu;
+        bool EXT_meshopt_compression;
+        bool KHR_mesh_quantization;
 
-        RequiredExtensions() : KHR_draco_mesh_compression(false), KHR_texture_basisu(false) {
+        RequiredExtensions() :
+                KHR_draco_mesh_compression(false),
+                KHR_texture_basisu(false),
+                EXT_meshopt_compression(false),
+                KHR_mesh_quantization(false) {
             // empty
         }
     } extensionsRequired;
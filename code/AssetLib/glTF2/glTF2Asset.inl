@@ -580,6 +580,15 @@ inline void Buffer::Read(Value &obj, Asset &r) {
     size_t statedLength = MemberOrDefault<size_t>(obj, "byteLength", 0);
     byteLength = statedLength;
 
+    // The fallback buffer of EXT_meshopt_compression is not loaded, even if it has an uri.
+    // The compressed buffer views referencing it are decoded into it instead.
+    if (Value *meshoptExt = FindExtension(obj, "EXT_meshopt_compression")) {
+        if (MemberOrDefault(*meshoptExt, "fallback", false)) {
+            meshoptFallback = true;
+            return;
+        }
+    }
+
     Value *it = FindString(obj, "uri");
     if (!it) {
         if (statedLength > 0) {
@@ -614,11 +623,9 @@ inline void Buffer::Read(Value &obj, Asset &r) {
         if (byteLength > 0) {
             std::string dir = !r.mCurrentAssetDir.empty() ? (r.mCurrentAssetDir.back() == '/' ? r.mCurrentAssetDir : r.mCurrentAssetDir + '/') : "";
 
-            IOStream *file = r.OpenFile(dir + uri, "rb");
+            std::shared_ptr<IOStream> file(r.OpenFile(dir + uri, "rb"));
             if (file) {
-                bool ok = LoadFromStream(*file, byteLength);
-                delete file;
-
+                bool ok = LoadFromStream(file, byteLength);
                 if (!ok)
                     throw DeadlyImportError("GLTF: error while reading referenced file \"", uri, "\"");
             } else {
@@ -628,20 +635,29 @@ inline void Buffer::Read(Value &obj, Asset &r) {
     }
 }
 
-inline bool Buffer::LoadFromStream(IOStream &stream, size_t length, size_t baseOffset) {
-    byteLength = length ? length : stream.FileSize();
+inline bool Buffer::LoadFromStream(const std::shared_ptr<IOStream> &stream, size_t length, size_t baseOffset) {
+    const size_t fileSize = stream->FileSize();
+    byteLength = length ? length : fileSize;
 
-    if (byteLength > stream.FileSize()) {
+    if (byteLength > fileSize) {
         throw DeadlyImportError("GLTF: Invalid byteLength exceeds size of actual data.");
     }
 
+    // Reference the data in place if the stream keeps it in memory. Buffers read from
+    // files are never written to during import, decoded data goes into new buffers.
+    const uint8_t *mapped = stream->GetMappedData();
+    if (mapped != nullptr && baseOffset <= fileSize && byteLength <= fileSize - baseOffset) {
+        mData = std::shared_ptr<uint8_t>(stream, const_cast<uint8_t *>(mapped) + baseOffset);
+        return true;
+    }
+
     if (baseOffset) {
-        stream.Seek(baseOffset, aiOrigin_SET);
+        stream->Seek(baseOffset, aiOrigin_SET);
     }
 
     mData.reset(new uint8_t[byteLength], std::default_delete<uint8_t[]>());
 
-    if (stream.Read(mData.get(), byteLength, 1) != 1) {
+    if (stream->Read(mData.get(), byteLength, 1) != 1) {
         return false;
     }
     return true;
@@ -766,6 +782,15 @@ inline void Buffer::Grow(size_t amount) {
     byteLength += amount;
 }
 
+inline void Buffer::AllocateData() {
+    if (nullptr != mData) {
+        return;
+    }
+
+    mData.reset(new uint8_t[byteLength](), std::default_delete<uint8_t[]>());
+    capacity = byteLength;
+}
+
 //
 // struct BufferView
 //
@@ -786,6 +811,74 @@ inline void BufferView::Read(Value &obj, Asset &r) {
     if ((byteOffset + byteLength) > buffer->byteLength) {
         throw DeadlyImportError("GLTF: Buffer view with offset/length (", byteOffset, "/", byteLength, ") is out of range.");
     }
+
+    if (r.extensionsUsed.EXT_meshopt_compression) {
+        if (Value *meshoptExt = FindExtension(obj, "EXT_meshopt_compression")) {
+            DecodeMeshoptCompression(*meshoptExt, r);
+        }
+    }
+}
+
+inline void BufferView::DecodeMeshoptCompression(Value &ext, Asset &r) {
+    // If the view's buffer has data of its own it holds the uncompressed data already
+    if (!buffer->meshoptFallback) {
+        return;
+    }
+
+    Ref<Buffer> source;
+    if (Value *sourceVal = FindUInt(ext, "buffer")) {
+        source = r.buffers.Retrieve(sourceVal->GetUint());
+    }
+    if (!source || source->GetPointer() == nullptr) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression in ", id, " without valid buffer.");
+    }
+
+    const size_t sourceOffset = MemberOrDefault(ext, "byteOffset", size_t(0));
+    const size_t sourceLength = MemberOrDefault(ext, "byteLength", size_t(0));
+    const size_t stride = MemberOrDefault(ext, "byteStride", size_t(0));
+    const size_t count = MemberOrDefault(ext, "count", size_t(0));
+    if (sourceOffset > source->byteLength || sourceLength > source->byteLength - sourceOffset) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression in ", id, " with offset/length (", sourceOffset, "/", sourceLength, ") is out of range.");
+    }
+    if (stride == 0 || count > byteLength / stride) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression in ", id, " with count/stride (", count, "/", stride, ") exceeds the buffer view.");
+    }
+
+    const char *modeStr = "";
+    ReadMember(ext, "mode", modeStr);
+    const char *filterStr = "NONE";
+    ReadMember(ext, "filter", filterStr);
+
+    Meshopt::Filter filter = Meshopt::Filter_None;
+    if (strcmp(filterStr, "OCTAHEDRAL") == 0) {
+        filter = Meshopt::Filter_Octahedral;
+    } else if (strcmp(filterStr, "QUATERNION") == 0) {
+        filter = Meshopt::Filter_Quaternion;
+    } else if (strcmp(filterStr, "EXPONENTIAL") == 0) {
+        filter = Meshopt::Filter_Exponential;
+    } else if (strcmp(filterStr, "NONE") != 0) {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression in ", id, " with unknown filter ", filterStr);
+    }
+
+    buffer->AllocateData();
+    uint8_t *dst = buffer->GetPointer() + byteOffset;
+    const uint8_t *src = source->GetPointer() + sourceOffset;
+
+    bool ok = false;
+    if (strcmp(modeStr, "ATTRIBUTES") == 0) {
+        ok = Meshopt::DecodeVertexBuffer(dst, count, stride, src, sourceLength) &&
+             Meshopt::DecodeFilter(filter, dst, count, stride);
+    } else if (strcmp(modeStr, "TRIANGLES") == 0) {
+        ok = Meshopt::DecodeIndexBuffer(dst, count, stride, src, sourceLength);
+    } else if (strcmp(modeStr, "INDICES") == 0) {
+        ok = Meshopt::DecodeIndexSequence(dst, count, stride, src, sourceLength);
+    } else {
+        throw DeadlyImportError("GLTF: EXT_meshopt_compression in ", id, " with unknown mode ", modeStr);
+    }
+
+    if (!ok) {
+        throw DeadlyImportError("GLTF: Unable to decode EXT_meshopt_compression data of ", id);
+    }
 }
 
 inline uint8_t *BufferView::GetPointerAndTailSize(size_t accOffset, size_t& outTailSize) {
@@ -893,6 +986,7 @@ inline void Accessor::Read(Value &obj, Asset &r) {
 
     const char *typestr;
     type = ReadMember(obj, "type", typestr) ? AttribType::FromString(typestr) : AttribType::SCALAR;
+    normalized = MemberOrDefault(obj, "normalized", false);
 
     if (bufferView) {
         // Check length
@@ -1015,6 +1109,45 @@ inline size_t Accessor::GetMaxByteSize() {
     return (bufferView ? bufferView->byteLength : sparse->data.size());
 }
 
+// Converts an integer component to float as allowed by KHR_mesh_quantization, normalized
+// components are mapped to [0, 1] or [-1, 1].
+template <class Scalar>
+inline Scalar DequantizeComponent(const uint8_t *src, ComponentType type, bool normalized) {
+    switch (type) {
+    case ComponentType_BYTE: {
+        int8_t v;
+        memcpy(&v, src, sizeof(v));
+        return normalized ? std::max(Scalar(v) / Scalar(127), Scalar(-1)) : Scalar(v);
+    }
+    case ComponentType_UNSIGNED_BYTE: {
+        uint8_t v;
+        memcpy(&v, src, sizeof(v));
+        return normalized ? Scalar(v) / Scalar(255) : Scalar(v);
+    }
+    case ComponentType_SHORT: {
+        int16_t v;
+        memcpy(&v, src, sizeof(v));
+        return normalized ? std::max(Scalar(v) / Scalar(32767), Scalar(-1)) : Scalar(v);
+    }
+    case ComponentType_UNSIGNED_SHORT: {
+        uint16_t v;
+        memcpy(&v, src, sizeof(v));
+        return normalized ? Scalar(v) / Scalar(65535) : Scalar(v);
+    }
+    case ComponentType_UNSIGNED_INT: {
+        uint32_t v;
+        memcpy(&v, src, sizeof(v));
+        return Scalar(v);
+    }
+    case ComponentType_FLOAT:
+    default: {
+        float v;
+        memcpy(&v, src, sizeof(v));
+        return Scalar(v);
+    }
+    }
+}
+
 template <class T>
 size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remappingIndices) {
     uint8_t *data = GetPointer();
@@ -1036,6 +1169,25 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
 
     const size_t maxSize = GetMaxByteSize();
 
+    // Integer data extracted into elements made of floating point values, e.g. aiVector3D, is
+    // dequantized (KHR_mesh_quantization). Element types of integers are copied as they are.
+    using Scalar = typename std::conditional<std::is_floating_point<T>::value, T, ai_real>::type;
+    const unsigned int numComponents = GetNumComponents();
+    const unsigned int bytesPerComponent = GetBytesPerComponent();
+    const bool dequantize = componentType != ComponentType_FLOAT &&
+            (std::is_floating_point<T>::value || std::is_class<T>::value) &&
+            targetElemSize % sizeof(Scalar) == 0 && targetElemSize >= numComponents * sizeof(Scalar);
+    const auto copyElement = [&](T *dst, const uint8_t *src) {
+        if (dequantize) {
+            Scalar *out = reinterpret_cast<Scalar *>(dst);
+            for (unsigned int c = 0; c < numComponents; ++c) {
+                out[c] = DequantizeComponent<Scalar>(src + c * bytesPerComponent, componentType, normalized);
+            }
+        } else {
+            memcpy(dst, src, elemSize);
+        }
+    };
+
     outData = new T[usedCount];
 
     if (remappingIndices != nullptr) {
@@ -1045,17 +1197,17 @@ size_t Accessor::ExtractData(T *&outData, const std::vector<unsigned int> *remap
             if (srcIdx >= maxIndexCount) {
                 throw DeadlyImportError("GLTF: index*stride ", (srcIdx * stride), " > maxSize ", maxSize, " in ", getContextForErrorMessages(id, name));
             }
-            memcpy(outData + i, data + srcIdx * stride, elemSize);
+            copyElement(outData + i, data + srcIdx * stride);
         }
     } else { // non-indexed cases
         if (usedCount * stride > maxSize) {
             throw DeadlyImportError("GLTF: count*stride ", (usedCount * stride), " > maxSize ", maxSize, " in ", getContextForErrorMessages(id, name));
         }
-        if (stride == elemSize && targetElemSize == elemSize) {
+        if (!dequantize && stride == elemSize && targetElemSize == elemSize) {
             memcpy(outData, data, totalSize);
         } else {
             for (size_t i = 0; i < usedCount; ++i) {
-                memcpy(outData + i, data + i * stride, elemSize);
+                copyElement(outData + i, data + i * stride);
             }
         }
     }
@@ -1788,6 +1940,22 @@ inline void Node::Read(Value &obj, Asset &r) {
                 }
             }
         }
+        if (r.extensionsUsed.EXT_mesh_gpu_instancing) {
+            if (Value *ext = FindObject(*curExtensions, "EXT_mesh_gpu_instancing")) {
+                if (Value *attributes = FindObject(*ext, "attributes")) {
+                    if (Value *translation = FindUInt(*attributes, "TRANSLATION")) {
+                        instancing.value.translation = r.accessors.Retrieve(translation->GetUint());
+                    }
+                    if (Value *rotation = FindUInt(*attributes, "ROTATION")) {
+                        instancing.value.rotation = r.accessors.Retrieve(rotation->GetUint());
+                    }
+                    if (Value *scale = FindUInt(*attributes, "SCALE")) {
+                        instancing.value.scale = r.accessors.Retrieve(scale->GetUint());
+                    }
+                    instancing.isPresent = instancing.value.translation || instancing.value.rotation || instancing.value.scale;
+                }
+            }
+        }
     }
 }
 
@@ -2053,7 +2221,7 @@ inline void Asset::Load(const std::string &pFile, bool isBinary)
 
     // Fill the buffer instance for the current file embedded contents
     if (mBodyLength > 0) {
-        if (!mBodyBuffer->LoadFromStream(*stream, mBodyLength, mBodyOffset)) {
+        if (!mBodyBuffer->LoadFromStream(stream, mBodyLength, mBodyOffset)) {
             throw DeadlyImportError("GLTF: Unable to read gltf file");
         }
     }
@@ -2157,6 +2325,8 @@ inline void Asset::ReadExtensionsRequired(Document &doc) {
 
     CHECK_REQUIRED_EXT(KHR_draco_mesh_compression);
     CHECK_REQUIRED_EXT(KHR_texture_basisu);
+    CHECK_REQUIRED_EXT(EXT_meshopt_compression);
+    CHECK_REQUIRED_EXT(KHR_mesh_quantization);
 
 #undef CHECK_REQUIRED_EXT
 }
@@ -2187,6 +2357,9 @@ inline void Asset::ReadExtensionsUsed(Document &doc) {
     CHECK_EXT(KHR_materials_anisotropy);
     CHECK_EXT(KHR_draco_mesh_compression);
     CHECK_EXT(KHR_texture_basisu);
+    CHECK_EXT(EXT_meshopt_compression);
+    CHECK_EXT(KHR_mesh_quantization);
+    CHECK_EXT(EXT_mesh_gpu_instancing);
 
 #undef CHECK_EXT
 }
@@ -115,6 +115,9 @@ namespace glTF2 {
         obj.AddMember("componentType", int(a.componentType), w.mAl);
         obj.AddMember("count", (unsigned int)a.count, w.mAl);
         obj.AddMember("type", StringRef(AttribType::ToString(a.type)), w.mAl);
+        if (a.normalized) {
+            obj.AddMember("normalized", true, w.mAl);
+        }
         Value vTmpMax, vTmpMin;
         if (a.componentType == ComponentType_FLOAT) {
             obj.AddMember("max", MakeValue(vTmpMax, a.max, w.mAl), w.mAl);
@@ -221,6 +224,19 @@ namespace glTF2 {
     {
         obj.AddMember("byteLength", static_cast<uint64_t>(b.byteLength), w.mAl);
 
+        if (b.meshoptFallback) {
+            // the data only exists in decoded form, so there is nothing to point to
+            Value fallback;
+            fallback.SetObject();
+            fallback.AddMember("fallback", true, w.mAl);
+
+            Value exts;
+            exts.SetObject();
+            exts.AddMember("EXT_meshopt_compression", fallback, w.mAl);
+            obj.AddMember("extensions", exts, w.mAl);
+            return;
+        }
+
         const auto uri = b.GetURI();
         const auto relativeUri = uri.substr(uri.find_last_of("/\\") + 1u);
         obj.AddMember("uri", Value(relativeUri, w.mAl).Move(), w.mAl);
@@ -237,6 +253,28 @@ namespace glTF2 {
         if (bv.target != BufferViewTarget_NONE) {
             obj.AddMember("target", int(bv.target), w.mAl);
         }
+
+        if (bv.meshopt) {
+            static const char *modes[] = { "ATTRIBUTES", "TRIANGLES", "INDICES" };
+            static const char *filters[] = { "NONE", "OCTAHEDRAL", "QUATERNION", "EXPONENTIAL" };
+
+            Value meshopt;
+            meshopt.SetObject();
+            meshopt.AddMember("buffer", bv.meshopt->buffer->index, w.mAl);
+            meshopt.AddMember("byteOffset", static_cast<uint64_t>(bv.meshopt->byteOffset), w.mAl);
+            meshopt.AddMember("byteLength", static_cast<uint64_t>(bv.meshopt->byteLength), w.mAl);
+            meshopt.AddMember("byteStride", static_cast<uint64_t>(bv.meshopt->byteStride), w.mAl);
+            meshopt.AddMember("count", static_cast<uint64_t>(bv.meshopt->count), w.mAl);
+            meshopt.AddMember("mode", StringRef(modes[bv.meshopt->mode]), w.mAl);
+            if (bv.meshopt->filter != Meshopt::Filter_None) {
+                meshopt.AddMember("filter", StringRef(filters[bv.meshopt->filter]), w.mAl);
+            }
+
+            Value exts;
+            exts.SetObject();
+            exts.AddMember("EXT_meshopt_compression", meshopt, w.mAl);
+            obj.AddMember("extensions", exts, w.mAl);
+        }
     }
 
     inline void Write(Value& /*obj*/, Camera& /*c*/, AssetWriter& /*w*/)
@@ -750,6 +788,29 @@ namespace glTF2 {
             AddRefsVector(obj, "skeletons", n.skeletons, w.mAl);
         }
 
+        if (n.instancing.isPresent) {
+            Value attributes;
+            attributes.SetObject();
+            if (n.instancing.value.translation) {
+                attributes.AddMember("TRANSLATION", n.instancing.value.translation->index, w.mAl);
+            }
+            if (n.instancing.value.rotation) {
+                attributes.AddMember("ROTATION", n.instancing.value.rotation->index, w.mAl);
+            }
+            if (n.instancing.value.scale) {
+                attributes.AddMember("SCALE", n.instancing.value.scale->index, w.mAl);
+            }
+
+            Value instancing;
+            instancing.SetObject();
+            instancing.AddMember("attributes", attributes, w.mAl);
+
+            Value exts;
+            exts.SetObject();
+            exts.AddMember("EXT_mesh_gpu_instancing", instancing, w.mAl);
+            obj.AddMember("extensions", exts, w.mAl);
+        }
+
         WriteExtras(obj, n.extras, w);
     }
 
@@ -871,6 +932,9 @@ namespace glTF2 {
         // Write buffer data to separate .bin files
         for (unsigned int i = 0; i < mAsset.buffers.Size(); ++i) {
             Ref<Buffer> b = mAsset.buffers.Get(i);
+            if (b->meshoptFallback) {
+                continue;
+            }
 
             std::string binPath = b->GetURI();
 
@@ -901,7 +965,13 @@ namespace glTF2 {
             rapidjson::Value glbBodyBuffer;
             glbBodyBuffer.SetObject();
             glbBodyBuffer.AddMember("byteLength", static_cast<uint64_t>(bodyBuffer->byteLength), mAl);
-            mDoc["buffers"].PushBack(glbBodyBuffer, mAl);
+
+            // the body buffer keeps its index when other buffers (e.g. meshopt fallbacks) follow it
+            Value &buffers = mDoc["buffers"];
+            buffers.PushBack(glbBodyBuffer, mAl);
+            for (rapidjson::SizeType i = buffers.Size() - 1; i > static_cast<rapidjson::SizeType>(bodyBuffer->index); --i) {
+                buffers[i].Swap(buffers[i - 1]);
+            }
         }
 
         // Padding with spaces as required by the spec
@@ -1049,6 +1119,18 @@ namespace glTF2 {
             if (this->mAsset.extensionsUsed.KHR_texture_basisu) {
                 exts.PushBack(StringRef("KHR_texture_basisu"), mAl);
             }
+
+            if (this->mAsset.extensionsUsed.EXT_meshopt_compression) {
+                exts.PushBack(StringRef("EXT_meshopt_compression"), mAl);
+            }
+
+            if (this->mAsset.extensionsUsed.KHR_mesh_quantization) {
+                exts.PushBack(StringRef("KHR_mesh_quantization"), mAl);
+            }
+
+            if (this->mAsset.extensionsUsed.EXT_mesh_gpu_instancing) {
+                exts.PushBack(StringRef("EXT_mesh_gpu_instancing"), mAl);
+            }
         }
 
         if (!exts.Empty())
@@ -1059,6 +1141,14 @@ namespace glTF2 {
         extsReq.SetArray();
         if (this->mAsset.extensionsUsed.KHR_texture_basisu) {
             extsReq.PushBack(StringRef("KHR_texture_basisu"), mAl);
+        }
+        if (this->mAsset.extensionsRequired.EXT_meshopt_compression) {
+            extsReq.PushBack(StringRef("EXT_meshopt_compression"), mAl);
+        }
+        if (this->mAsset.extensionsRequired.KHR_mesh_quantization) {
+            extsReq.PushBack(StringRef("KHR_mesh_quantization"), mAl);
+        }
+        if (!extsReq.Empty()) {
             mDoc.AddMember("extensionsRequired", extsReq, mAl);
         }
     }
@@ -88,7 +88,8 @@ void ExportSceneGLB2(const char *pFile, IOSystem *pIOSystem, const aiScene *pSce
 
 glTF2Exporter::glTF2Exporter(const char *filename, IOSystem *pIOSystem, const aiScene *pScene,
         const ExportProperties *pProperties, bool isBinary) :
-        mFilename(filename), mIOSystem(pIOSystem), mScene(pScene), mProperties(pProperties), mAsset(new Asset(pIOSystem)) {
+        mFilename(filename), mIOSystem(pIOSystem), mScene(pScene), mProperties(pProperties), mAsset(new Asset(pIOSystem)),
+        mMergeInstances(false) {
     // Always on as our triangulation process is aware of this type of encoding
     mAsset->extensionsUsed.FB_ngon_encoding = true;
 
@@ -104,12 +105,34 @@ glTF2Exporter::glTF2Exporter(const char *filename, IOSystem *pIOSystem, const ai
 
     ExportMaterials();
 
+    mMergeInstances = mProperties->GetPropertyBool(AI_CONFIG_EXPORT_GLTF_GPU_INSTANCING, false);
+    if (mMergeInstances) {
+        // nodes which are looked up by name must stay nodes of their own
+        for (unsigned int i = 0; i < mScene->mNumAnimations; ++i) {
+            for (unsigned int j = 0; j < mScene->mAnimations[i]->mNumChannels; ++j) {
+                mReferencedNodes.insert(mScene->mAnimations[i]->mChannels[j]->mNodeName.C_Str());
+            }
+        }
+        for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
+            for (unsigned int j = 0; j < mScene->mMeshes[i]->mNumBones; ++j) {
+                mReferencedNodes.insert(mScene->mMeshes[i]->mBones[j]->mName.C_Str());
+            }
+        }
+        for (unsigned int i = 0; i < mScene->mNumCameras; ++i) {
+            mReferencedNodes.insert(mScene->mCameras[i]->mName.C_Str());
+        }
+        for (unsigned int i = 0; i < mScene->mNumLights; ++i) {
+            mReferencedNodes.insert(mScene->mLights[i]->mName.C_Str());
+        }
+    }
+
     if (mScene->mRootNode) {
         ExportNodeHierarchy(mScene->mRootNode);
     }
 
     ExportMeshes();
     MergeMeshes();
+    ExportInstances();
 
     ExportScene();
 
@@ -433,6 +456,108 @@ inline Ref<Accessor> ExportData(Asset &a, std::string &meshName, Ref<Buffer> &bu
     return acc;
 }
 
+// Stores data in the meshopt fallback buffer and its EXT_meshopt_compression stream in the body
+// buffer. The data is filtered already, min and max are taken from what a reader decodes.
+inline Ref<Accessor> ExportMeshoptData(Asset &a, std::string &meshName, Ref<Buffer> &fallback, Ref<Buffer> &body,
+        size_t count, std::vector<uint8_t> &data, size_t stride, AttribType::Value type, ComponentType compType,
+        Meshopt::Mode mode, Meshopt::Filter filter, BufferViewTarget target) {
+    if (!count) {
+        return Ref<Accessor>();
+    }
+
+    std::vector<uint8_t> encoded;
+    if (mode == Meshopt::Mode_Attributes) {
+        Meshopt::EncodeVertexBuffer(encoded, data.data(), count, stride);
+    } else if (mode == Meshopt::Mode_Triangles) {
+        Meshopt::EncodeIndexBuffer(encoded, reinterpret_cast<const uint32_t *>(data.data()), count);
+    } else {
+        Meshopt::EncodeIndexSequence(encoded, reinterpret_cast<const uint32_t *>(data.data()), count);
+    }
+    Meshopt::DecodeFilter(filter, data.data(), count, stride);
+
+    // bufferView
+    Ref<BufferView> bv = a.bufferViews.Create(a.FindUniqueID(meshName, "view"));
+    bv->buffer = fallback;
+    bv->byteOffset = fallback->AppendData(data.data(), data.size());
+    bv->byteLength = data.size();
+    bv->byteStride = (mode == Meshopt::Mode_Attributes) ? static_cast<unsigned int>(stride) : 0;
+    bv->target = target;
+
+    bv->meshopt.reset(new BufferView::MeshoptCompression());
+    bv->meshopt->buffer = body;
+    bv->meshopt->byteOffset = body->AppendData(encoded.data(), encoded.size());
+    bv->meshopt->byteLength = encoded.size();
+    bv->meshopt->byteStride = stride;
+    bv->meshopt->count = count;
+    bv->meshopt->mode = mode;
+    bv->meshopt->filter = filter;
+
+    // accessor
+    Ref<Accessor> acc = a.accessors.Create(a.FindUniqueID(meshName, "accessor"));
+    acc->bufferView = bv;
+    acc->byteOffset = 0;
+    acc->componentType = compType;
+    acc->count = count;
+    acc->type = type;
+    acc->normalized = (mode == Meshopt::Mode_Attributes && compType != ComponentType_FLOAT);
+
+    const unsigned int numCompsIn = static_cast<unsigned int>(stride / ComponentTypeSize(compType));
+    SetAccessorRange(compType, acc, data.data(), count, numCompsIn, AttribType::GetNumComponents(type));
+
+    return acc;
+}
+
+// Meshopt compressed float attribute, exponential filtered if bits is not 0.
+inline Ref<Accessor> ExportMeshoptFloats(Asset &a, std::string &meshName, Ref<Buffer> &fallback, Ref<Buffer> &body,
+        size_t count, const ai_real *data, unsigned int numCompsIn, AttribType::Value typeOut, unsigned int bits) {
+    if (!count || !data) {
+        return Ref<Accessor>();
+    }
+
+    const unsigned int numCompsOut = AttribType::GetNumComponents(typeOut);
+    std::vector<float> values(count * numCompsOut);
+    for (size_t i = 0; i < count; ++i) {
+        for (unsigned int j = 0; j < numCompsOut; ++j) {
+            values[i * numCompsOut + j] = static_cast<float>(data[i * numCompsIn + j]);
+        }
+    }
+
+    const size_t stride = numCompsOut * sizeof(float);
+    std::vector<uint8_t> filtered(count * stride);
+    if (bits > 0) {
+        Meshopt::EncodeExponentialFilter(filtered.data(), count, stride, values.data(), bits);
+    } else {
+        memcpy(filtered.data(), values.data(), filtered.size());
+    }
+
+    return ExportMeshoptData(a, meshName, fallback, body, count, filtered, stride, typeOut, ComponentType_FLOAT,
+            Meshopt::Mode_Attributes, bits > 0 ? Meshopt::Filter_Exponential : Meshopt::Filter_None,
+            BufferViewTarget_ARRAY_BUFFER);
+}
+
+// Meshopt compressed normals, octahedral encoded into normalized BYTE or SHORT components.
+inline Ref<Accessor> ExportMeshoptNormals(Asset &a, std::string &meshName, Ref<Buffer> &fallback, Ref<Buffer> &body,
+        size_t count, const aiVector3D *normals, unsigned int bits) {
+    if (!count || !normals) {
+        return Ref<Accessor>();
+    }
+
+    std::vector<float> values(count * 3);
+    for (size_t i = 0; i < count; ++i) {
+        values[i * 3 + 0] = static_cast<float>(normals[i].x);
+        values[i * 3 + 1] = static_cast<float>(normals[i].y);
+        values[i * 3 + 2] = static_cast<float>(normals[i].z);
+    }
+
+    const size_t stride = (bits <= 8) ? 4 : 8;
+    std::vector<uint8_t> filtered(count * stride);
+    Meshopt::EncodeOctahedralFilter(filtered.data(), count, stride, values.data(), bits);
+
+    return ExportMeshoptData(a, meshName, fallback, body, count, filtered, stride, AttribType::VEC3,
+            (bits <= 8) ? ComponentType_BYTE : ComponentType_SHORT, Meshopt::Mode_Attributes,
+            Meshopt::Filter_Octahedral, BufferViewTarget_ARRAY_BUFFER);
+}
+
 inline void ExportNodeExtras(const aiMetadataEntry &metadataEntry, aiString name, CustomExtension &value) {
 
     value.name = name.C_Str();
@@ -1178,6 +1303,14 @@ void glTF2Exporter::ExportMeshes() {
         b = mAsset->buffers.Create(bufferId);
     }
 
+    // With meshopt compression the body buffer holds the compressed streams, which
+    // decode into a fallback buffer without data of its own.
+    const bool useMeshopt = mProperties->GetPropertyBool(AI_CONFIG_EXPORT_GLTF_MESHOPT_COMPRESSION, false);
+    const unsigned int positionBits = std::max(0, std::min(mProperties->GetPropertyInteger(AI_CONFIG_EXPORT_GLTF_MESHOPT_POSITION_BITS, 0), 24));
+    const unsigned int normalBits = std::max(0, std::min(mProperties->GetPropertyInteger(AI_CONFIG_EXPORT_GLTF_MESHOPT_NORMAL_BITS, 0), 16));
+    const unsigned int texCoordBits = std::max(0, std::min(mProperties->GetPropertyInteger(AI_CONFIG_EXPORT_GLTF_MESHOPT_TEXCOORD_BITS, 0), 24));
+    Ref<Buffer> fallback;
+
     //----------------------------------------
     // Initialize variables for the skin
     bool createSkin = false;
@@ -1204,6 +1337,13 @@ void glTF2Exporter::ExportMeshes() {
             continue;
         }
 
+        if (useMeshopt && !fallback) {
+            fallback = mAsset->buffers.Create(mAsset->FindUniqueID(bufferId, "fallback"));
+            fallback->meshoptFallback = true;
+            mAsset->extensionsUsed.EXT_meshopt_compression = true;
+            mAsset->extensionsRequired.EXT_meshopt_compression = true;
+        }
+
         std::string name = aim->mName.C_Str();
 
         std::string meshId = mAsset->FindUniqueID(name, "mesh");
@@ -1217,35 +1357,55 @@ void glTF2Exporter::ExportMeshes() {
         p.ngonEncoded = (aim->mPrimitiveTypes & aiPrimitiveType_NGONEncodingFlag) != 0;
 
         /******************* Vertices ********************/
-        Ref<Accessor> v = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mVertices, AttribType::VEC3,
-                AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        Ref<Accessor> v = fallback ?
+                ExportMeshoptFloats(*mAsset, meshId, fallback, b, aim->mNumVertices, reinterpret_cast<const ai_real *>(aim->mVertices),
+                        3, AttribType::VEC3, positionBits) :
+                ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mVertices, AttribType::VEC3,
+                        AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
         if (v) {
             p.attributes.position.push_back(v);
         }
 
         /******************** Normals ********************/
-        // Normalize all normals as the validator can emit a warning otherwise
+        // Normalize all normals as the validator can emit a warning otherwise. This works on a
+        // copy, the scene passed to the exporter may be shared with the caller.
+        std::vector<aiVector3D> normals;
         if (nullptr != aim->mNormals) {
-            for (auto i = 0u; i < aim->mNumVertices; ++i) {
-                aim->mNormals[i].NormalizeSafe();
+            normals.assign(aim->mNormals, aim->mNormals + aim->mNumVertices);
+            for (auto &normal : normals) {
+                normal.NormalizeSafe();
             }
         }
 
-        Ref<Accessor> n = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mNormals, AttribType::VEC3,
-                AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        Ref<Accessor> n;
+        if (fallback && normalBits > 0) {
+            n = ExportMeshoptNormals(*mAsset, meshId, fallback, b, normals.size(), normals.data(), normalBits);
+            mAsset->extensionsUsed.KHR_mesh_quantization = true;
+            mAsset->extensionsRequired.KHR_mesh_quantization = true;
+        } else if (fallback) {
+            n = ExportMeshoptFloats(*mAsset, meshId, fallback, b, normals.size(), reinterpret_cast<const ai_real *>(normals.data()),
+                    3, AttribType::VEC3, 0);
+        } else {
+            n = ExportData(*mAsset, meshId, b, normals.size(), normals.data(), AttribType::VEC3,
+                    AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+        }
         if (n) {
             p.attributes.normal.push_back(n);
         }
 
         /******************** Tangents ********************/
         if (nullptr != aim->mTangents) {
-            for (uint32_t i = 0; i < aim->mNumVertices; ++i) {
-                aim->mTangents[i].NormalizeSafe();
+            std::vector<aiVector3D> tangents(aim->mTangents, aim->mTangents + aim->mNumVertices);
+            for (auto &tangent : tangents) {
+                tangent.NormalizeSafe();
             }
-            Ref<Accessor> t = ExportData(
-                *mAsset, meshId, b, aim->mNumVertices, aim->mTangents, AttribType::VEC3,
-                AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER
-            );
+            Ref<Accessor> t = fallback ?
+                ExportMeshoptFloats(*mAsset, meshId, fallback, b, tangents.size(), reinterpret_cast<const ai_real *>(tangents.data()),
+                        3, AttribType::VEC3, 0) :
+                ExportData(
+                    *mAsset, meshId, b, tangents.size(), tangents.data(), AttribType::VEC3,
+                    AttribType::VEC3, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER
+                );
             if (t) {
                 p.attributes.tangent.push_back(t);
             }
@@ -1257,18 +1417,22 @@ void glTF2Exporter::ExportMeshes() {
                 continue;
             }
 
-            // Flip UV y coords
-            if (aim->mNumUVComponents[i] > 1) {
-                for (unsigned int j = 0; j < aim->mNumVertices; ++j) {
-                    aim->mTextureCoords[i][j].y = 1 - aim->mTextureCoords[i][j].y;
+            if (aim->mNumUVComponents[i] > 0) {
+                // Flip UV y coords
+                std::vector<aiVector3D> uvs(aim->mTextureCoords[i], aim->mTextureCoords[i] + aim->mNumVertices);
+                if (aim->mNumUVComponents[i] > 1) {
+                    for (auto &uv : uvs) {
+                        uv.y = 1 - uv.y;
+                    }
                 }
-            }
 
-            if (aim->mNumUVComponents[i] > 0) {
                 AttribType::Value type = (aim->mNumUVComponents[i] == 2) ? AttribType::VEC2 : AttribType::VEC3;
 
-                Ref<Accessor> tc = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mTextureCoords[i],
-                        AttribType::VEC3, type, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+                Ref<Accessor> tc = fallback ?
+                        ExportMeshoptFloats(*mAsset, meshId, fallback, b, uvs.size(), reinterpret_cast<const ai_real *>(uvs.data()),
+                                3, type, texCoordBits) :
+                        ExportData(*mAsset, meshId, b, uvs.size(), uvs.data(),
+                                AttribType::VEC3, type, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
                 if (tc) {
                     p.attributes.texcoord.push_back(tc);
                 }
@@ -1277,8 +1441,11 @@ void glTF2Exporter::ExportMeshes() {
 
         /*************** Vertex colors ****************/
         for (unsigned int indexColorChannel = 0; indexColorChannel < aim->GetNumColorChannels(); ++indexColorChannel) {
-            Ref<Accessor> c = ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mColors[indexColorChannel],
-                    AttribType::VEC4, AttribType::VEC4, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
+            Ref<Accessor> c = fallback ?
+                    ExportMeshoptFloats(*mAsset, meshId, fallback, b, aim->mNumVertices, reinterpret_cast<const ai_real *>(aim->mColors[indexColorChannel]),
+                            4, AttribType::VEC4, 0) :
+                    ExportData(*mAsset, meshId, b, aim->mNumVertices, aim->mColors[indexColorChannel],
+                            AttribType::VEC4, AttribType::VEC4, ComponentType_FLOAT, BufferViewTarget_ARRAY_BUFFER);
             if (c) {
                 p.attributes.color.push_back(c);
             }
@@ -1295,8 +1462,17 @@ void glTF2Exporter::ExportMeshes() {
                 }
             }
 
-            p.indices = ExportData(*mAsset, meshId, b, indices.size(), &indices[0], AttribType::SCALAR, AttribType::SCALAR,
-                    ComponentType_UNSIGNED_INT, BufferViewTarget_ELEMENT_ARRAY_BUFFER);
+            if (fallback) {
+                std::vector<uint8_t> data(indices.size() * sizeof(uint32_t));
+                memcpy(data.data(), indices.data(), data.size());
+                p.indices = ExportMeshoptData(*mAsset, meshId, fallback, b, indices.size(), data, sizeof(uint32_t),
+                        AttribType::SCALAR, ComponentType_UNSIGNED_INT,
+                        (nIndicesPerFace == 3) ? Meshopt::Mode_Triangles : Meshopt::Mode_Indices,
+                        Meshopt::Filter_None, BufferViewTarget_ELEMENT_ARRAY_BUFFER);
+            } else {
+                p.indices = ExportData(*mAsset, meshId, b, indices.size(), &indices[0], AttribType::SCALAR, AttribType::SCALAR,
+                        ComponentType_UNSIGNED_INT, BufferViewTarget_ELEMENT_ARRAY_BUFFER);
+            }
         }
 
         switch (aim->mPrimitiveTypes) {
@@ -1371,7 +1547,7 @@ void glTF2Exporter::ExportMeshes() {
                 if (pAnimMesh->HasNormals() && bIncludeNormal) {
                     aiVector3D *pNormalDiff = new aiVector3D[pAnimMesh->mNumVertices];
                     for (unsigned int vt = 0; vt < pAnimMesh->mNumVertices; ++vt) {
-                        pNormalDiff[vt] = pAnimMesh->mNormals[vt] - aim->mNormals[vt];
+                        pNormalDiff[vt] = pAnimMesh->mNormals[vt] - normals[vt];
                     }
                     Ref<Accessor> vec;
                     if (bUseSparse) {
@@ -1513,11 +1689,12 @@ unsigned int glTF2Exporter::ExportNodeHierarchy(const aiNode *n) {
         node->meshes.emplace_back(mAsset->meshes.Get(n->mMeshes[i]));
     }
 
-    for (unsigned int i = 0; i < n->mNumChildren; ++i) {
-        unsigned int idx = ExportNode(n->mChildren[i], node);
-        node->children.emplace_back(mAsset->nodes.Get(idx));
+    if (n->mNumInstances > 0 && n->mNumMeshes > 0) {
+        mNodeInstances[node.GetIndex()].assign(n->mInstanceTransforms, n->mInstanceTransforms + n->mNumInstances);
     }
 
+    ExportChildren(n, node);
+
     return node.GetIndex();
 }
 
@@ -1566,14 +1743,132 @@ unsigned int glTF2Exporter::ExportNode(const aiNode *n, Ref<Node> &parent) {
         node->meshes.emplace_back(mAsset->meshes.Get(n->mMeshes[i]));
     }
 
-    for (unsigned int i = 0; i < n->mNumChildren; ++i) {
-        unsigned int idx = ExportNode(n->mChildren[i], node);
-        node->children.emplace_back(mAsset->nodes.Get(idx));
+    if (n->mNumInstances > 0 && n->mNumMeshes > 0) {
+        mNodeInstances[node.GetIndex()].assign(n->mInstanceTransforms, n->mInstanceTransforms + n->mNumInstances);
     }
 
+    ExportChildren(n, node);
+
     return node.GetIndex();
 }
 
+/*
+ * Export the children of a node. If enabled, leaf children which place the same meshes are
+ * exported as one node with an instance transformation per child.
+ */
+void glTF2Exporter::ExportChildren(const aiNode *n, Ref<Node> &node) {
+    std::map<std::vector<unsigned int>, std::vector<unsigned int>> instances;
+    if (mMergeInstances) {
+        for (unsigned int i = 0; i < n->mNumChildren; ++i) {
+            const aiNode *child = n->mChildren[i];
+            if (IsInstanceCandidate(child)) {
+                instances[std::vector<unsigned int>(child->mMeshes, child->mMeshes + child->mNumMeshes)].push_back(i);
+            }
+        }
+    }
+
+    for (unsigned int i = 0; i < n->mNumChildren; ++i) {
+        const aiNode *child = n->mChildren[i];
+
+        std::vector<unsigned int> *siblings = nullptr;
+        if (!instances.empty() && IsInstanceCandidate(child)) {
+            siblings = &instances[std::vector<unsigned int>(child->mMeshes, child->mMeshes + child->mNumMeshes)];
+            if (siblings->size() < 2) {
+                siblings = nullptr;
+            } else if (siblings->front() != i) {
+                // already exported as an instance of the first sibling
+                continue;
+            }
+        }
+
+        unsigned int idx = ExportNode(child, node);
+        Ref<Node> childNode = mAsset->nodes.Get(idx);
+        node->children.emplace_back(childNode);
+
+        if (siblings) {
+            // the transformations move from the node into its instances
+            childNode->matrix.isPresent = false;
+            childNode->translation.isPresent = false;
+            childNode->rotation.isPresent = false;
+            childNode->scale.isPresent = false;
+
+            std::vector<aiMatrix4x4> &transforms = mNodeInstances[idx];
+            transforms.reserve(siblings->size());
+            for (unsigned int sibling : *siblings) {
+                transforms.push_back(n->mChildren[sibling]->mTransformation);
+            }
+        }
+    }
+}
+
+/*
+ * Whether a node only places its meshes and may be merged with its siblings.
+ */
+bool glTF2Exporter::IsInstanceCandidate(const aiNode *n) const {
+    if (n->mNumChildren > 0 || n->mNumMeshes == 0 || n->mNumInstances > 0 || n->mMetaData) {
+        return false;
+    }
+    for (unsigned int i = 0; i < n->mNumMeshes; ++i) {
+        if (mScene->mMeshes[n->mMeshes[i]]->HasBones()) {
+            return false;
+        }
+    }
+    return mReferencedNodes.find(n->mName.C_Str()) == mReferencedNodes.end();
+}
+
+/*
+ * Write the collected instance transformations as EXT_mesh_gpu_instancing accessors.
+ */
+void glTF2Exporter::ExportInstances() {
+    if (mNodeInstances.empty()) {
+        return;
+    }
+    mAsset->extensionsUsed.EXT_mesh_gpu_instancing = true;
+
+    Ref<Buffer> b = mAsset->buffers.Get(0u);
+    for (auto &nodeInstances : mNodeInstances) {
+        Ref<Node> node = mAsset->nodes.Get(nodeInstances.first);
+        const std::vector<aiMatrix4x4> &transforms = nodeInstances.second;
+
+        std::vector<float> translations(transforms.size() * 3);
+        std::vector<float> rotations(transforms.size() * 4);
+        std::vector<float> scales(transforms.size() * 3);
+        bool hasRotation = false;
+        bool hasScale = false;
+        for (size_t i = 0; i < transforms.size(); ++i) {
+            aiVector3D scaling, position;
+            aiQuaternion rotation;
+            transforms[i].Decompose(scaling, rotation, position);
+
+            translations[i * 3 + 0] = static_cast<float>(position.x);
+            translations[i * 3 + 1] = static_cast<float>(position.y);
+            translations[i * 3 + 2] = static_cast<float>(position.z);
+            rotations[i * 4 + 0] = static_cast<float>(rotation.x);
+            rotations[i * 4 + 1] = static_cast<float>(rotation.y);
+            rotations[i * 4 + 2] = static_cast<float>(rotation.z);
+            rotations[i * 4 + 3] = static_cast<float>(rotation.w);
+            scales[i * 3 + 0] = static_cast<float>(scaling.x);
+            scales[i * 3 + 1] = static_cast<float>(scaling.y);
+            scales[i * 3 + 2] = static_cast<float>(scaling.z);
+
+            hasRotation = hasRotation || !rotation.Equal(aiQuaternion());
+            hasScale = hasScale || !scaling.Equal(aiVector3D(1, 1, 1));
+        }
+
+        node->instancing.isPresent = true;
+        node->instancing.value.translation = ExportData(*mAsset, node->id, b, transforms.size(), translations.data(),
+                AttribType::VEC3, AttribType::VEC3, ComponentType_FLOAT);
+        if (hasRotation) {
+            node->instancing.value.rotation = ExportData(*mAsset, node->id, b, transforms.size(), rotations.data(),
+                    AttribType::VEC4, AttribType::VEC4, ComponentType_FLOAT);
+        }
+        if (hasScale) {
+            node->instancing.value.scale = ExportData(*mAsset, node->id, b, transforms.size(), scales.data(),
+                    AttribType::VEC3, AttribType::VEC3, ComponentType_FLOAT);
+        }
+    }
+}
+
 void glTF2Exporter::ExportScene() {
     // Use the name of the scene if specified
     const std::string sceneName = (mScene->mName.length > 0) ? mScene->mName.C_Str() : "defaultScene";
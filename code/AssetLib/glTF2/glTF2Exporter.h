@@ -53,6 +53,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <map>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <vector>
 
@@ -134,6 +135,9 @@ protected:
     void MergeMeshes();
     unsigned int ExportNodeHierarchy(const aiNode *n);
     unsigned int ExportNode(const aiNode *node, glTFCommon::Ref<glTF2::Node> &parent);
+    void ExportChildren(const aiNode *n, glTFCommon::Ref<glTF2::Node> &node);
+    bool IsInstanceCandidate(const aiNode *n) const;
+    void ExportInstances();
     void ExportScene();
     void ExportAnimations();
 
@@ -146,6 +150,9 @@ private:
     std::shared_ptr<glTF2::Asset> mAsset;
     std::vector<unsigned char> mBodyData;
     ai_real configEpsilon;
+    bool mMergeInstances;
+    std::set<std::string> mReferencedNodes;
+    std::map<unsigned int, std::vector<aiMatrix4x4>> mNodeInstances;
 };
 
 } // namespace Assimp
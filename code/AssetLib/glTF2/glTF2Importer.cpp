@@ -1028,6 +1028,60 @@ static void GetNodeTransform(aiMatrix4x4 &matrix, const glTF2::Node &node) {
     }
 }
 
+// Composes the EXT_mesh_gpu_instancing attributes into one matrix per instance.
+static void GetInstanceTransforms(aiNode &ainode, glTF2::Node &node) {
+    Node::Instancing &instancing = node.instancing.value;
+
+    size_t count = 0;
+    for (Ref<Accessor> *attribute : { &instancing.translation, &instancing.rotation, &instancing.scale }) {
+        if (!*attribute) {
+            continue;
+        }
+        if (count != 0 && (*attribute)->count != count) {
+            throw DeadlyImportError("GLTF: EXT_mesh_gpu_instancing attributes of ", getContextForErrorMessages(node.id, node.name),
+                    " have different counts");
+        }
+        count = (*attribute)->count;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    aiVector3D *translations = nullptr;
+    aiQuaternion *rotations = nullptr;
+    aiVector3D *scales = nullptr;
+    if (instancing.translation) {
+        instancing.translation->ExtractData(translations);
+    }
+    std::unique_ptr<aiVector3D[]> translationsOwner(translations);
+    if (instancing.rotation) {
+        instancing.rotation->ExtractData(rotations);
+    }
+    std::unique_ptr<aiQuaternion[]> rotationsOwner(rotations);
+    if (instancing.scale) {
+        instancing.scale->ExtractData(scales);
+    }
+    std::unique_ptr<aiVector3D[]> scalesOwner(scales);
+
+    ainode.mNumInstances = static_cast<unsigned int>(count);
+    ainode.mInstanceTransforms = new aiMatrix4x4[count];
+    for (size_t i = 0; i < count; ++i) {
+        aiMatrix4x4 &matrix = ainode.mInstanceTransforms[i];
+        if (translations) {
+            aiMatrix4x4::Translation(translations[i], matrix);
+        }
+        if (rotations) {
+            // glTF stores quaternions as x, y, z, w
+            const aiQuaternion rot(rotations[i].z, rotations[i].w, rotations[i].x, rotations[i].y);
+            matrix = matrix * aiMatrix4x4(rot.GetMatrix());
+        }
+        if (scales) {
+            aiMatrix4x4 s;
+            matrix = matrix * aiMatrix4x4::Scaling(scales[i], s);
+        }
+    }
+}
+
 static void BuildVertexWeightMapping(Mesh::Primitive &primitive, std::vector<std::vector<aiVertexWeight>> &map, std::vector<unsigned int>* vertexRemappingTablePtr) {
 
     Mesh::Primitive::Attributes &attr = primitive.attributes;
@@ -1160,6 +1214,10 @@ aiNode *glTF2Importer::ImportNode(glTF2::Asset &r, glTF2::Ref<glTF2::Node> &ptr)
 
         GetNodeTransform(ainode->mTransformation, node);
 
+        if (node.instancing.isPresent && !node.meshes.empty()) {
+            GetInstanceTransforms(*ainode, node);
+        }
+
         if (!node.meshes.empty()) {
             // GLTF files contain at most 1 mesh per node.
             if (node.meshes.size() > 1) {
@@ -0,0 +1,927 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file glTF2Meshopt.cpp
+ *  Encoder and decoder for the bitstreams of the EXT_meshopt_compression extension.
+ */
+#if !defined(ASSIMP_BUILD_NO_GLTF_IMPORTER) || !defined(ASSIMP_BUILD_NO_GLTF_EXPORTER)
+
+#include "AssetLib/glTF2/glTF2Meshopt.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace glTF2 {
+namespace Meshopt {
+
+namespace {
+
+const uint8_t VertexHeader = 0xa0;
+const uint8_t IndexHeader = 0xe0;
+const uint8_t SequenceHeader = 0xd0;
+
+const size_t VertexBlockSizeBytes = 8192;
+const size_t VertexBlockMaxSize = 256;
+const size_t ByteGroupSize = 16;
+const size_t ByteGroupDecodeLimit = 24;
+const size_t TailMaxSize = 32;
+
+// ------------------------------------------------------------------------------------------------
+// Number of vertices encoded in one block, a multiple of the byte group size.
+size_t GetVertexBlockSize(size_t stride) {
+    size_t result = VertexBlockSizeBytes / stride;
+    result &= ~(ByteGroupSize - 1);
+    return result < VertexBlockMaxSize ? result : VertexBlockMaxSize;
+}
+
+// ------------------------------------------------------------------------------------------------
+inline uint8_t Unzigzag8(uint8_t v) {
+    return static_cast<uint8_t>(-(v & 1) ^ (v >> 1));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Decodes a group of 16 bytes packed with 0, 2, 4 or 8 bits each. Packed values which are all
+// ones are escapes for a full byte stored after the packed bits.
+const uint8_t *DecodeBytesGroup(const uint8_t *data, uint8_t *out, unsigned int bitsLog2) {
+    switch (bitsLog2) {
+    case 0:
+        memset(out, 0, ByteGroupSize);
+        return data;
+    case 1:
+    case 2: {
+        const unsigned int bits = 1u << bitsLog2;
+        const unsigned int perByte = 8 / bits;
+        const uint8_t escape = static_cast<uint8_t>((1u << bits) - 1);
+        const uint8_t *extra = data + ByteGroupSize / perByte;
+        for (size_t i = 0; i < ByteGroupSize; ++i) {
+            const unsigned int shift = 8 - bits * (1 + static_cast<unsigned int>(i % perByte));
+            const uint8_t enc = (data[i / perByte] >> shift) & escape;
+            out[i] = (enc == escape) ? *extra++ : enc;
+        }
+        return extra;
+    }
+    default:
+        memcpy(out, data, ByteGroupSize);
+        return data + ByteGroupSize;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+const uint8_t *DecodeBytes(const uint8_t *data, const uint8_t *end, uint8_t *out, size_t size) {
+    // two header bits per byte group
+    const size_t headerSize = (size / ByteGroupSize + 3) / 4;
+    if (static_cast<size_t>(end - data) < headerSize) {
+        return nullptr;
+    }
+    const uint8_t *header = data;
+    data += headerSize;
+
+    for (size_t i = 0; i < size; i += ByteGroupSize) {
+        // a group never reads more than ByteGroupDecodeLimit bytes
+        if (static_cast<size_t>(end - data) < ByteGroupDecodeLimit) {
+            return nullptr;
+        }
+        const size_t group = i / ByteGroupSize;
+        const unsigned int bitsLog2 = (header[group / 4] >> ((group % 4) * 2)) & 3;
+        data = DecodeBytesGroup(data, out + i, bitsLog2);
+    }
+    return data;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Each byte of the vertex is stored as a separate stream of zigzag encoded deltas.
+const uint8_t *DecodeVertexBlock(const uint8_t *data, const uint8_t *end, uint8_t *out, size_t count, size_t stride, uint8_t *lastVertex) {
+    uint8_t deltas[VertexBlockMaxSize];
+    const size_t countAligned = (count + ByteGroupSize - 1) & ~(ByteGroupSize - 1);
+
+    for (size_t k = 0; k < stride; ++k) {
+        data = DecodeBytes(data, end, deltas, countAligned);
+        if (data == nullptr) {
+            return nullptr;
+        }
+
+        uint8_t p = lastVertex[k];
+        uint8_t *dst = out + k;
+        for (size_t i = 0; i < count; ++i, dst += stride) {
+            p = static_cast<uint8_t>(p + Unzigzag8(deltas[i]));
+            *dst = p;
+        }
+    }
+
+    memcpy(lastVertex, out + stride * (count - 1), stride);
+    return data;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int DecodeVByte(const uint8_t *&data) {
+    const uint8_t lead = *data++;
+    if (lead < 128) {
+        return lead;
+    }
+
+    // up to four more groups of seven bits
+    unsigned int result = lead & 127;
+    unsigned int shift = 7;
+    for (int i = 0; i < 4; ++i) {
+        const uint8_t group = *data++;
+        result |= static_cast<unsigned int>(group & 127) << shift;
+        shift += 7;
+        if (group < 128) {
+            break;
+        }
+    }
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------
+inline unsigned int DecodeIndex(const uint8_t *&data, unsigned int last) {
+    const unsigned int v = DecodeVByte(data);
+    const unsigned int d = (v >> 1) ^ (0u - (v & 1));
+    return last + d;
+}
+
+// ------------------------------------------------------------------------------------------------
+inline void WriteIndex(uint8_t *dst, size_t i, size_t indexSize, unsigned int index) {
+    if (indexSize == 2) {
+        const uint16_t v = static_cast<uint16_t>(index);
+        memcpy(dst + i * 2, &v, 2);
+    } else {
+        memcpy(dst + i * 4, &index, 4);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+inline void WriteTriangle(uint8_t *dst, size_t i, size_t indexSize, unsigned int a, unsigned int b, unsigned int c) {
+    WriteIndex(dst, i + 0, indexSize, a);
+    WriteIndex(dst, i + 1, indexSize, b);
+    WriteIndex(dst, i + 2, indexSize, c);
+}
+
+// ------------------------------------------------------------------------------------------------
+// FIFOs of the recently seen edges and vertices the triangle codes refer to.
+struct TriangleFifo {
+    unsigned int edges[16][2];
+    unsigned int vertices[16];
+    size_t edgeOffset = 0;
+    size_t vertexOffset = 0;
+
+    TriangleFifo() {
+        memset(edges, -1, sizeof(edges));
+        memset(vertices, -1, sizeof(vertices));
+    }
+
+    void PushEdge(unsigned int a, unsigned int b) {
+        edges[edgeOffset][0] = a;
+        edges[edgeOffset][1] = b;
+        edgeOffset = (edgeOffset + 1) & 15;
+    }
+
+    void PushVertex(unsigned int v, bool cond = true) {
+        vertices[vertexOffset] = v;
+        vertexOffset = (vertexOffset + (cond ? 1 : 0)) & 15;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+void DecodeOctahedralFilter(T *data, size_t count) {
+    const float max = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+
+    for (size_t i = 0; i < count; ++i) {
+        // z is stored so that |x| + |y| + |z| encodes 1 at the same bit count
+        float x = static_cast<float>(data[i * 4 + 0]);
+        float y = static_cast<float>(data[i * 4 + 1]);
+        const float z = static_cast<float>(data[i * 4 + 2]) - std::fabs(x) - std::fabs(y);
+
+        // fix up the octahedral coordinates of the lower hemisphere
+        const float t = (z < 0.f) ? z : 0.f;
+        x += (x >= 0.f) ? t : -t;
+        y += (y >= 0.f) ? t : -t;
+
+        const float l = std::sqrt(x * x + y * y + z * z);
+        const float s = max / l;
+
+        data[i * 4 + 0] = static_cast<T>(static_cast<int>(x * s + (x >= 0.f ? 0.5f : -0.5f)));
+        data[i * 4 + 1] = static_cast<T>(static_cast<int>(y * s + (y >= 0.f ? 0.5f : -0.5f)));
+        data[i * 4 + 2] = static_cast<T>(static_cast<int>(z * s + (z >= 0.f ? 0.5f : -0.5f)));
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void DecodeQuaternionFilter(int16_t *data, size_t count) {
+    const float scale = 1.f / std::sqrt(2.f);
+
+    for (size_t i = 0; i < count; ++i) {
+        // the scale of the three stored components is kept in the high bits of the fourth
+        const int sf = data[i * 4 + 3] | 3;
+        const float ss = scale / static_cast<float>(sf);
+
+        const float x = static_cast<float>(data[i * 4 + 0]) * ss;
+        const float y = static_cast<float>(data[i * 4 + 1]) * ss;
+        const float z = static_cast<float>(data[i * 4 + 2]) * ss;
+
+        // the largest component is reconstructed, clamped to avoid NaN due to precision errors
+        const float ww = 1.f - x * x - y * y - z * z;
+        const float w = std::sqrt(ww >= 0.f ? ww : 0.f);
+
+        const int xf = static_cast<int>(x * 32767.f + (x >= 0.f ? 0.5f : -0.5f));
+        const int yf = static_cast<int>(y * 32767.f + (y >= 0.f ? 0.5f : -0.5f));
+        const int zf = static_cast<int>(z * 32767.f + (z >= 0.f ? 0.5f : -0.5f));
+        const int wf = static_cast<int>(w * 32767.f + 0.5f);
+
+        // the low bits of the fourth component hold the index of the reconstructed one
+        const int qc = data[i * 4 + 3] & 3;
+
+        data[i * 4 + ((qc + 1) & 3)] = static_cast<int16_t>(xf);
+        data[i * 4 + ((qc + 2) & 3)] = static_cast<int16_t>(yf);
+        data[i * 4 + ((qc + 3) & 3)] = static_cast<int16_t>(zf);
+        data[i * 4 + ((qc + 0) & 3)] = static_cast<int16_t>(wf);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void DecodeExponentialFilter(uint8_t *data, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t v;
+        memcpy(&v, data + i * 4, 4);
+
+        // 24 bit signed mantissa and 8 bit signed exponent
+        const int m = static_cast<int32_t>(v << 8) >> 8;
+        const int e = static_cast<int32_t>(v) >> 24;
+
+        // ldexp(float(m), e) without the function call
+        const uint32_t scaleBits = static_cast<uint32_t>(e + 127) << 23;
+        float scale;
+        memcpy(&scale, &scaleBits, 4);
+        const float f = scale * static_cast<float>(m);
+        memcpy(data + i * 4, &f, 4);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+inline uint8_t Zigzag8(uint8_t v) {
+    return static_cast<uint8_t>(((v & 0x80) ? 0xff : 0) ^ (v << 1));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Size of a byte group encoded with the given bits per value, SIZE_MAX if it can't be encoded.
+size_t MeasureBytesGroup(const uint8_t *values, unsigned int bits) {
+    if (bits == 0) {
+        for (size_t i = 0; i < ByteGroupSize; ++i) {
+            if (values[i] != 0) {
+                return SIZE_MAX;
+            }
+        }
+        return 0;
+    }
+    if (bits == 8) {
+        return ByteGroupSize;
+    }
+
+    const unsigned int escape = (1u << bits) - 1;
+    size_t result = ByteGroupSize * bits / 8;
+    for (size_t i = 0; i < ByteGroupSize; ++i) {
+        result += (values[i] >= escape) ? 1 : 0;
+    }
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeBytesGroup(std::vector<uint8_t> &out, const uint8_t *values, unsigned int bits) {
+    if (bits == 0) {
+        return;
+    }
+    if (bits == 8) {
+        out.insert(out.end(), values, values + ByteGroupSize);
+        return;
+    }
+
+    const unsigned int perByte = 8 / bits;
+    const unsigned int escape = (1u << bits) - 1;
+    const size_t packed = out.size();
+    out.resize(packed + ByteGroupSize / perByte, 0);
+    for (size_t i = 0; i < ByteGroupSize; ++i) {
+        const unsigned int enc = (values[i] >= escape) ? escape : values[i];
+        const unsigned int shift = 8 - bits * (1 + static_cast<unsigned int>(i % perByte));
+        out[packed + i / perByte] |= static_cast<uint8_t>(enc << shift);
+    }
+    for (size_t i = 0; i < ByteGroupSize; ++i) {
+        if (values[i] >= escape) {
+            out.push_back(values[i]);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeBytes(std::vector<uint8_t> &out, const uint8_t *values, size_t size) {
+    const size_t header = out.size();
+    out.resize(header + (size / ByteGroupSize + 3) / 4, 0);
+
+    for (size_t i = 0; i < size; i += ByteGroupSize) {
+        // pick the smallest of the four encodings
+        unsigned int best = 3;
+        size_t bestSize = ByteGroupSize;
+        for (unsigned int bitsLog2 = 0; bitsLog2 < 3; ++bitsLog2) {
+            const size_t groupSize = MeasureBytesGroup(values + i, bitsLog2 == 0 ? 0 : 1u << bitsLog2);
+            if (groupSize < bestSize) {
+                best = bitsLog2;
+                bestSize = groupSize;
+            }
+        }
+
+        const size_t group = i / ByteGroupSize;
+        out[header + group / 4] |= static_cast<uint8_t>(best << ((group % 4) * 2));
+        EncodeBytesGroup(out, values + i, best == 0 ? 0 : 1u << best);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeVByte(std::vector<uint8_t> &out, unsigned int v) {
+    while (v >= 128) {
+        out.push_back(static_cast<uint8_t>((v & 127) | 128));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+// ------------------------------------------------------------------------------------------------
+inline void EncodeIndex(std::vector<uint8_t> &out, unsigned int index, unsigned int last) {
+    const unsigned int d = index - last;
+    EncodeVByte(out, (d << 1) ^ (0u - (d >> 31)));
+}
+
+// ------------------------------------------------------------------------------------------------
+// Position of an edge of the triangle in the edge FIFO, encoded as (entry << 2) | rotation.
+int FindEdge(const TriangleFifo &fifo, unsigned int a, unsigned int b, unsigned int c) {
+    for (int i = 0; i < 16; ++i) {
+        const size_t index = (fifo.edgeOffset - 1 - i) & 15;
+        const unsigned int e0 = fifo.edges[index][0];
+        const unsigned int e1 = fifo.edges[index][1];
+        if (e0 == a && e1 == b) {
+            return (i << 2) | 0;
+        }
+        if (e0 == b && e1 == c) {
+            return (i << 2) | 1;
+        }
+        if (e0 == c && e1 == a) {
+            return (i << 2) | 2;
+        }
+    }
+    return -1;
+}
+
+// ------------------------------------------------------------------------------------------------
+int FindVertex(const TriangleFifo &fifo, unsigned int v) {
+    for (int i = 0; i < 16; ++i) {
+        if (fifo.vertices[(fifo.vertexOffset - 1 - i) & 15] == v) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// ------------------------------------------------------------------------------------------------
+inline int QuantizeSnorm(float v, unsigned int bits) {
+    const float scale = static_cast<float>((1 << (bits - 1)) - 1);
+    v = std::max(-1.f, std::min(1.f, v));
+    return static_cast<int>(v * scale + (v >= 0.f ? 0.5f : -0.5f));
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+void EncodeOctahedral(T *dst, size_t count, const float *vectors, unsigned int bits) {
+    const int one = QuantizeSnorm(1.f, bits);
+    for (size_t i = 0; i < count; ++i) {
+        float x = vectors[i * 3 + 0];
+        float y = vectors[i * 3 + 1];
+        const float z = vectors[i * 3 + 2];
+
+        // project onto the octahedron and fold the lower hemisphere over
+        const float l = std::fabs(x) + std::fabs(y) + std::fabs(z);
+        const float s = (l == 0.f) ? 0.f : 1.f / l;
+        x *= s;
+        y *= s;
+        const float u = (z >= 0.f) ? x : (1.f - std::fabs(y)) * (x >= 0.f ? 1.f : -1.f);
+        const float v = (z >= 0.f) ? y : (1.f - std::fabs(x)) * (y >= 0.f ? 1.f : -1.f);
+
+        dst[i * 4 + 0] = static_cast<T>(QuantizeSnorm(u, bits));
+        dst[i * 4 + 1] = static_cast<T>(QuantizeSnorm(v, bits));
+        dst[i * 4 + 2] = static_cast<T>(one);
+        dst[i * 4 + 3] = 0;
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+bool DecodeVertexBuffer(uint8_t *dst, size_t count, size_t stride, const uint8_t *src, size_t srcSize) {
+    if (stride == 0 || stride > 256 || stride % 4 != 0) {
+        return false;
+    }
+    if (srcSize < 1 + stride) {
+        return false;
+    }
+    if ((src[0] & 0xf0) != VertexHeader || (src[0] & 0x0f) != 0) {
+        return false;
+    }
+
+    const uint8_t *data = src + 1;
+    const uint8_t *end = src + srcSize;
+
+    // the deltas of the first block are relative to the vertex stored at the end of the stream
+    uint8_t lastVertex[256];
+    memcpy(lastVertex, end - stride, stride);
+
+    const size_t blockSize = GetVertexBlockSize(stride);
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        const size_t size = (offset + blockSize < count) ? blockSize : count - offset;
+        data = DecodeVertexBlock(data, end, dst + offset * stride, size, stride, lastVertex);
+        if (data == nullptr) {
+            return false;
+        }
+    }
+
+    const size_t tailSize = stride < TailMaxSize ? TailMaxSize : stride;
+    return static_cast<size_t>(end - data) == tailSize;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool DecodeIndexBuffer(uint8_t *dst, size_t count, size_t indexSize, const uint8_t *src, size_t srcSize) {
+    if (count % 3 != 0 || (indexSize != 2 && indexSize != 4)) {
+        return false;
+    }
+    // header, one code byte per triangle and the 16 byte auxiliary code table
+    if (srcSize < 1 + count / 3 + 16) {
+        return false;
+    }
+    if ((src[0] & 0xf0) != IndexHeader) {
+        return false;
+    }
+    const int version = src[0] & 0x0f;
+    if (version > 1) {
+        return false;
+    }
+
+    TriangleFifo fifo;
+    unsigned int next = 0;
+    unsigned int last = 0;
+
+    // version 1 uses the two highest vertex FIFO codes for +1 / -1 deltas to the last free index
+    const int fecMax = version >= 1 ? 13 : 15;
+
+    const uint8_t *code = src + 1;
+    const uint8_t *data = code + count / 3;
+    const uint8_t *dataSafeEnd = src + srcSize - 16;
+    const uint8_t *codeAuxTable = dataSafeEnd;
+
+    for (size_t i = 0; i < count; i += 3) {
+        // a triangle reads at most 16 bytes of data, the code table at the end is the padding
+        if (data > dataSafeEnd) {
+            return false;
+        }
+
+        const uint8_t codeTri = *code++;
+
+        if (codeTri < 0xf0) {
+            // the triangle shares an edge with a recent one
+            const int fe = codeTri >> 4;
+            const unsigned int a = fifo.edges[(fifo.edgeOffset - 1 - fe) & 15][0];
+            const unsigned int b = fifo.edges[(fifo.edgeOffset - 1 - fe) & 15][1];
+
+            const int fec = codeTri & 15;
+            if (fec < fecMax) {
+                const unsigned int c = (fec == 0) ? next : fifo.vertices[(fifo.vertexOffset - 1 - fec) & 15];
+                next += (fec == 0) ? 1 : 0;
+
+                WriteTriangle(dst, i, indexSize, a, b, c);
+
+                fifo.PushVertex(c, fec == 0);
+                fifo.PushEdge(c, b);
+                fifo.PushEdge(a, c);
+            } else {
+                // 13 and 14 decode to last - 1 and last + 1
+                const unsigned int c = (fec != 15) ? last + (fec - (fec ^ 3)) : DecodeIndex(data, last);
+                last = c;
+
+                WriteTriangle(dst, i, indexSize, a, b, c);
+
+                fifo.PushVertex(c);
+                fifo.PushEdge(c, b);
+                fifo.PushEdge(a, c);
+            }
+        } else if (codeTri < 0xfe) {
+            // a new triangle whose vertex codes are looked up in the table
+            const uint8_t codeAux = codeAuxTable[codeTri & 15];
+            const int feb = codeAux >> 4;
+            const int fec = codeAux & 15;
+
+            const unsigned int a = next++;
+
+            const unsigned int b = (feb == 0) ? next : fifo.vertices[(fifo.vertexOffset - feb) & 15];
+            next += (feb == 0) ? 1 : 0;
+
+            const unsigned int c = (fec == 0) ? next : fifo.vertices[(fifo.vertexOffset - fec) & 15];
+            next += (fec == 0) ? 1 : 0;
+
+            WriteTriangle(dst, i, indexSize, a, b, c);
+
+            fifo.PushVertex(a);
+            fifo.PushVertex(b, feb == 0);
+            fifo.PushVertex(c, fec == 0);
+
+            fifo.PushEdge(b, a);
+            fifo.PushEdge(c, b);
+            fifo.PushEdge(a, c);
+        } else {
+            // a new triangle with a full byte of vertex codes
+            const uint8_t codeAux = *data++;
+
+            const int fea = codeTri == 0xfe ? 0 : 15;
+            const int feb = codeAux >> 4;
+            const int fec = codeAux & 15;
+
+            // a zero code restarts the vertex numbering
+            if (codeAux == 0) {
+                next = 0;
+            }
+
+            unsigned int a = (fea == 0) ? next++ : 0;
+            unsigned int b = (feb == 0) ? next++ : fifo.vertices[(fifo.vertexOffset - feb) & 15];
+            unsigned int c = (fec == 0) ? next++ : fifo.vertices[(fifo.vertexOffset - fec) & 15];
+
+            // free indices are delta encoded against the previous free index
+            if (fea == 15) {
+                last = a = DecodeIndex(data, last);
+            }
+            if (feb == 15) {
+                last = b = DecodeIndex(data, last);
+            }
+            if (fec == 15) {
+                last = c = DecodeIndex(data, last);
+            }
+
+            WriteTriangle(dst, i, indexSize, a, b, c);
+
+            fifo.PushVertex(a);
+            fifo.PushVertex(b, feb == 0 || feb == 15);
+            fifo.PushVertex(c, fec == 0 || fec == 15);
+
+            fifo.PushEdge(b, a);
+            fifo.PushEdge(c, b);
+            fifo.PushEdge(a, c);
+        }
+    }
+
+    // all data up to the code table must have been consumed
+    return data == dataSafeEnd;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool DecodeIndexSequence(uint8_t *dst, size_t count, size_t indexSize, const uint8_t *src, size_t srcSize) {
+    if (indexSize != 2 && indexSize != 4) {
+        return false;
+    }
+    // header, at least one byte per index and a 4 byte tail
+    if (srcSize < 1 + count + 4) {
+        return false;
+    }
+    if ((src[0] & 0xf0) != SequenceHeader || (src[0] & 0x0f) > 1) {
+        return false;
+    }
+
+    const uint8_t *data = src + 1;
+    const uint8_t *dataSafeEnd = src + srcSize - 4;
+
+    // two baselines, the lowest bit of each value selects the one the delta refers to
+    unsigned int last[2] = { 0, 0 };
+
+    for (size_t i = 0; i < count; ++i) {
+        // an index reads at most 5 bytes, the tail is the padding
+        if (data >= dataSafeEnd) {
+            return false;
+        }
+
+        unsigned int v = DecodeVByte(data);
+        const unsigned int current = v & 1;
+        v >>= 1;
+
+        const unsigned int d = (v >> 1) ^ (0u - (v & 1));
+        const unsigned int index = last[current] + d;
+        last[current] = index;
+
+        WriteIndex(dst, i, indexSize, index);
+    }
+
+    return data == dataSafeEnd;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool DecodeFilter(Filter filter, uint8_t *data, size_t count, size_t stride) {
+    switch (filter) {
+    case Filter_None:
+        return true;
+    case Filter_Octahedral:
+        if (stride == 4) {
+            DecodeOctahedralFilter(reinterpret_cast<int8_t *>(data), count);
+            return true;
+        }
+        if (stride == 8) {
+            DecodeOctahedralFilter(reinterpret_cast<int16_t *>(data), count);
+            return true;
+        }
+        return false;
+    case Filter_Quaternion:
+        if (stride != 8) {
+            return false;
+        }
+        DecodeQuaternionFilter(reinterpret_cast<int16_t *>(data), count);
+        return true;
+    case Filter_Exponential:
+        if (stride % 4 != 0) {
+            return false;
+        }
+        DecodeExponentialFilter(data, count * (stride / 4));
+        return true;
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeVertexBuffer(std::vector<uint8_t> &out, const uint8_t *data, size_t count, size_t stride) {
+    out.clear();
+    out.push_back(VertexHeader);
+    if (count == 0) {
+        out.resize(1 + std::max(stride, TailMaxSize), 0);
+        return;
+    }
+
+    // the deltas of the first block are relative to the first vertex, stored at the end
+    uint8_t lastVertex[256];
+    memcpy(lastVertex, data, stride);
+
+    uint8_t deltas[VertexBlockMaxSize];
+    const size_t blockSize = GetVertexBlockSize(stride);
+    for (size_t offset = 0; offset < count; offset += blockSize) {
+        const size_t size = (offset + blockSize < count) ? blockSize : count - offset;
+        const size_t sizeAligned = (size + ByteGroupSize - 1) & ~(ByteGroupSize - 1);
+        const uint8_t *block = data + offset * stride;
+
+        for (size_t k = 0; k < stride; ++k) {
+            uint8_t p = lastVertex[k];
+            for (size_t i = 0; i < size; ++i) {
+                const uint8_t v = block[i * stride + k];
+                deltas[i] = Zigzag8(static_cast<uint8_t>(v - p));
+                p = v;
+            }
+            memset(deltas + size, 0, sizeAligned - size);
+            EncodeBytes(out, deltas, sizeAligned);
+        }
+
+        memcpy(lastVertex, block + (size - 1) * stride, stride);
+    }
+
+    const size_t tailSize = std::max(stride, TailMaxSize);
+    out.resize(out.size() + tailSize - stride, 0);
+    out.insert(out.end(), data, data + stride);
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeIndexBuffer(std::vector<uint8_t> &out, const uint32_t *indices, size_t count) {
+    static const unsigned int TriangleIndexOrder[3][3] = { { 0, 1, 2 }, { 1, 2, 0 }, { 2, 0, 1 } };
+    static const uint8_t CodeAuxTable[16] = {
+        0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xa9, 0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0, 0
+    };
+    const int fecMax = 13;
+
+    std::vector<uint8_t> data;
+    out.clear();
+    out.push_back(IndexHeader | 1);
+
+    TriangleFifo fifo;
+    unsigned int next = 0;
+    unsigned int last = 0;
+
+    for (size_t i = 0; i + 2 < count; i += 3) {
+        const int fer = FindEdge(fifo, indices[i + 0], indices[i + 1], indices[i + 2]);
+
+        if (fer >= 0 && (fer >> 2) < 15) {
+            // the triangle shares an edge with a recent one, rotated so that the edge comes first
+            const unsigned int *order = TriangleIndexOrder[fer & 3];
+            const unsigned int a = indices[i + order[0]], b = indices[i + order[1]], c = indices[i + order[2]];
+
+            const int fe = fer >> 2;
+            const int fc = FindVertex(fifo, c);
+
+            int fec = 15;
+            if (fc >= 1 && fc < fecMax) {
+                fec = fc;
+            } else if (c == next) {
+                fec = 0;
+                ++next;
+            } else if (c + 1 == last) {
+                fec = 13;
+            } else if (c == last + 1) {
+                fec = 14;
+            }
+
+            out.push_back(static_cast<uint8_t>((fe << 4) | fec));
+            if (fec == 15) {
+                EncodeIndex(data, c, last);
+            }
+            if (fec >= fecMax) {
+                last = c;
+            }
+
+            fifo.PushVertex(c, fec == 0 || fec >= fecMax);
+            fifo.PushEdge(c, b);
+            fifo.PushEdge(a, c);
+        } else {
+            // a new triangle, rotated so that the next new vertex comes first
+            const int rotation = (indices[i + 1] == next) ? 1 : (indices[i + 2] == next) ? 2 : 0;
+            const unsigned int *order = TriangleIndexOrder[rotation];
+            const unsigned int a = indices[i + order[0]], b = indices[i + order[1]], c = indices[i + order[2]];
+
+            // restart the vertex numbering for a triangle 0, 1, 2
+            bool reset = false;
+            if (a == 0 && b == 1 && c == 2 && next > 0) {
+                reset = true;
+                next = 0;
+                memset(fifo.vertices, -1, sizeof(fifo.vertices));
+            }
+
+            const int fb = FindVertex(fifo, b);
+            const int fc = FindVertex(fifo, c);
+
+            int fea = 15;
+            if (a == next) {
+                fea = 0;
+                ++next;
+            }
+
+            int feb = 15;
+            if (fb >= 0 && fb < 14) {
+                feb = fb + 1;
+            } else if (b == next) {
+                feb = 0;
+                ++next;
+            }
+
+            int fec = 15;
+            if (fc >= 0 && fc < 14) {
+                fec = fc + 1;
+            } else if (c == next) {
+                fec = 0;
+                ++next;
+            }
+
+            const uint8_t codeAux = static_cast<uint8_t>((feb << 4) | fec);
+            int codeAuxIndex = -1;
+            for (int k = 0; k < 14; ++k) {
+                if (CodeAuxTable[k] == codeAux) {
+                    codeAuxIndex = k;
+                    break;
+                }
+            }
+
+            if (fea == 0 && codeAuxIndex >= 0 && !reset) {
+                out.push_back(static_cast<uint8_t>(0xf0 | codeAuxIndex));
+            } else {
+                out.push_back(static_cast<uint8_t>(0xfe | (fea == 15 ? 1 : 0)));
+                data.push_back(codeAux);
+            }
+
+            if (fea == 15) {
+                EncodeIndex(data, a, last);
+                last = a;
+            }
+            if (feb == 15) {
+                EncodeIndex(data, b, last);
+                last = b;
+            }
+            if (fec == 15) {
+                EncodeIndex(data, c, last);
+                last = c;
+            }
+
+            fifo.PushVertex(a);
+            fifo.PushVertex(b, feb == 0 || feb == 15);
+            fifo.PushVertex(c, fec == 0 || fec == 15);
+
+            fifo.PushEdge(b, a);
+            fifo.PushEdge(c, b);
+            fifo.PushEdge(a, c);
+        }
+    }
+
+    // the code table is used by the decoder and serves as padding
+    out.insert(out.end(), data.begin(), data.end());
+    out.insert(out.end(), CodeAuxTable, CodeAuxTable + 16);
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeIndexSequence(std::vector<uint8_t> &out, const uint32_t *indices, size_t count) {
+    out.clear();
+    out.push_back(SequenceHeader | 1);
+
+    unsigned int last[2] = { 0, 0 };
+    unsigned int current = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        const unsigned int index = indices[i];
+
+        // switch the baseline on large jumps, which keeps two interleaved runs cheap
+        const int cd = static_cast<int>(index - last[current]);
+        current ^= ((cd < 0 ? -cd : cd) >= 30) ? 1 : 0;
+
+        const unsigned int d = index - last[current];
+        const unsigned int v = (d << 1) ^ (0u - (d >> 31));
+        EncodeVByte(out, (v << 1) | current);
+
+        last[current] = index;
+    }
+
+    out.resize(out.size() + 4, 0);
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeOctahedralFilter(uint8_t *dst, size_t count, size_t stride, const float *vectors, unsigned int bits) {
+    if (stride == 4) {
+        EncodeOctahedral(reinterpret_cast<int8_t *>(dst), count, vectors, std::max(2u, std::min(bits, 8u)));
+    } else {
+        EncodeOctahedral(reinterpret_cast<int16_t *>(dst), count, vectors, std::max(2u, std::min(bits, 16u)));
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void EncodeExponentialFilter(uint8_t *dst, size_t count, size_t stride, const float *values, unsigned int bits) {
+    bits = std::max(1u, std::min(bits, 24u));
+    const size_t components = stride / 4;
+    const int mantissaLimit = (1 << 23) - 1;
+
+    for (size_t i = 0; i < count; ++i) {
+        const float *v = values + i * components;
+
+        // the largest exponent of the element, so that every mantissa fits into the bits
+        int exp = -100;
+        for (size_t c = 0; c < components; ++c) {
+            int e = 0;
+            if (v[c] != 0.f && std::isfinite(v[c])) {
+                std::frexp(v[c], &e);
+            }
+            exp = std::max(exp, e);
+        }
+        exp -= static_cast<int>(bits) - 1;
+
+        for (size_t c = 0; c < components; ++c) {
+            const float scaled = std::isfinite(v[c]) ? std::ldexp(v[c], -exp) : 0.f;
+            int m = static_cast<int>(scaled + (scaled >= 0.f ? 0.5f : -0.5f));
+            m = std::max(-mantissaLimit, std::min(m, mantissaLimit));
+            const uint32_t encoded = (static_cast<uint32_t>(m) & 0xffffff) | (static_cast<uint32_t>(exp) << 24);
+            memcpy(dst + (i * components + c) * 4, &encoded, 4);
+        }
+    }
+}
+
+} // namespace Meshopt
+} // namespace glTF2
+
+#endif // !ASSIMP_BUILD_NO_GLTF_IMPORTER || !ASSIMP_BUILD_NO_GLTF_EXPORTER
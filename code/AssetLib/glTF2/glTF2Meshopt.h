@@ -0,0 +1,137 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file glTF2Meshopt.h
+ *  Encoder and decoder for the bitstreams of the EXT_meshopt_compression extension.
+ *
+ *  The bitstream format is specified in
+ *  https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Vendor/EXT_meshopt_compression
+ */
+#pragma once
+#ifndef AI_GLTF2MESHOPT_H_INC
+#define AI_GLTF2MESHOPT_H_INC
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace glTF2 {
+namespace Meshopt {
+
+//! Values for the "mode" property of EXT_meshopt_compression
+enum Mode {
+    Mode_Attributes,
+    Mode_Triangles,
+    Mode_Indices
+};
+
+//! Values for the "filter" property of EXT_meshopt_compression
+enum Filter {
+    Filter_None,
+    Filter_Octahedral,
+    Filter_Quaternion,
+    Filter_Exponential
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Decodes a vertex attribute stream (mode ATTRIBUTES).
+ *  @param dst     Receives count * stride bytes.
+ *  @param count   Number of elements.
+ *  @param stride  Element size in bytes, a multiple of 4 up to 256.
+ *  @param src     Encoded data.
+ *  @param srcSize Size of the encoded data in bytes.
+ *  @return false if the encoded data is malformed. */
+bool DecodeVertexBuffer(uint8_t *dst, size_t count, size_t stride, const uint8_t *src, size_t srcSize);
+
+// ------------------------------------------------------------------------------------------------
+/** Decodes a triangle list index stream (mode TRIANGLES).
+ *  @param indexSize Size of an index in bytes, 2 or 4.
+ *  @return false if the encoded data is malformed. */
+bool DecodeIndexBuffer(uint8_t *dst, size_t count, size_t indexSize, const uint8_t *src, size_t srcSize);
+
+// ------------------------------------------------------------------------------------------------
+/** Decodes an index sequence without topology constraints (mode INDICES).
+ *  @param indexSize Size of an index in bytes, 2 or 4.
+ *  @return false if the encoded data is malformed. */
+bool DecodeIndexSequence(uint8_t *dst, size_t count, size_t indexSize, const uint8_t *src, size_t srcSize);
+
+// ------------------------------------------------------------------------------------------------
+/** Applies a decoding filter in place to decoded attribute data.
+ *  @return false if the filter can not be applied to elements of the given stride. */
+bool DecodeFilter(Filter filter, uint8_t *data, size_t count, size_t stride);
+
+// ------------------------------------------------------------------------------------------------
+/** Encodes a vertex attribute stream (mode ATTRIBUTES).
+ *  @param out    Receives the encoded data.
+ *  @param data   count * stride bytes of attribute data.
+ *  @param stride Element size in bytes, a multiple of 4 up to 256. */
+void EncodeVertexBuffer(std::vector<uint8_t> &out, const uint8_t *data, size_t count, size_t stride);
+
+// ------------------------------------------------------------------------------------------------
+/** Encodes a triangle list index stream (mode TRIANGLES). The decoded triangles may start
+ *  with a different vertex, the winding order is kept.
+ *  @param count Number of indices, a multiple of 3. */
+void EncodeIndexBuffer(std::vector<uint8_t> &out, const uint32_t *indices, size_t count);
+
+// ------------------------------------------------------------------------------------------------
+/** Encodes an index sequence without topology constraints (mode INDICES). */
+void EncodeIndexSequence(std::vector<uint8_t> &out, const uint32_t *indices, size_t count);
+
+// ------------------------------------------------------------------------------------------------
+/** Encodes unit vectors for the OCTAHEDRAL filter.
+ *  @param dst     Receives count elements of 4 (stride 4) or 8 (stride 8) bytes.
+ *  @param stride  Element size in bytes, 4 for 8 bit and 8 for 16 bit components.
+ *  @param vectors count * 3 floats.
+ *  @param bits    Bits per component, 2 up to 8 or 16 bits depending on the stride. */
+void EncodeOctahedralFilter(uint8_t *dst, size_t count, size_t stride, const float *vectors, unsigned int bits);
+
+// ------------------------------------------------------------------------------------------------
+/** Encodes floats for the EXPONENTIAL filter, the components of an element share one exponent.
+ *  @param dst    Receives count * stride bytes.
+ *  @param stride Element size in bytes, a multiple of 4.
+ *  @param values count * stride / 4 floats.
+ *  @param bits   Bits of the mantissa including the sign, 1 up to 24. */
+void EncodeExponentialFilter(uint8_t *dst, size_t count, size_t stride, const float *values, unsigned int bits);
+
+} // namespace Meshopt
+} // namespace glTF2
+
+#endif // AI_GLTF2MESHOPT_H_INC
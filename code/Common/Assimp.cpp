@@ -176,6 +176,12 @@ const aiScene *aiImportFileEx(const char *pFile, unsigned int pFlags, aiFileIO *
 // ------------------------------------------------------------------------------------------------
 const aiScene *aiImportFileExWithProperties(const char *pFile, unsigned int pFlags,
         aiFileIO *pFS, const aiPropertyStore *props) {
+    return aiImportFileExWithProperties64(pFile, pFlags, pFS, props);
+}
+
+// ------------------------------------------------------------------------------------------------
+const aiScene *aiImportFileExWithProperties64(const char *pFile, aiPostProcessStepMask pFlags,
+        aiFileIO *pFS, const aiPropertyStore *props) {
     ai_assert(nullptr != pFile);
 
     const aiScene *scene = nullptr;
@@ -199,7 +205,7 @@ const aiScene *aiImportFileExWithProperties(const char *pFile, unsigned int pFla
     }
 
     // and have it read the file
-    scene = imp->ReadFile(pFile, pFlags);
+    scene = imp->ReadFile64(pFile, pFlags);
 
     // if succeeded, store the importer in the scene and keep it alive
     if (scene) {
@@ -233,6 +239,16 @@ const aiScene *aiImportFileFromMemoryWithProperties(
         unsigned int pFlags,
         const char *pHint,
         const aiPropertyStore *props) {
+    return aiImportFileFromMemoryWithProperties64(pBuffer, pLength, pFlags, pHint, props);
+}
+
+// ------------------------------------------------------------------------------------------------
+const aiScene *aiImportFileFromMemoryWithProperties64(
+        const char *pBuffer,
+        unsigned int pLength,
+        aiPostProcessStepMask pFlags,
+        const char *pHint,
+        const aiPropertyStore *props) {
     if (pBuffer == nullptr) {
         return nullptr;
     }
@@ -258,7 +274,7 @@ const aiScene *aiImportFileFromMemoryWithProperties(
     }
 
     // and have it read the file from the memory buffer
-    scene = imp->ReadFileFromMemory(pBuffer, pLength, pFlags, pHint);
+    scene = imp->ReadFileFromMemory64(pBuffer, pLength, pFlags, pHint);
 
     // if succeeded, store the importer in the scene and keep it alive
     if (scene) {
@@ -301,6 +317,12 @@ void aiReleaseImport(const aiScene *pScene) {
 // ------------------------------------------------------------------------------------------------
 ASSIMP_API const aiScene *aiApplyPostProcessing(const aiScene *pScene,
         unsigned int pFlags) {
+    return aiApplyPostProcessing64(pScene, pFlags);
+}
+
+// ------------------------------------------------------------------------------------------------
+ASSIMP_API const aiScene *aiApplyPostProcessing64(const aiScene *pScene,
+        aiPostProcessStepMask pFlags) {
     const aiScene *sc = nullptr;
 
     ASSIMP_BEGIN_EXCEPTION_REGION();
@@ -312,7 +334,7 @@ ASSIMP_API const aiScene *aiApplyPostProcessing(const aiScene *pScene,
         return nullptr;
     }
 
-    sc = priv->mOrigImporter->ApplyPostProcessing(pFlags);
+    sc = priv->mOrigImporter->ApplyPostProcessing64(pFlags);
 
     if (!sc) {
         aiReleaseImport(pScene);
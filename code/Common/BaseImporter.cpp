@@ -53,11 +53,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/Importer.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <ios>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <system_error>
+#include <thread>
+#include <vector>
 
 namespace {
 // Checks whether the passed string is a gcs version.
@@ -516,11 +522,59 @@ struct LoadRequest {
 };
 } // namespace Assimp
 
+// ------------------------------------------------------------------------------------------------
+// IOSystem handed to the Importer of a BatchLoader worker. All calls into the shared IOSystem
+// are serialized, the directory stack is private to the worker.
+namespace {
+class BatchWorkerIOSystem : public IOSystem {
+public:
+    BatchWorkerIOSystem(IOSystem *wrapped, std::mutex &lock) :
+            mWrapped(wrapped), mLock(lock) {
+        ai_assert(nullptr != mWrapped);
+
+        std::lock_guard<std::mutex> guard(mLock);
+        if (mWrapped->StackSize() > 0) {
+            IOSystem::PushDirectory(mWrapped->CurrentDirectory());
+        }
+    }
+
+    ~BatchWorkerIOSystem() override = default;
+
+    bool Exists(const char *pFile) const override {
+        std::lock_guard<std::mutex> guard(mLock);
+        return mWrapped->Exists(pFile);
+    }
+
+    char getOsSeparator() const override {
+        return mWrapped->getOsSeparator();
+    }
+
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override {
+        std::lock_guard<std::mutex> guard(mLock);
+        return mWrapped->Open(pFile, pMode);
+    }
+
+    void Close(IOStream *pFile) override {
+        std::lock_guard<std::mutex> guard(mLock);
+        mWrapped->Close(pFile);
+    }
+
+    bool ComparePaths(const char *one, const char *second) const override {
+        std::lock_guard<std::mutex> guard(mLock);
+        return mWrapped->ComparePaths(one, second);
+    }
+
+private:
+    IOSystem *mWrapped;
+    std::mutex &mLock;
+};
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // BatchLoader::pimpl data structure
 struct Assimp::BatchData {
     BatchData(IOSystem *pIO, bool validate) :
-            pIOSystem(pIO), pImporter(nullptr), next_id(0xffff), validate(validate) {
+            pIOSystem(pIO), pImporter(nullptr), next_id(0xffff), validate(validate), numThreads(1) {
         ai_assert(nullptr != pIO);
 
         pImporter = new Importer();
@@ -535,7 +589,7 @@ struct Assimp::BatchData {
     // IO system to be used for all imports
     IOSystem *pIOSystem;
 
-    // Importer used to load all meshes
+    // Importer used to load all meshes on the calling thread
     Importer *pImporter;
 
     // List of all imports
@@ -549,10 +603,43 @@ struct Assimp::BatchData {
 
     // Validation enabled state
     bool validate;
+
+    // Number of worker threads, 0 means hardware concurrency
+    unsigned int numThreads;
+
+    // Serializes the access of the workers to pIOSystem
+    std::mutex ioLock;
 };
 
 typedef std::list<LoadRequest>::iterator LoadReqIt;
 
+// ------------------------------------------------------------------------------------------------
+// Loads a single request with the given importer and stores the result in the request.
+static void LoadRequestWith(Importer *importer, LoadRequest &req, bool validate) {
+    // force validation in debug builds
+    unsigned int pp = req.flags;
+    if (validate) {
+        pp |= aiProcess_ValidateDataStructure;
+    }
+
+    // setup config properties if necessary
+    ImporterPimpl *pimpl = importer->Pimpl();
+    pimpl->mFloatProperties = req.map.floats;
+    pimpl->mIntProperties = req.map.ints;
+    pimpl->mStringProperties = req.map.strings;
+    pimpl->mMatrixProperties = req.map.matrices;
+
+    if (!DefaultLogger::isNullLogger()) {
+        ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
+        ASSIMP_LOG_INFO("File: ", req.file);
+    }
+    importer->ReadFile(req.file, pp);
+    req.scene = importer->GetOrphanedScene();
+    req.loaded = true;
+
+    ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
+}
+
 // ------------------------------------------------------------------------------------------------
 BatchLoader::BatchLoader(IOSystem *pIO, bool validate) {
     ai_assert(nullptr != pIO);
@@ -579,6 +666,19 @@ bool BatchLoader::getValidation() const {
     return m_data->validate;
 }
 
+// ------------------------------------------------------------------------------------------------
+void BatchLoader::setNumThreads(unsigned int numThreads) {
+    m_data->numThreads = numThreads;
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int BatchLoader::getNumThreads() const {
+    if (m_data->numThreads > 0) {
+        return m_data->numThreads;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
 // ------------------------------------------------------------------------------------------------
 unsigned int BatchLoader::AddLoadRequest(const std::string &file,
         unsigned int steps /*= 0*/, const PropertyMap *map /*= nullptr*/) {
@@ -622,29 +722,53 @@ aiScene *BatchLoader::GetImport(unsigned int which) {
 
 // ------------------------------------------------------------------------------------------------
 void BatchLoader::LoadAll() {
-    // no threaded implementation for the moment
+    std::vector<LoadRequest *> pending;
     for (LoadReqIt it = m_data->requests.begin(); it != m_data->requests.end(); ++it) {
-        // force validation in debug builds
-        unsigned int pp = (*it).flags;
-        if (m_data->validate) {
-            pp |= aiProcess_ValidateDataStructure;
+        if (!(*it).loaded) {
+            pending.push_back(&(*it));
         }
+    }
 
-        // setup config properties if necessary
-        ImporterPimpl *pimpl = m_data->pImporter->Pimpl();
-        pimpl->mFloatProperties = (*it).map.floats;
-        pimpl->mIntProperties = (*it).map.ints;
-        pimpl->mStringProperties = (*it).map.strings;
-        pimpl->mMatrixProperties = (*it).map.matrices;
-
-        if (!DefaultLogger::isNullLogger()) {
-            ASSIMP_LOG_INFO("%%% BEGIN EXTERNAL FILE %%%");
-            ASSIMP_LOG_INFO("File: ", (*it).file);
+    const size_t numWorkers = std::min(static_cast<size_t>(getNumThreads()), pending.size());
+    if (numWorkers <= 1) {
+        for (LoadRequest *req : pending) {
+            LoadRequestWith(m_data->pImporter, *req, m_data->validate);
         }
-        m_data->pImporter->ReadFile((*it).file, pp);
-        (*it).scene = m_data->pImporter->GetOrphanedScene();
-        (*it).loaded = true;
+        return;
+    }
 
-        ASSIMP_LOG_INFO("%%% END EXTERNAL FILE %%%");
+    // Each worker pulls the next request from the queue until it is drained. The results
+    // are stored per request, so the order in which the workers finish does not matter.
+    std::atomic<size_t> next(0);
+    auto worker = [this, &pending, &next]() {
+        Importer importer;
+        importer.SetIOHandler(new BatchWorkerIOSystem(m_data->pIOSystem, m_data->ioLock));
+
+        for (size_t i = next++; i < pending.size(); i = next++) {
+            LoadRequest &req = *pending[i];
+            try {
+                LoadRequestWith(&importer, req, m_data->validate);
+            } catch (const std::exception &e) {
+                ASSIMP_LOG_ERROR("Failed to load external file ", req.file, ": ", e.what());
+                req.scene = nullptr;
+                req.loaded = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numWorkers - 1);
+    for (size_t i = 1; i < numWorkers; ++i) {
+        try {
+            threads.emplace_back(worker);
+        } catch (const std::system_error &e) {
+            // the workers already running and the calling thread drain the queue
+            ASSIMP_LOG_WARN("BatchLoader: Failed to start a worker thread: ", e.what());
+            break;
+        }
+    }
+    worker();
+    for (std::thread &t : threads) {
+        t.join();
     }
 }
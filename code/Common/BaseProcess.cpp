@@ -43,7 +43,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "BaseProcess.h"
 #include "Importer.h"
+#include "ParallelFor.h"
 #include <assimp/BaseImporter.h>
+#include <assimp/config.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
 
@@ -53,7 +55,8 @@ using namespace Assimp;
 // Constructor to be privately used by Importer
 BaseProcess::BaseProcess() AI_NO_EXCEPT
         : shared(),
-          progress() {
+          progress(),
+          numThreads(1) {
     // empty
 }
 
@@ -75,6 +78,9 @@ void BaseProcess::ExecuteOnScene(Importer *pImp) {
         return;
     }
 
+    const int threads = pImp->GetPropertyInteger(AI_CONFIG_PP_NUM_THREADS, 1);
+    numThreads = threads > 0 ? static_cast<unsigned int>(threads) : 0u;
+
     SetupProperties(pImp);
 
     // catch exceptions thrown inside the PostProcess-Step
@@ -101,3 +107,13 @@ void BaseProcess::SetupProperties(const Importer * /*pImp*/) {
 bool BaseProcess::RequireVerboseFormat() const {
     return true;
 }
+
+// ------------------------------------------------------------------------------------------------
+const char *BaseProcess::GetName() const {
+    return "BaseProcess";
+}
+
+// ------------------------------------------------------------------------------------------------
+void BaseProcess::ParallelFor(unsigned int count, const std::function<void(unsigned int)> &func) const {
+    Assimp::ParallelFor(numThreads, count, func);
+}
@@ -44,7 +44,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define INCLUDED_AI_BASEPROCESS_H
 
 #include <assimp/GenericProperty.h>
+#include <assimp/postprocess.h>
 
+#include <functional>
 #include <map>
 
 struct aiScene;
@@ -189,17 +191,23 @@ public:
     /**
      * @brief Returns whether the processing step is present in the given flag.
      * @param pFlags The processing flags the importer was called with. A
-     *   bitwise combination of #aiPostProcessSteps.
+     *   bitwise combination of #aiPostProcessSteps, widened to the 64 bit
+     *   #aiPostProcessStepMask.
      * @return true if the process is present in this flag fields,
      *   false if not.
      */
-    virtual bool IsActive(unsigned int pFlags) const = 0;
+    virtual bool IsActive(aiPostProcessStepMask pFlags) const = 0;
 
     // -------------------------------------------------------------------
     /** Check whether this step expects its input vertex data to be
      *  in verbose format. */
     virtual bool RequireVerboseFormat() const;
 
+    // -------------------------------------------------------------------
+    /** Returns the name of the step, e.g. for profiler regions.
+     *  @return The class name of the step without namespace. */
+    virtual const char *GetName() const;
+
     // -------------------------------------------------------------------
     /**
      * @brief Executes the post processing step on the given imported data.
@@ -242,12 +250,29 @@ public:
         return shared;
     }
 
+protected:
+    // -------------------------------------------------------------------
+    /** Invokes a function for every index in [0, count).
+     *
+     *  The indices are distributed over #AI_CONFIG_PP_NUM_THREADS threads,
+     *  so the function must only touch data belonging to its index (in
+     *  most cases a single mesh). The first exception thrown by any of the
+     *  invocations is rethrown on the calling thread after all threads
+     *  have finished.
+     *  @param count Number of indices to process
+     *  @param func  Function to be called for each index
+     */
+    void ParallelFor(unsigned int count, const std::function<void(unsigned int)> &func) const;
+
 protected:
     /** See the doc of #SharedPostProcessInfo for more details */
     SharedPostProcessInfo *shared;
 
     /** Currently active progress handler */
     ProgressHandler *progress;
+
+    /** Number of threads to be used by ParallelFor(), 0 for hardware concurrency */
+    unsigned int numThreads;
 };
 
 } // end of namespace Assimp
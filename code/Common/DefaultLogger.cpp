@@ -321,9 +321,7 @@ bool DefaultLogger::attachStream(LogStream *pStream, unsigned int severity) {
         severity = SeverityAll;
     }
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
     std::lock_guard<std::mutex> lock(m_arrayMutex);
-#endif
 
     for (StreamIt it = m_StreamArray.begin();
             it != m_StreamArray.end();
@@ -350,9 +348,7 @@ bool DefaultLogger::detachStream(LogStream *pStream, unsigned int severity) {
         severity = SeverityAll;
     }
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
     std::lock_guard<std::mutex> lock(m_arrayMutex);
-#endif
 
     bool res(false);
     for (StreamIt it = m_StreamArray.begin(); it != m_StreamArray.end(); ++it) {
@@ -393,9 +389,7 @@ DefaultLogger::~DefaultLogger() {
 void DefaultLogger::WriteToStreams(const char *message, ErrorSeverity ErrorSev) {
     ai_assert(nullptr != message);
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
     std::lock_guard<std::mutex> lock(m_arrayMutex);
-#endif
 
     // Check whether this is a repeated message
     auto thisLen = ::strlen(message);
@@ -69,6 +69,7 @@ Here we implement only the C++ interface (Assimp::Exporter).
 #include "PostProcessing/JoinVerticesProcess.h"
 #include "PostProcessing/ConvertToLHProcess.h"
 #include "PostProcessing/PretransformVertices.h"
+#include "PostProcessing/ProcessHelper.h"
 
 #include <memory>
 
@@ -359,6 +360,183 @@ const aiExportDataBlob* Exporter::ExportToBlob( const aiScene* pScene, const cha
     return pimpl->blob;
 }
 
+// ------------------------------------------------------------------------------------------------
+// Export pre-processing steps which declare the scene data they modify. Only these can run on a
+// SharedSceneCopy, any other step gets a full deep copy of the scene.
+static const aiPostProcessStepMask SharedCopySteps = aiProcess_FlipUVs | aiProcess_FlipWindingOrder;
+
+// ------------------------------------------------------------------------------------------------
+// Scene copy for the export pipeline which shares its data with the source scene. The node graph
+// and the metadata are always copied, meshes and materials only once a step is going to modify
+// them. Everything else is borrowed from the source scene and handed back on destruction.
+class SharedSceneCopy {
+public:
+    explicit SharedSceneCopy(const aiScene *src);
+    ~SharedSceneCopy();
+
+    aiScene *Get() const {
+        return mScene;
+    }
+
+    // Private copies of the data touched by FlipUVsProcess: uv channels and materials.
+    void DetachUVs();
+
+    // Private copies of the data touched by FlipWindingOrderProcess: faces and anim meshes.
+    void DetachFaces();
+
+private:
+    aiMesh *DetachMesh(unsigned int index);
+    void DetachAnimMeshes(aiMesh *mesh, const aiMesh *src);
+    static void ReleaseMesh(aiMesh *mesh, const aiMesh *src);
+
+    template <typename T>
+    static void ShareArray(T **&dest, unsigned int &numDest, T **src, unsigned int numSrc) {
+        numDest = numSrc;
+        if (numSrc && src) {
+            dest = new T *[numSrc];
+            std::copy(src, src + numSrc, dest);
+        }
+    }
+
+    template <typename T>
+    static void ReleaseArray(T **dest, unsigned int num, T *const *src) {
+        for (unsigned int i = 0; dest && i < num; ++i) {
+            if (dest[i] == src[i]) {
+                dest[i] = nullptr;
+            }
+        }
+    }
+
+    const aiScene *mSource;
+    aiScene *mScene;
+};
+
+// ------------------------------------------------------------------------------------------------
+SharedSceneCopy::SharedSceneCopy(const aiScene *src) :
+        mSource(src), mScene(new aiScene()) {
+    if (nullptr != src->mMetaData) {
+        mScene->mMetaData = new aiMetadata(*src->mMetaData);
+    }
+    SceneCombiner::Copy(&mScene->mRootNode, src->mRootNode);
+    mScene->mFlags = src->mFlags;
+    if (src->mPrivate != nullptr) {
+        ScenePriv(mScene)->mPPStepsApplied = ScenePriv(src)->mPPStepsApplied;
+    }
+
+    ShareArray(mScene->mAnimations, mScene->mNumAnimations, src->mAnimations, src->mNumAnimations);
+    ShareArray(mScene->mTextures, mScene->mNumTextures, src->mTextures, src->mNumTextures);
+    ShareArray(mScene->mMaterials, mScene->mNumMaterials, src->mMaterials, src->mNumMaterials);
+    ShareArray(mScene->mLights, mScene->mNumLights, src->mLights, src->mNumLights);
+    ShareArray(mScene->mCameras, mScene->mNumCameras, src->mCameras, src->mNumCameras);
+    ShareArray(mScene->mMeshes, mScene->mNumMeshes, src->mMeshes, src->mNumMeshes);
+}
+
+// ------------------------------------------------------------------------------------------------
+SharedSceneCopy::~SharedSceneCopy() {
+    for (unsigned int i = 0; mScene->mMeshes && i < mScene->mNumMeshes; ++i) {
+        if (mScene->mMeshes[i] != mSource->mMeshes[i]) {
+            ReleaseMesh(mScene->mMeshes[i], mSource->mMeshes[i]);
+        }
+    }
+    ReleaseArray(mScene->mMeshes, mScene->mNumMeshes, mSource->mMeshes);
+    ReleaseArray(mScene->mAnimations, mScene->mNumAnimations, mSource->mAnimations);
+    ReleaseArray(mScene->mTextures, mScene->mNumTextures, mSource->mTextures);
+    ReleaseArray(mScene->mMaterials, mScene->mNumMaterials, mSource->mMaterials);
+    ReleaseArray(mScene->mLights, mScene->mNumLights, mSource->mLights);
+    ReleaseArray(mScene->mCameras, mScene->mNumCameras, mSource->mCameras);
+    delete mScene;
+}
+
+// ------------------------------------------------------------------------------------------------
+void SharedSceneCopy::DetachUVs() {
+    for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
+        const aiMesh *src = mSource->mMeshes[i];
+        aiMesh *mesh = DetachMesh(i);
+        // the stream holds the unflipped coordinates, it is left to the source mesh
+        mesh->mVertexStream = nullptr;
+        for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++n) {
+            if (nullptr != src->mTextureCoords[n] && mesh->mTextureCoords[n] == src->mTextureCoords[n]) {
+                mesh->mTextureCoords[n] = new aiVector3D[mesh->mNumVertices];
+                std::copy(src->mTextureCoords[n], src->mTextureCoords[n] + mesh->mNumVertices, mesh->mTextureCoords[n]);
+            }
+        }
+        DetachAnimMeshes(mesh, src);
+    }
+
+    for (unsigned int i = 0; i < mScene->mNumMaterials; ++i) {
+        if (mScene->mMaterials[i] == mSource->mMaterials[i]) {
+            SceneCombiner::Copy(&mScene->mMaterials[i], mSource->mMaterials[i]);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void SharedSceneCopy::DetachFaces() {
+    for (unsigned int i = 0; i < mScene->mNumMeshes; ++i) {
+        const aiMesh *src = mSource->mMeshes[i];
+        aiMesh *mesh = DetachMesh(i);
+        if (nullptr != src->mFaces && mesh->mFaces == src->mFaces) {
+            mesh->mFaces = new aiFace[mesh->mNumFaces];
+            std::copy(src->mFaces, src->mFaces + mesh->mNumFaces, mesh->mFaces);
+        }
+        DetachAnimMeshes(mesh, src);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Replaces a shared mesh by a flat copy whose arrays still point into the source mesh.
+aiMesh *SharedSceneCopy::DetachMesh(unsigned int index) {
+    aiMesh *&mesh = mScene->mMeshes[index];
+    if (mesh == mSource->mMeshes[index]) {
+        aiMesh *copy = new aiMesh();
+        *copy = *mesh;
+        mesh = copy;
+    }
+    return mesh;
+}
+
+// ------------------------------------------------------------------------------------------------
+void SharedSceneCopy::DetachAnimMeshes(aiMesh *mesh, const aiMesh *src) {
+    if (0 == src->mNumAnimMeshes || nullptr == src->mAnimMeshes || mesh->mAnimMeshes != src->mAnimMeshes) {
+        return;
+    }
+    mesh->mAnimMeshes = new aiAnimMesh *[src->mNumAnimMeshes];
+    for (unsigned int i = 0; i < src->mNumAnimMeshes; ++i) {
+        SceneCombiner::Copy(&mesh->mAnimMeshes[i], src->mAnimMeshes[i]);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Drops the arrays of a detached mesh which are still owned by the source mesh.
+void SharedSceneCopy::ReleaseMesh(aiMesh *mesh, const aiMesh *src) {
+    auto release = [](auto *&ptr, const auto *shared) {
+        if (ptr == shared) {
+            ptr = nullptr;
+        }
+    };
+    release(mesh->mVertices, src->mVertices);
+    release(mesh->mNormals, src->mNormals);
+    release(mesh->mTangents, src->mTangents);
+    release(mesh->mBitangents, src->mBitangents);
+    release(mesh->mFaces, src->mFaces);
+    release(mesh->mBones, src->mBones);
+    release(mesh->mAnimMeshes, src->mAnimMeshes);
+    release(mesh->mTextureCoordsNames, src->mTextureCoordsNames);
+    release(mesh->mVertexStream, src->mVertexStream);
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++n) {
+        release(mesh->mTextureCoords[n], src->mTextureCoords[n]);
+    }
+    for (unsigned int n = 0; n < AI_MAX_NUMBER_OF_COLOR_SETS; ++n) {
+        release(mesh->mColors[n], src->mColors[n]);
+    }
+    if (nullptr == mesh->mBones) {
+        mesh->mNumBones = 0;
+    }
+    if (nullptr == mesh->mAnimMeshes) {
+        mesh->mNumAnimMeshes = 0;
+    }
+}
+
 // ------------------------------------------------------------------------------------------------
 aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const char* pPath,
         unsigned int pPreprocessing, const ExportProperties* pProperties) {
@@ -377,23 +555,15 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
         const Exporter::ExportFormatEntry& exp = pimpl->mExporters[i];
         if (!strcmp(exp.mDescription.id,pFormatId)) {
             try {
-                // Always create a full copy of the scene. We might optimize this one day,
-                // but for now it is the most pragmatic way.
-                aiScene* scenecopy_tmp = nullptr;
-                SceneCombiner::CopyScene(&scenecopy_tmp,pScene);
-
-                pimpl->mProgressHandler->UpdateFileWrite(1, 4);
-
-                std::unique_ptr<aiScene> scenecopy(scenecopy_tmp);
                 const ScenePrivateData* const priv = ScenePriv(pScene);
 
                 // steps that are not idempotent, i.e. we might need to run them again, usually to get back to the
                 // original state before the step was applied first. When checking which steps we don't need
                 // to run, those are excluded.
-                const unsigned int nonIdempotentSteps = aiProcess_FlipWindingOrder | aiProcess_FlipUVs | aiProcess_MakeLeftHanded;
+                const aiPostProcessStepMask nonIdempotentSteps = aiProcess_FlipWindingOrder | aiProcess_FlipUVs | aiProcess_MakeLeftHanded;
 
                 // Erase all pp steps that were already applied to this scene
-                const unsigned int pp = (exp.mEnforcePP | pPreprocessing) & ~(priv && !priv->mIsCopy
+                const aiPostProcessStepMask pp = (exp.mEnforcePP | pPreprocessing) & ~(priv && !priv->mIsCopy
                     ? (priv->mPPStepsApplied & ~nonIdempotentSteps)
                     : 0u);
 
@@ -406,9 +576,8 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
 
                 // If the input scene is not in verbose format, but there is at least post-processing step that relies on it,
                 // we need to run the MakeVerboseFormat step first.
-                bool must_join_again = false;
+                bool verbosify = false;
                 if (!is_verbose_format) {
-                    bool verbosify = false;
                     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++) {
                         BaseProcess* const p = pimpl->mPostProcessingSteps[a];
 
@@ -417,41 +586,78 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                             break;
                         }
                     }
+                    verbosify = verbosify || (exp.mEnforcePP & aiProcess_JoinIdenticalVertices);
+                }
 
-                    if (verbosify || (exp.mEnforcePP & aiProcess_JoinIdenticalVertices)) {
-                        ASSIMP_LOG_DEBUG("export: Scene data not in verbose format, applying MakeVerboseFormat step first");
+                // Create a full copy of the scene, unless the caller asked for copy-on-write and all
+                // steps we are going to run declare the data they modify.
+                const bool copyOnWrite = nullptr != pProperties && pProperties->GetPropertyBool(AI_CONFIG_EXPORT_COPY_ON_WRITE);
+                std::unique_ptr<aiScene> scenecopy;
+                std::unique_ptr<SharedSceneCopy> sharedcopy;
+                if (copyOnWrite && !verbosify && !(pp & ~SharedCopySteps)) {
+                    ASSIMP_LOG_DEBUG("export: Sharing scene data with the source scene");
+                    sharedcopy.reset(new SharedSceneCopy(pScene));
+                    if (pp & aiProcess_FlipUVs) {
+                        sharedcopy->DetachUVs();
+                    }
+                    if (pp & aiProcess_FlipWindingOrder) {
+                        sharedcopy->DetachFaces();
+                    }
+                } else {
+                    aiScene* scenecopy_tmp = nullptr;
+                    SceneCombiner::CopyScene(&scenecopy_tmp,pScene);
+                    scenecopy.reset(scenecopy_tmp);
+                }
+                aiScene* const scene = sharedcopy ? sharedcopy->Get() : scenecopy.get();
 
-                        MakeVerboseFormatProcess proc;
-                        proc.Execute(scenecopy.get());
+                pimpl->mProgressHandler->UpdateFileWrite(1, 4);
 
-                        if(!(exp.mEnforcePP & aiProcess_JoinIdenticalVertices)) {
-                            must_join_again = true;
-                        }
+                // only glTF2 stores mesh instances, all other formats get one node per instance
+                if (strcmp(exp.mDescription.id, "gltf2") && strcmp(exp.mDescription.id, "glb2")) {
+                    if (const unsigned int instanced = ExpandNodeInstances(scene->mRootNode)) {
+                        ASSIMP_LOG_DEBUG("export: Expanded the mesh instances of ", instanced, " nodes");
+                    }
+                }
+
+                bool must_join_again = false;
+                if (verbosify) {
+                    ASSIMP_LOG_DEBUG("export: Scene data not in verbose format, applying MakeVerboseFormat step first");
+
+                    MakeVerboseFormatProcess proc;
+                    proc.Execute(scene);
+
+                    if(!(exp.mEnforcePP & aiProcess_JoinIdenticalVertices)) {
+                        must_join_again = true;
                     }
                 }
 
                 pimpl->mProgressHandler->UpdateFileWrite(2, 4);
 
                 if (pp) {
+                    // a shared copy drops the stale streams of the meshes it detaches
+                    if (!sharedcopy) {
+                        DropVertexStreams(scene, pp);
+                    }
+
                     // the three 'conversion' steps need to be executed first because all other steps rely on the standard data layout
                     {
                         FlipWindingOrderProcess step;
                         if (step.IsActive(pp)) {
-                            step.Execute(scenecopy.get());
+                            step.Execute(scene);
                         }
                     }
 
                     {
                         FlipUVsProcess step;
                         if (step.IsActive(pp)) {
-                            step.Execute(scenecopy.get());
+                            step.Execute(scene);
                         }
                     }
 
                     {
                         MakeLeftHandedProcess step;
                         if (step.IsActive(pp)) {
-                            step.Execute(scenecopy.get());
+                            step.Execute(scene);
                         }
                     }
 
@@ -471,10 +677,10 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
                             if (dynamic_cast<PretransformVertices*>(p) && exportPointCloud) {
                                 continue;
                             }
-                            p->Execute(scenecopy.get());
+                            p->Execute(scene);
                         }
                     }
-                    ScenePrivateData* const privOut = ScenePriv(scenecopy.get());
+                    ScenePrivateData* const privOut = ScenePriv(scene);
                     ai_assert(nullptr != privOut);
 
                     privOut->mPPStepsApplied |= pp;
@@ -484,13 +690,13 @@ aiReturn Exporter::Export( const aiScene* pScene, const char* pFormatId, const c
 
                 if(must_join_again) {
                     JoinVerticesProcess proc;
-                    proc.Execute(scenecopy.get());
+                    proc.Execute(scene);
                 }
 
                 ExportProperties emptyProperties;  // Never pass nullptr ExportProperties so Exporters don't have to worry.
                 ExportProperties* pProp = pProperties ? (ExportProperties*)pProperties : &emptyProperties;
         		pProp->SetPropertyBool("bJoinIdenticalVertices", pp & aiProcess_JoinIdenticalVertices);
-                exp.mExportFunction(pPath,pimpl->mIOSystem.get(),scenecopy.get(), pProp);
+                exp.mExportFunction(pPath,pimpl->mIOSystem.get(),scene, pProp);
 
                 pimpl->mProgressHandler->UpdateFileWrite(4, 4);
             } catch (DeadlyExportError& err) {
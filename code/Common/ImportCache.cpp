@@ -0,0 +1,571 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ImportCache.cpp
+ *  @brief Implementation of the persistent import cache
+ */
+
+#include "Common/ImportCache.h"
+#include "Common/Importer.h"
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/GenericProperty.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/SceneCombiner.h>
+#include <assimp/SceneSnapshot.h>
+#include <assimp/StringUtils.h>
+#include <assimp/config.h>
+#include <assimp/scene.h>
+#include <assimp/version.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace Assimp;
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const char *SnapshotExtension = ".assnap";
+const char *DependencyExtension = ".deps";
+
+// ------------------------------------------------------------------------------------------------
+// Incremental xxHash64, fast enough to check the files of an entry on every hit.
+class Hash64 {
+public:
+    Hash64() :
+            mTotal(0), mMemSize(0) {
+        mAcc[0] = P1 + P2;
+        mAcc[1] = P2;
+        mAcc[2] = 0;
+        mAcc[3] = 0 - P1;
+    }
+
+    void Update(const void *data, size_t len) {
+        const uint8_t *p = static_cast<const uint8_t *>(data);
+        const uint8_t *const end = p + len;
+        mTotal += len;
+
+        if (mMemSize + len < 32) {
+            ::memcpy(mMem + mMemSize, p, len);
+            mMemSize += len;
+            return;
+        }
+        if (mMemSize > 0) {
+            const size_t fill = 32 - mMemSize;
+            ::memcpy(mMem + mMemSize, p, fill);
+            Consume(mMem);
+            p += fill;
+            mMemSize = 0;
+        }
+        for (; p + 32 <= end; p += 32) {
+            Consume(p);
+        }
+        mMemSize = end - p;
+        ::memcpy(mMem, p, mMemSize);
+    }
+
+    template <class T>
+    void Add(const T &value) {
+        Update(&value, sizeof(value));
+    }
+
+    uint64_t Digest() const {
+        uint64_t h;
+        if (mTotal >= 32) {
+            h = Rotl(mAcc[0], 1) + Rotl(mAcc[1], 7) + Rotl(mAcc[2], 12) + Rotl(mAcc[3], 18);
+            for (uint64_t acc : mAcc) {
+                h ^= Round(0, acc);
+                h = h * P1 + P4;
+            }
+        } else {
+            h = P5;
+        }
+        h += mTotal;
+
+        const uint8_t *p = mMem;
+        const uint8_t *const end = mMem + mMemSize;
+        for (; p + 8 <= end; p += 8) {
+            h ^= Round(0, Read<uint64_t>(p));
+            h = Rotl(h, 27) * P1 + P4;
+        }
+        if (p + 4 <= end) {
+            h ^= Read<uint32_t>(p) * P1;
+            h = Rotl(h, 23) * P2 + P3;
+            p += 4;
+        }
+        for (; p < end; ++p) {
+            h ^= *p * P5;
+            h = Rotl(h, 11) * P1;
+        }
+
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+        return h;
+    }
+
+private:
+    static constexpr uint64_t P1 = 11400714785074694791ULL;
+    static constexpr uint64_t P2 = 14029467366897019727ULL;
+    static constexpr uint64_t P3 = 1609587929392839161ULL;
+    static constexpr uint64_t P4 = 9650029242287828579ULL;
+    static constexpr uint64_t P5 = 2870177450012600261ULL;
+
+    static uint64_t Rotl(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static uint64_t Round(uint64_t acc, uint64_t input) {
+        acc += input * P2;
+        return Rotl(acc, 31) * P1;
+    }
+
+    template <class T>
+    static uint64_t Read(const uint8_t *p) {
+        T value;
+        ::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    void Consume(const uint8_t *p) {
+        for (int i = 0; i < 4; ++i) {
+            mAcc[i] = Round(mAcc[i], Read<uint64_t>(p + i * 8));
+        }
+    }
+
+    uint64_t mAcc[4];
+    uint64_t mTotal;
+    uint8_t mMem[32];
+    size_t mMemSize;
+};
+
+std::string ToHex(uint64_t value) {
+    static const char digits[] = "0123456789abcdef";
+    std::string out(16, '0');
+    for (int i = 15; i >= 0; --i, value >>= 4) {
+        out[i] = digits[value & 0xf];
+    }
+    return out;
+}
+
+// Properties which do not change the imported scene or are set by the import itself.
+bool IsIgnoredProperty(ImporterPimpl::KeyType key) {
+    static const ImporterPimpl::KeyType ignored[] = {
+        SuperFastHash(AI_CONFIG_IMPORT_CACHE_DIRECTORY),
+        SuperFastHash(AI_CONFIG_IMPORT_CACHE_MAX_SIZE),
+        SuperFastHash(AI_CONFIG_GLOB_MEASURE_TIME),
+        SuperFastHash(AI_CONFIG_IMPORT_NUM_THREADS),
+        SuperFastHash(AI_CONFIG_PP_NUM_THREADS),
+        SuperFastHash(AI_CONFIG_APP_SCALE_KEY),
+        SuperFastHash("importerIndex"),
+        SuperFastHash("sourceFilePath")
+    };
+    return std::find(std::begin(ignored), std::end(ignored), key) != std::end(ignored);
+}
+
+// Hashes the contents of a file read through an IO system.
+bool HashFile(IOSystem *io, const std::string &file, uint64_t &size, uint64_t &hash) {
+    IOStream *stream = io->Open(file.c_str(), "rb");
+    if (nullptr == stream) {
+        return false;
+    }
+    Hash64 content;
+    size = stream->FileSize();
+    size_t read = 0;
+    if (const uint8_t *mapped = stream->GetMappedData()) {
+        content.Update(mapped, size);
+        read = size;
+    } else {
+        std::vector<uint8_t> buffer(std::min<size_t>(size, 1 << 20));
+        while (read < size) {
+            const size_t num = stream->Read(buffer.data(), 1, std::min(buffer.size(), size - read));
+            if (0 == num) {
+                break;
+            }
+            content.Update(buffer.data(), num);
+            read += num;
+        }
+    }
+    io->Close(stream);
+    hash = content.Digest();
+    return read == size;
+}
+
+// Reads the dependency list of an entry and checks it against the current files.
+bool CheckDependencies(const std::string &path, IOSystem *io, int &importerIndex) {
+    std::ifstream in(path, std::ios::binary);
+    std::string line;
+    if (!std::getline(in, line) || 0 != line.compare(0, 9, "importer ")) {
+        return false;
+    }
+    importerIndex = ::atoi(line.c_str() + 9);
+
+    while (std::getline(in, line)) {
+        const std::string::size_type space = line.find(' ');
+        if (std::string::npos == space) {
+            return false;
+        }
+        const std::string access = line.substr(0, space);
+        const std::string file = line.substr(space + 1);
+        if (access == "missing" || access == "present") {
+            if (io->Exists(file.c_str()) != (access == "present")) {
+                return false;
+            }
+            continue;
+        }
+        if (access != "read") {
+            return false;
+        }
+
+        // read <size> <hash> <file>
+        std::istringstream fields(file);
+        uint64_t size = 0, hash = 0;
+        std::string name;
+        fields >> size >> std::hex >> hash;
+        fields.get();
+        std::getline(fields, name);
+        uint64_t actualSize = 0, actualHash = 0;
+        if (!fields || name.empty() || !HashFile(io, name, actualSize, actualHash) || actualSize != size || actualHash != hash) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class Map, class Fn>
+void HashProperties(Hash64 &hash, const Map &properties, Fn addValue) {
+    size_t count = 0;
+    for (const auto &property : properties) {
+        if (!IsIgnoredProperty(property.first)) {
+            hash.Add(property.first);
+            addValue(property.second);
+            ++count;
+        }
+    }
+    // separates the property maps
+    hash.Add(count);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+RecordingIOSystem::RecordingIOSystem(IOSystem *wrapped) :
+        mWrapped(wrapped) {
+    ai_assert(nullptr != mWrapped);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RecordingIOSystem::Exists(const char *pFile) const {
+    const bool exists = mWrapped->Exists(pFile);
+    Record(pFile, exists ? Present : Missing);
+    return exists;
+}
+
+// ------------------------------------------------------------------------------------------------
+char RecordingIOSystem::getOsSeparator() const {
+    return mWrapped->getOsSeparator();
+}
+
+// ------------------------------------------------------------------------------------------------
+IOStream *RecordingIOSystem::Open(const char *pFile, const char *pMode) {
+    IOStream *stream = mWrapped->Open(pFile, pMode);
+    // files written during the import are no dependencies
+    if (nullptr != pMode && nullptr == ::strpbrk(pMode, "wa+")) {
+        Record(pFile, nullptr != stream ? Read : Missing);
+    }
+    return stream;
+}
+
+// ------------------------------------------------------------------------------------------------
+void RecordingIOSystem::Close(IOStream *pFile) {
+    mWrapped->Close(pFile);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RecordingIOSystem::ComparePaths(const char *one, const char *second) const {
+    return mWrapped->ComparePaths(one, second);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RecordingIOSystem::PushDirectory(const std::string &path) {
+    return mWrapped->PushDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+const std::string &RecordingIOSystem::CurrentDirectory() const {
+    return mWrapped->CurrentDirectory();
+}
+
+// ------------------------------------------------------------------------------------------------
+size_t RecordingIOSystem::StackSize() const {
+    return mWrapped->StackSize();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RecordingIOSystem::PopDirectory() {
+    return mWrapped->PopDirectory();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RecordingIOSystem::CreateDirectory(const std::string &path) {
+    return mWrapped->CreateDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RecordingIOSystem::ChangeDirectory(const std::string &path) {
+    return mWrapped->ChangeDirectory(path);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool RecordingIOSystem::DeleteFile(const std::string &file) {
+    return mWrapped->DeleteFile(file);
+}
+
+// ------------------------------------------------------------------------------------------------
+std::map<std::string, RecordingIOSystem::Access> RecordingIOSystem::GetFiles() const {
+    std::lock_guard<std::mutex> guard(mLock);
+    return mFiles;
+}
+
+// ------------------------------------------------------------------------------------------------
+void RecordingIOSystem::Record(const char *file, Access access) const {
+    if (nullptr == file) {
+        return;
+    }
+    // a file which was read stays read, one which was found stays present
+    std::lock_guard<std::mutex> guard(mLock);
+    Access &entry = mFiles.emplace(file, access).first->second;
+    entry = std::max(entry, access);
+}
+
+// ------------------------------------------------------------------------------------------------
+ImportCache::ImportCache(const std::string &directory, uint64_t maxSize) :
+        mDirectory(directory),
+        mMaxSize(maxSize) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ImportCache::GetKey(const std::string &file, aiPostProcessStepMask flags, const ImporterPimpl &pimpl) const {
+    if (!pimpl.mPointerProperties.empty()) {
+        ASSIMP_LOG_DEBUG("ImportCache: pointer properties are set, the import is not cached");
+        return std::string();
+    }
+
+    // the contents of the file are checked by Load(), together with all other files the import read
+    Hash64 name;
+    name.Update(file.data(), file.size());
+
+    Hash64 settings;
+    settings.Add(flags);
+    settings.Add(aiGetVersionMajor());
+    settings.Add(aiGetVersionMinor());
+    settings.Add(aiGetVersionPatch());
+    settings.Add(aiGetVersionRevision());
+    settings.Add(aiGetCompileFlags());
+    HashProperties(settings, pimpl.mIntProperties, [&settings](int value) {
+        settings.Add(value);
+    });
+    HashProperties(settings, pimpl.mFloatProperties, [&settings](ai_real value) {
+        settings.Add(value);
+    });
+    HashProperties(settings, pimpl.mStringProperties, [&settings](const std::string &value) {
+        settings.Add(value.size());
+        settings.Update(value.data(), value.size());
+    });
+    HashProperties(settings, pimpl.mMatrixProperties, [&settings](const aiMatrix4x4 &value) {
+        settings.Add(value);
+    });
+
+    return ToHex(name.Digest()) + ToHex(settings.Digest());
+}
+
+// ------------------------------------------------------------------------------------------------
+aiScene *ImportCache::Load(const std::string &key, IOSystem *io, int &importerIndex) const {
+    const std::string path = GetPath(key, SnapshotExtension);
+    std::error_code ec;
+    if (!fs::is_regular_file(path, ec)) {
+        return nullptr;
+    }
+    if (!CheckDependencies(GetPath(key, DependencyExtension), io, importerIndex)) {
+        // the entry will be replaced by the next import
+        ASSIMP_LOG_DEBUG("ImportCache: the files read for ", key, " have changed");
+        return nullptr;
+    }
+
+    SceneSnapshot snapshot;
+    if (!snapshot.Open(path.c_str())) {
+        // written by another build, it will be replaced
+        fs::remove(path, ec);
+        fs::remove(GetPath(key, DependencyExtension), ec);
+        return nullptr;
+    }
+
+    aiScene *scene = nullptr;
+    SceneCombiner::CopyScene(&scene, snapshot.GetScene());
+
+    // the modification time orders the entries for eviction
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return scene;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool ImportCache::Store(const std::string &key, const aiScene *scene, const RecordingIOSystem &files, int importerIndex) const {
+    // the files are hashed as they are after the import
+    std::string dependencies = "importer " + ai_to_string(importerIndex) + "\n";
+    for (const auto &file : files.GetFiles()) {
+        if (std::string::npos != file.first.find_first_of("\r\n")) {
+            return false;
+        }
+        switch (file.second) {
+        case RecordingIOSystem::Missing:
+            dependencies += "missing " + file.first + "\n";
+            break;
+        case RecordingIOSystem::Present:
+            dependencies += "present " + file.first + "\n";
+            break;
+        case RecordingIOSystem::Read: {
+            uint64_t size = 0, hash = 0;
+            if (!HashFile(files.GetWrapped(), file.first, size, hash)) {
+                return false;
+            }
+            dependencies += "read " + ai_to_string(size) + " " + ToHex(hash) + " " + file.first + "\n";
+            break;
+        }
+        }
+    }
+
+    std::error_code ec;
+    fs::create_directories(mDirectory, ec);
+
+    // write to files of our own first, concurrent imports may store the same key
+    const std::string path = GetPath(key, SnapshotExtension);
+    const std::string list = GetPath(key, DependencyExtension);
+    const std::string suffix = ".tmp" + ai_to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) +
+            ai_to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    DefaultIOSystem io;
+    IOStream *stream = io.Open((path + suffix).c_str(), "wb");
+    if (nullptr == stream) {
+        ASSIMP_LOG_WARN("ImportCache: unable to write ", path + suffix);
+        return false;
+    }
+    bool written = SceneSnapshot::Write(scene, stream);
+    io.Close(stream);
+    stream = io.Open((list + suffix).c_str(), "wb");
+    if (nullptr != stream) {
+        written = written && 1 == stream->Write(dependencies.data(), dependencies.size(), 1);
+        io.Close(stream);
+    } else {
+        written = false;
+    }
+
+    if (written && fs::file_size(path + suffix, ec) <= mMaxSize) {
+        fs::rename(list + suffix, list, ec);
+        if (!ec) {
+            fs::rename(path + suffix, path, ec);
+        }
+        if (!ec) {
+            Evict();
+            return true;
+        }
+    }
+    fs::remove(path + suffix, ec);
+    fs::remove(list + suffix, ec);
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+std::string ImportCache::GetPath(const std::string &key, const char *extension) const {
+    return (fs::path(mDirectory) / (key + extension)).string();
+}
+
+// ------------------------------------------------------------------------------------------------
+// Removes the least recently used entries until the cache fits into its maximum size.
+void ImportCache::Evict() const {
+    struct Entry {
+        fs::file_time_type mTime;
+        uint64_t mSize;
+        fs::path mPath;
+    };
+    std::vector<Entry> entries;
+    uint64_t total = 0;
+
+    std::error_code ec;
+    for (fs::directory_iterator it(mDirectory, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() != SnapshotExtension || !it->is_regular_file(ec)) {
+            continue;
+        }
+        Entry entry{ it->last_write_time(ec), it->file_size(ec), it->path() };
+        if (!ec) {
+            total += entry.mSize;
+            entries.push_back(std::move(entry));
+        }
+    }
+    if (total <= mMaxSize) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+        return a.mTime < b.mTime;
+    });
+    for (const Entry &entry : entries) {
+        if (total <= mMaxSize) {
+            break;
+        }
+        if (fs::remove(entry.mPath, ec)) {
+            fs::remove(fs::path(entry.mPath).replace_extension(DependencyExtension), ec);
+            total -= entry.mSize;
+            ASSIMP_LOG_DEBUG("ImportCache: evicted ", entry.mPath.string());
+        }
+    }
+}
@@ -0,0 +1,166 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ImportCache.h
+ *  @brief Persistent cache of post-processed scenes used by Importer::ReadFile()
+ */
+#pragma once
+#ifndef INCLUDED_AI_IMPORT_CACHE_H
+#define INCLUDED_AI_IMPORT_CACHE_H
+
+#include <assimp/defs.h>
+#include <assimp/postprocess.h>
+#include <assimp/IOSystem.hpp>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+struct aiScene;
+
+namespace Assimp {
+
+class ImporterPimpl;
+
+// ---------------------------------------------------------------------------
+/** @brief IO system which records the files an import looks at.
+ *
+ *  All calls are passed to the wrapped IO system. Files opened for reading
+ *  and files which were looked for but not found are recorded, they are the
+ *  dependencies of the import stored with its cache entry. */
+class ASSIMP_API RecordingIOSystem : public IOSystem {
+public:
+    /// @brief How an import used a file.
+    enum Access {
+        Missing,
+        Present,
+        Read
+    };
+
+    /// @brief  The class constructor.
+    /// @param wrapped      The IO system to pass all calls to.
+    explicit RecordingIOSystem(IOSystem *wrapped);
+
+    bool Exists(const char *pFile) const override;
+    char getOsSeparator() const override;
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override;
+    void Close(IOStream *pFile) override;
+    bool ComparePaths(const char *one, const char *second) const override;
+    bool PushDirectory(const std::string &path) override;
+    const std::string &CurrentDirectory() const override;
+    size_t StackSize() const override;
+    bool PopDirectory() override;
+    bool CreateDirectory(const std::string &path) override;
+    bool ChangeDirectory(const std::string &path) override;
+    bool DeleteFile(const std::string &file) override;
+
+    /// @brief Returns the wrapped IO system.
+    IOSystem *GetWrapped() const {
+        return mWrapped;
+    }
+
+    /// @brief Returns the recorded files, importers may open files on
+    ///        worker threads, so the map is copied under the lock.
+    std::map<std::string, Access> GetFiles() const;
+
+private:
+    void Record(const char *file, Access access) const;
+
+    IOSystem *mWrapped;
+    mutable std::mutex mLock;
+    mutable std::map<std::string, Access> mFiles;
+};
+
+// ---------------------------------------------------------------------------
+/** @brief Directory of scene snapshots.
+ *
+ *  Each entry is a SceneSnapshot named after the key of the import which
+ *  produced it, together with a list of the files the import read. The key
+ *  only covers the main file name and the settings of the import, an entry is
+ *  used only if all files it depends on still have the same contents.
+ *  Reading an entry marks it as recently used, storing one removes the least
+ *  recently used entries once the directory exceeds its maximum size. */
+class ASSIMP_API ImportCache {
+public:
+    /// @brief  The class constructor.
+    /// @param directory    The cache directory.
+    /// @param maxSize      The maximum size of all entries in bytes.
+    ImportCache(const std::string &directory, uint64_t maxSize);
+
+    // -------------------------------------------------------------------
+    /** @brief Computes the key of an import, no file is read.
+     *  @param file     The file to import.
+     *  @param flags    The post-processing flags of the import.
+     *  @param pimpl    The importer holding the properties of the import.
+     *  @return The key, empty if the import cannot be cached. */
+    std::string GetKey(const std::string &file, aiPostProcessStepMask flags, const ImporterPimpl &pimpl) const;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns a copy of the scene stored for a key.
+     *  @param key              The key of the import.
+     *  @param io               The IO system to check the dependencies with.
+     *  @param importerIndex    Receives the index of the importer which
+     *                          read the stored scene.
+     *  @return The scene, nullptr if there is no entry or one of the
+     *          files the entry depends on has changed. */
+    aiScene *Load(const std::string &key, IOSystem *io, int &importerIndex) const;
+
+    // -------------------------------------------------------------------
+    /** @brief Stores a scene for a key and evicts old entries.
+     *  @param key              The key of the import.
+     *  @param scene            The post-processed scene.
+     *  @param files            The files recorded during the import.
+     *  @param importerIndex    The index of the importer which read the scene.
+     *  @return false if the entry could not be written. */
+    bool Store(const std::string &key, const aiScene *scene, const RecordingIOSystem &files, int importerIndex) const;
+
+private:
+    std::string GetPath(const std::string &key, const char *extension) const;
+    void Evict() const;
+
+    std::string mDirectory;
+    uint64_t mMaxSize;
+};
+
+} // namespace Assimp
+
+#endif // INCLUDED_AI_IMPORT_CACHE_H
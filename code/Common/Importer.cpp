@@ -65,6 +65,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Common/Importer.h"
 #include "Common/BaseProcess.h"
 #include "Common/DefaultProgressHandler.h"
+#include "Common/ImportCache.h"
 #include "PostProcessing/ProcessHelper.h"
 #include "Common/ScenePreprocessor.h"
 #include "Common/ScenePrivate.h"
@@ -75,9 +76,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Profiler.h>
 #include <assimp/TinyFormatter.h>
 #include <assimp/Exceptional.h>
-#include <assimp/Profiler.h>
 #include <assimp/commonMetaData.h>
 
+#include <algorithm>
 #include <exception>
 #include <set>
 #include <memory>
@@ -193,6 +194,9 @@ Importer::~Importer() {
     // Delete shared post-processing data
     delete pimpl->mPPShared;
 
+    // Delete the collected timings
+    delete pimpl->mProfiler;
+
     // and finally the pimpl itself
     delete pimpl;
 }
@@ -365,7 +369,7 @@ bool Importer::IsDefaultProgressHandler() const {
 
 // ------------------------------------------------------------------------------------------------
 // Validate post process step flags
-bool _ValidateFlags(unsigned int pFlags) {
+bool _ValidateFlags(aiPostProcessStepMask pFlags) {
     if (pFlags & aiProcess_GenSmoothNormals && pFlags & aiProcess_GenNormals)   {
         ASSIMP_LOG_ERROR("#aiProcess_GenSmoothNormals and #aiProcess_GenNormals are incompatible");
         return false;
@@ -444,6 +448,12 @@ aiScene* Importer::GetOrphanedScene() {
 // ------------------------------------------------------------------------------------------------
 // Validate post-processing flags
 bool Importer::ValidateFlags(unsigned int pFlags) const {
+    return ValidateFlags64(pFlags);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Validate post-processing flags, 64 bit version
+bool Importer::ValidateFlags64(aiPostProcessStepMask pFlags) const {
     ASSIMP_BEGIN_EXCEPTION_REGION();
     // run basic checks for mutually exclusive flags
     if(!_ValidateFlags(pFlags)) {
@@ -456,11 +466,11 @@ bool Importer::ValidateFlags(unsigned int pFlags) const {
         return false;
     }
 #endif
-    pFlags &= ~aiProcess_ValidateDataStructure;
+    pFlags &= ~static_cast<aiPostProcessStepMask>(aiProcess_ValidateDataStructure);
 
     // Now iterate through all bits which are set in the flags and check whether we find at least
     // one pp plugin which handles it.
-    for (unsigned int mask = 1; mask < (1u << (sizeof(unsigned int)*8-1));mask <<= 1) {
+    for (aiPostProcessStepMask mask = 1; mask != 0; mask <<= 1) {
 
         if (pFlags & mask) {
 
@@ -483,6 +493,11 @@ bool Importer::ValidateFlags(unsigned int pFlags) const {
 
 // ------------------------------------------------------------------------------------------------
 const aiScene* Importer::ReadFileFromMemory(const void* pBuffer, size_t pLength, unsigned int pFlags, const char* pHint ) {
+    return ReadFileFromMemory64(pBuffer, pLength, pFlags, pHint);
+}
+
+// ------------------------------------------------------------------------------------------------
+const aiScene* Importer::ReadFileFromMemory64(const void* pBuffer, size_t pLength, aiPostProcessStepMask pFlags, const char* pHint ) {
     ai_assert(nullptr != pimpl);
 
     IOSystem* io = pimpl->mIOHandler;
@@ -504,7 +519,7 @@ const aiScene* Importer::ReadFileFromMemory(const void* pBuffer, size_t pLength,
         char fbuff[BufSize];
         ai_snprintf(fbuff, BufSize, "%s.%s",AI_MEMORYIO_MAGIC_FILENAME,pHint);
 
-        ReadFile(fbuff,pFlags);
+        ReadFile64(fbuff,pFlags);
         SetIOHandler(io);
     } catch(const DeadlyImportError &e) {
         pimpl->mErrorString = e.what();
@@ -582,9 +597,53 @@ void WriteLogOpening(const std::string& file) {
     ASSIMP_LOG_DEBUG(stream.str());
 }
 
+// ------------------------------------------------------------------------------------------------
+// Builds the hashed property lookup of all materials once the scene is final, if enabled
+static void BuildMaterialPropertyIndices(const Importer &importer, aiScene *scene) {
+    if (!importer.GetPropertyBool(AI_CONFIG_IMPORT_MATERIAL_PROPERTY_INDEX, false)) {
+        return;
+    }
+    for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+        if (nullptr != scene->mMaterials[i]) {
+            scene->mMaterials[i]->BuildPropertyIndex();
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Routes the file access of an import through a recorder for the import cache, the IO system
+// of the importer is restored when the import is done.
+namespace {
+class ImportRecording {
+public:
+    explicit ImportRecording(IOSystem *&handler) :
+            mHandler(handler), mRecorder(handler) {
+        mHandler = &mRecorder;
+    }
+
+    ~ImportRecording() {
+        mHandler = mRecorder.GetWrapped();
+    }
+
+    const RecordingIOSystem &GetRecorder() const {
+        return mRecorder;
+    }
+
+private:
+    IOSystem *&mHandler;
+    RecordingIOSystem mRecorder;
+};
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Reads the given file and returns its contents if successful.
 const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
+    return ReadFile64(_pFile, pFlags);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reads the given file and returns its contents if successful, 64 bit flag version.
+const aiScene* Importer::ReadFile64( const char* _pFile, aiPostProcessStepMask pFlags) {
     ai_assert(nullptr != pimpl);
 
     ASSIMP_BEGIN_EXCEPTION_REGION();
@@ -618,9 +677,47 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             return nullptr;
         }
 
-        std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
-        if (profiler) {
-            profiler->BeginRegion("total");
+        // Start a new profile for each import, the timings of the previous one are dropped
+        delete pimpl->mProfiler;
+        pimpl->mProfiler = GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr;
+        Profiler *profiler = pimpl->mProfiler;
+        ProfileScope total(profiler, "total");
+
+        // Return the result of an identical import from the cache
+        std::unique_ptr<ImportCache> cache;
+        std::unique_ptr<ImportRecording> recording;
+        std::string cacheKey;
+        const std::string cacheDirectory = GetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY, "");
+        if (!cacheDirectory.empty()) {
+            const uint64_t maxSize = static_cast<uint64_t>(std::max(0, GetPropertyInteger(AI_CONFIG_IMPORT_CACHE_MAX_SIZE, AI_IMPORT_CACHE_DEFAULT_MAX_SIZE)));
+            cache.reset(new ImportCache(cacheDirectory, maxSize << 20));
+            cacheKey = cache->GetKey(pFile, pFlags, *pimpl);
+            int importerIndex = -1;
+            if (!cacheKey.empty()) {
+                ProfileScope lookup(profiler, "cache");
+                pimpl->mScene = cache->Load(cacheKey, pimpl->mIOHandler, importerIndex);
+            }
+            if (pimpl->mScene) {
+                ASSIMP_LOG_INFO("Found the post-processed scene in the import cache: ", cacheKey);
+                SetPropertyInteger("importerIndex", importerIndex);
+                SetPropertyString("sourceFilePath", pFile);
+#ifndef ASSIMP_BUILD_NO_VALIDATEDS_PROCESS
+                if (pFlags & aiProcess_ValidateDataStructure) {
+                    ValidateDSProcess ds;
+                    ds.ExecuteOnScene(this);
+                    if (!pimpl->mScene) {
+                        return nullptr;
+                    }
+                }
+#endif // no validation
+                ScenePriv(pimpl->mScene)->mPPStepsApplied = pFlags & ~static_cast<aiPostProcessStepMask>(aiProcess_ValidateDataStructure);
+                BuildMaterialPropertyIndices(*this, pimpl->mScene);
+                return pimpl->mScene;
+            }
+            if (!cacheKey.empty()) {
+                // the files read by the import are stored with the entry
+                recording.reset(new ImportRecording(pimpl->mIOHandler));
+            }
         }
 
         // Find an worker class which can handle the file extension.
@@ -748,7 +845,12 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
             }
 
             // Ensure that the validation process won't be called twice
-            ApplyPostProcessing(pFlags & (~aiProcess_ValidateDataStructure));
+            ApplyPostProcessing64(pFlags & ~static_cast<aiPostProcessStepMask>(aiProcess_ValidateDataStructure));
+
+            if (pimpl->mScene && recording) {
+                ProfileScope store(profiler, "cache");
+                cache->Store(cacheKey, pimpl->mScene, recording->GetRecorder(), GetPropertyInteger("importerIndex", -1));
+            }
         }
         // if failed, extract the error string
         else if( !pimpl->mScene) {
@@ -758,10 +860,6 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 
         // clear any data allocated by post-process steps
         pimpl->mPPShared->Clean();
-
-        if (profiler) {
-            profiler->EndRegion("total");
-        }
     }
 #ifdef ASSIMP_CATCH_GLOBAL_EXCEPTIONS
     catch (std::exception &e) {
@@ -785,9 +883,28 @@ const aiScene* Importer::ReadFile( const char* _pFile, unsigned int pFlags) {
 }
 
 
+// ------------------------------------------------------------------------------------------------
+// Returns the profiler of the current import, a new one is created for post-processing
+// runs on scenes which have been imported without measuring.
+static Profiler *GetProfiler(ImporterPimpl *pimpl, bool enabled) {
+    if (!enabled) {
+        return nullptr;
+    }
+    if (nullptr == pimpl->mProfiler) {
+        pimpl->mProfiler = new Profiler();
+    }
+    return pimpl->mProfiler;
+}
+
 // ------------------------------------------------------------------------------------------------
 // Apply post-processing to the currently bound scene
 const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
+    return ApplyPostProcessing64(pFlags);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Apply post-processing to the currently bound scene, 64 bit flag version
+const aiScene* Importer::ApplyPostProcessing64(aiPostProcessStepMask pFlags) {
     ai_assert(nullptr != pimpl);
 
     ASSIMP_BEGIN_EXCEPTION_REGION();
@@ -798,6 +915,7 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
 
     // If no flags are given, return the current scene with no further action
     if (!pFlags) {
+        BuildMaterialPropertyIndices(*this, pimpl->mScene);
         return pimpl->mScene;
     }
 
@@ -830,20 +948,20 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    // vertex streams do not follow changes of the vertex data, aiProcess_GenVertexStreams builds them again
+    if (const unsigned int dropped = DropVertexStreams(pimpl->mScene, pFlags)) {
+        ASSIMP_LOG_DEBUG("Deleted ", dropped, " vertex streams which the post processing would make stale");
+    }
+
+    Profiler *profiler = GetProfiler(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) != 0);
+    ProfileScope postprocess(profiler, "postprocess");
     for( unsigned int a = 0; a < pimpl->mPostProcessingSteps.size(); a++)   {
         BaseProcess* process = pimpl->mPostProcessingSteps[a];
         pimpl->mProgressHandler->UpdatePostProcess(static_cast<int>(a), static_cast<int>(pimpl->mPostProcessingSteps.size()) );
         if( process->IsActive( pFlags)) {
-            if (profiler) {
-                profiler->BeginRegion("postprocess");
-            }
+            ProfileScope step(profiler, process->GetName());
 
             process->ExecuteOnScene ( this );
-
-            if (profiler) {
-                profiler->EndRegion("postprocess");
-            }
         }
         if( !pimpl->mScene) {
             break;
@@ -870,6 +988,7 @@ const aiScene* Importer::ApplyPostProcessing(unsigned int pFlags) {
     // update private scene flags
     if( pimpl->mScene ) {
       ScenePriv(pimpl->mScene)->mPPStepsApplied |= pFlags;
+      BuildMaterialPropertyIndices(*this, pimpl->mScene);
     }
 
     // clear any data allocated by post-process steps
@@ -925,15 +1044,21 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     }
 #endif // ! DEBUG
 
-    std::unique_ptr<Profiler> profiler(GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) ? new Profiler() : nullptr);
+    // there is no telling which data a custom step changes
+    if (const unsigned int dropped = DropVertexStreams(pimpl->mScene, ~aiPostProcessStepMask(0))) {
+        ASSIMP_LOG_DEBUG("Deleted ", dropped, " vertex streams which the post processing would make stale");
+    }
 
+    Profiler *profiler = GetProfiler(pimpl, GetPropertyInteger(AI_CONFIG_GLOB_MEASURE_TIME, 0) != 0);
     if ( profiler ) {
         profiler->BeginRegion( "postprocess" );
+        profiler->BeginRegion( rootProcess->GetName() );
     }
 
     rootProcess->ExecuteOnScene( this );
 
     if ( profiler ) {
+        profiler->EndRegion( rootProcess->GetName() );
         profiler->EndRegion( "postprocess" );
     }
 
@@ -950,6 +1075,10 @@ const aiScene* Importer::ApplyCustomizedPostProcessing( BaseProcess *rootProcess
     }
 #endif // no validation
 
+    if ( pimpl->mScene ) {
+        BuildMaterialPropertyIndices( *this, pimpl->mScene );
+    }
+
     // clear any data allocated by post-process steps
     pimpl->mPPShared->Clean();
     ASSIMP_LOG_INFO( "Leaving customized post processing pipeline" );
@@ -1277,3 +1406,15 @@ void Importer::GetMemoryRequirements(aiMemoryInfo& in) const {
 
     in.total += in.materials;
 }
+
+// ------------------------------------------------------------------------------------------------
+// Get the timings of the last import
+bool Importer::GetProfileReport(ProfileReport &report) const {
+    ai_assert(nullptr != pimpl);
+
+    if (nullptr == pimpl->mProfiler) {
+        return false;
+    }
+    report = pimpl->mProfiler->GetReport();
+    return true;
+}
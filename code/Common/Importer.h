@@ -59,6 +59,10 @@ namespace Assimp {
     class BaseProcess;
     class SharedPostProcessInfo;
 
+    namespace Profiling {
+        class Profiler;
+    }
+
 
 //! @cond never
 // ---------------------------------------------------------------------------
@@ -126,6 +130,9 @@ public:
     /** Used by post-process steps to share data */
     SharedPostProcessInfo* mPPShared;
 
+    /** Timings of the last import, nullptr if AI_CONFIG_GLOB_MEASURE_TIME is not set */
+    Profiling::Profiler* mProfiler;
+
     /// The default class constructor.
     ImporterPimpl() AI_NO_EXCEPT;
 
@@ -149,7 +156,8 @@ inline ImporterPimpl::ImporterPimpl() AI_NO_EXCEPT :
         mMatrixProperties(),
         mPointerProperties(),
         bExtraVerbose( false ),
-        mPPShared( nullptr ) {
+        mPPShared( nullptr ),
+        mProfiler( nullptr ) {
     // empty
 }
 //! @endcond
@@ -160,8 +168,10 @@ struct BatchData;
 /** FOR IMPORTER PLUGINS ONLY: A helper class to the pleasure of importers
  *  that need to load many external meshes recursively.
  *
- *  The class uses several threads to load these meshes (or at least it
- *  could, this has not yet been implemented at the moment).
+ *  The class uses a pool of worker threads to load these meshes. Each
+ *  worker owns a private Importer instance, so the requests are loaded
+ *  concurrently. Access to the shared IOSystem is serialized, the
+ *  streams it returns are read in parallel.
  *
  *  @note The class may not be used by more than one thread*/
 class ASSIMP_API BatchLoader {
@@ -210,6 +220,20 @@ public:
      */
     bool getValidation() const;
 
+    // -------------------------------------------------------------------
+    /** Sets the number of worker threads used by LoadAll().
+     *  @param  numThreads  Number of workers, 0 selects the number of
+     *          hardware threads, 1 loads all requests on the calling thread.
+     *          The default is 1.
+     */
+    void setNumThreads( unsigned int numThreads );
+
+    // -------------------------------------------------------------------
+    /** Returns the number of worker threads used by LoadAll().
+     *  @return The number of worker threads, never 0.
+     */
+    unsigned int getNumThreads() const;
+
     // -------------------------------------------------------------------
     /** Add a new file to the list of files to be loaded.
      *  @param file File to be loaded
@@ -239,7 +263,11 @@ public:
 
     // -------------------------------------------------------------------
     /** Waits until all scenes have been loaded. This returns
-     *  immediately if no scenes are queued.*/
+     *  immediately if no scenes are queued.
+     *
+     *  The requests are distributed over the worker pool, the results
+     *  are available via GetImport() independently from the order in
+     *  which the workers finished. */
     void LoadAll();
 
 private:
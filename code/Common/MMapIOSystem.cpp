@@ -0,0 +1,171 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+/** @file  MMapIOSystem.cpp
+ *  @brief Implementation of the memory mapped IOSystem and IOStream
+ */
+
+#include <assimp/MMapIOSystem.h>
+#include <assimp/ai_assert.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#if !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+#   define ASSIMP_HAS_MMAP
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+// ----------------------------------------------------------------------------------
+MMapIOStream::MMapIOStream(const uint8_t *data, size_t size, const std::string &strFilename) :
+        mData(data),
+        mSize(size),
+        mPos(0),
+        mFilename(strFilename) {
+    // empty
+}
+
+// ----------------------------------------------------------------------------------
+MMapIOStream::~MMapIOStream() {
+#ifdef ASSIMP_HAS_MMAP
+    if (mData != nullptr) {
+        ::munmap(const_cast<uint8_t *>(mData), mSize);
+    }
+#endif
+}
+
+// ----------------------------------------------------------------------------------
+size_t MMapIOStream::Read(void *pvBuffer, size_t pSize, size_t pCount) {
+    if (0 == pCount) {
+        return 0;
+    }
+    ai_assert(nullptr != pvBuffer);
+    ai_assert(0 != pSize);
+
+    const size_t cnt = std::min(pCount, (mSize - mPos) / pSize);
+    const size_t ofs = pSize * cnt;
+    ::memcpy(pvBuffer, mData + mPos, ofs);
+    mPos += ofs;
+
+    return cnt;
+}
+
+// ----------------------------------------------------------------------------------
+size_t MMapIOStream::Write(const void *, size_t, size_t) {
+    return 0;
+}
+
+// ----------------------------------------------------------------------------------
+aiReturn MMapIOStream::Seek(size_t pOffset, aiOrigin pOrigin) {
+    size_t base = 0;
+    if (aiOrigin_CUR == pOrigin) {
+        base = mPos;
+    } else if (aiOrigin_END == pOrigin) {
+        // the offset is negative, see IOStream::Seek()
+        base = mSize;
+    }
+
+    const size_t target = base + pOffset;
+    if (target > mSize) {
+        return AI_FAILURE;
+    }
+    mPos = target;
+
+    return AI_SUCCESS;
+}
+
+// ----------------------------------------------------------------------------------
+size_t MMapIOStream::Tell() const {
+    return mPos;
+}
+
+// ----------------------------------------------------------------------------------
+size_t MMapIOStream::FileSize() const {
+    return mSize;
+}
+
+// ----------------------------------------------------------------------------------
+void MMapIOStream::Flush() {
+    // empty
+}
+
+// ----------------------------------------------------------------------------------
+const uint8_t *MMapIOStream::GetMappedData() const {
+    return mData;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Open a new file with a given path, map it if it is opened for reading.
+IOStream *MMapIOSystem::Open(const char *strFile, const char *strMode) {
+    ai_assert(strFile != nullptr);
+    ai_assert(strMode != nullptr);
+
+#ifdef ASSIMP_HAS_MMAP
+    if (nullptr == ::strpbrk(strMode, "wa+")) {
+        const int fd = ::open(strFile, O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        struct stat info;
+        void *data = MAP_FAILED;
+        size_t size = 0;
+        if (0 == ::fstat(fd, &info) && S_ISREG(info.st_mode) && info.st_size > 0 &&
+                static_cast<uint64_t>(info.st_size) <= std::numeric_limits<size_t>::max()) {
+            size = static_cast<size_t>(info.st_size);
+            data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+
+        // the mapping stays valid after the descriptor is closed
+        ::close(fd);
+        if (data != MAP_FAILED) {
+            return new MMapIOStream(static_cast<const uint8_t *>(data), size, strFile);
+        }
+    }
+#endif
+
+    return DefaultIOSystem::Open(strFile, strMode);
+}
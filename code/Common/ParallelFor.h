@@ -0,0 +1,74 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/** @file ParallelFor.h
+ *  @brief Minimal worker pool shared by importers and post-processing steps.
+ */
+#pragma once
+#ifndef AI_PARALLELFOR_H_INC
+#define AI_PARALLELFOR_H_INC
+
+#include <functional>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** Invokes a function for every index in [0, count).
+ *
+ *  The indices are distributed over numThreads threads, the calling thread
+ *  being one of them. The function must only touch data belonging to its
+ *  index. The first exception thrown by any of the invocations is rethrown
+ *  on the calling thread after all threads have finished.
+ *  @param numThreads Number of threads to use, 0 for hardware concurrency
+ *  @param count      Number of indices to process
+ *  @param func       Function to be called for each index
+ */
+void ParallelFor(unsigned int numThreads, unsigned int count, const std::function<void(unsigned int)> &func);
+
+// ---------------------------------------------------------------------------
+/** Returns the number of threads to use for a configured thread count,
+ *  0 is replaced by the hardware concurrency.
+ */
+unsigned int GetNumWorkerThreads(unsigned int numThreads);
+
+} // end of namespace Assimp
+
+#endif // AI_PARALLELFOR_H_INC
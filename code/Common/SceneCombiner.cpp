@@ -1111,6 +1111,14 @@ void SceneCombiner::Copy(aiMesh **_dest, const aiMesh *src) {
             Copy(&dest->mTextureCoordsNames[i], src->mTextureCoordsNames[i]);
         }
     }
+
+    // make a deep copy of the interleaved vertex stream
+    if (src->mVertexStream != nullptr) {
+        aiVertexStream *stream = dest->mVertexStream = new aiVertexStream();
+        *stream = *src->mVertexStream;
+        GetArrayCopy(stream->mAttributes, stream->mNumAttributes);
+        GetArrayCopy(stream->mData, stream->mNumVertices * stream->mStride);
+    }
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -1304,6 +1312,7 @@ void SceneCombiner::Copy(aiNode **_dest, const aiNode *src) {
 
     // and reallocate all arrays
     GetArrayCopy(dest->mMeshes, dest->mNumMeshes);
+    GetArrayCopy(dest->mInstanceTransforms, dest->mNumInstances);
     CopyPtrArray(dest->mChildren, src->mChildren, dest->mNumChildren);
 
     // need to set the mParent fields to the created aiNode.
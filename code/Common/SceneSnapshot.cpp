@@ -0,0 +1,972 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+/** @file  SceneSnapshot.cpp
+ *  @brief Implementation of the relocatable scene snapshot
+ */
+
+#include <assimp/SceneSnapshot.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/scene.h>
+#include <assimp/version.h>
+#include <assimp/DefaultLogger.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#if !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+#   define ASSIMP_HAS_MMAP
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+using namespace Assimp;
+
+namespace {
+
+constexpr uint32_t SnapshotVersion = 2;
+constexpr uint32_t ByteOrderMark = 0x01020304;
+constexpr size_t NumTypeSizes = 22;
+
+// Everything up to mSize has to match the header of this build.
+struct SnapshotHeader {
+    char mMagic[8];
+    uint32_t mVersion;
+    uint32_t mByteOrder;
+    uint32_t mAssimpVersion[3];
+    uint32_t mCompileFlags;
+    uint32_t mTypeSizes[NumTypeSizes];
+    uint64_t mSize;
+    uint64_t mScene;
+    uint64_t mRelocations;
+    uint64_t mNumRelocations;
+};
+
+// A run of pointer slots which hold offsets into the snapshot.
+struct Relocation {
+    uint64_t mSlot;
+    uint32_t mCount;
+    uint32_t mStride;
+};
+
+SnapshotHeader MakeHeader() {
+    SnapshotHeader header;
+    ::memset(&header, 0, sizeof(header));
+    ::memcpy(header.mMagic, "ASSNAP\0\0", sizeof(header.mMagic));
+    header.mVersion = SnapshotVersion;
+    header.mByteOrder = ByteOrderMark;
+    header.mAssimpVersion[0] = aiGetVersionMajor();
+    header.mAssimpVersion[1] = aiGetVersionMinor();
+    header.mAssimpVersion[2] = aiGetVersionPatch();
+    header.mCompileFlags = aiGetCompileFlags();
+
+    const size_t sizes[] = {
+        sizeof(void *), sizeof(ai_real), sizeof(aiScene), sizeof(aiNode), sizeof(aiMesh),
+        sizeof(aiFace), sizeof(aiBone), sizeof(aiAnimMesh), sizeof(aiMaterial),
+        sizeof(aiMaterialProperty), sizeof(aiAnimation), sizeof(aiNodeAnim), sizeof(aiMeshAnim),
+        sizeof(aiMeshMorphAnim), sizeof(aiMeshMorphKey), sizeof(aiTexture), sizeof(aiLight),
+        sizeof(aiCamera), sizeof(aiMetadataEntry), sizeof(aiSkeletonBone), sizeof(aiVertexStream),
+        sizeof(aiVertexAttribute)
+    };
+    static_assert(sizeof(sizes) / sizeof(sizes[0]) == NumTypeSizes, "type size table mismatch");
+    for (size_t i = 0; i < NumTypeSizes; ++i) {
+        header.mTypeSizes[i] = static_cast<uint32_t>(sizes[i]);
+    }
+    return header;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Builds the snapshot blob. All objects are referenced by their offset, the blob may move
+// while it grows.
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(const aiScene *scene) {
+        const size_t header = Alloc(sizeof(SnapshotHeader), alignof(SnapshotHeader));
+        const size_t root = StoreScene(scene);
+
+        const size_t relocations = Alloc(sizeof(Relocation) * mRelocations.size(), alignof(Relocation));
+        if (!mRelocations.empty()) {
+            ::memcpy(&mBlob[relocations], mRelocations.data(), sizeof(Relocation) * mRelocations.size());
+        }
+
+        SnapshotHeader h = MakeHeader();
+        h.mSize = mBlob.size();
+        h.mScene = root;
+        h.mRelocations = relocations;
+        h.mNumRelocations = mRelocations.size();
+        ::memcpy(&mBlob[header], &h, sizeof(h));
+    }
+
+    const std::vector<uint8_t> &GetBlob() const {
+        return mBlob;
+    }
+
+private:
+    size_t Alloc(size_t size, size_t align) {
+        const size_t offset = (mBlob.size() + align - 1) & ~(align - 1);
+        mBlob.resize(offset + size);
+        return offset;
+    }
+
+    // Appends the byte image of an array, returns 0 for an empty one.
+    template <class T>
+    size_t Put(const T *src, size_t count = 1) {
+        if (nullptr == src || 0 == count) {
+            return 0;
+        }
+        const size_t offset = Alloc(sizeof(T) * count, alignof(T));
+        ::memcpy(&mBlob[offset], static_cast<const void *>(src), sizeof(T) * count);
+        return offset;
+    }
+
+    // Replaces the pointer member of a stored object by the offset of its target.
+    template <class T, class M>
+    void Link(size_t object, const T *src, M *const *member, size_t target) {
+        const size_t slot = object + (reinterpret_cast<const uint8_t *>(member) - reinterpret_cast<const uint8_t *>(src));
+        const uintptr_t value = target;
+        ::memcpy(&mBlob[slot], &value, sizeof(value));
+        if (0 == target) {
+            return;
+        }
+
+        // pointers to consecutive elements are relocated as one run
+        if (!mRelocations.empty()) {
+            Relocation &last = mRelocations.back();
+            const uint64_t lastSlot = last.mSlot + static_cast<uint64_t>(last.mCount - 1) * last.mStride;
+            const uint64_t stride = slot - lastSlot;
+            if (slot > lastSlot && last.mCount < std::numeric_limits<uint32_t>::max() &&
+                    ((1 == last.mCount && stride <= std::numeric_limits<uint32_t>::max()) || stride == last.mStride)) {
+                last.mStride = static_cast<uint32_t>(stride);
+                ++last.mCount;
+                return;
+            }
+        }
+        mRelocations.push_back({ slot, 1, 0 });
+    }
+
+    // Stores an array of object pointers, each object through store().
+    template <class T, class Fn>
+    size_t PutPointers(T *const *src, size_t count, Fn store) {
+        if (nullptr == src || 0 == count) {
+            return 0;
+        }
+        const size_t array = Alloc(sizeof(T *) * count, alignof(T *));
+        for (size_t i = 0; i < count; ++i) {
+            Link(array, src, src + i, store(src[i]));
+        }
+        return array;
+    }
+
+    size_t NodeOffset(const aiNode *node) const {
+        auto it = mNodes.find(node);
+        return it == mNodes.end() ? 0 : it->second;
+    }
+
+    size_t StoreScene(const aiScene *scene) {
+        const size_t obj = Put(scene);
+        Link(obj, scene, &scene->mRootNode, StoreNode(scene->mRootNode, 0));
+        Link(obj, scene, &scene->mMeshes, PutPointers(scene->mMeshes, scene->mNumMeshes, [this](const aiMesh *mesh) {
+            return StoreMesh(mesh);
+        }));
+        Link(obj, scene, &scene->mMaterials, PutPointers(scene->mMaterials, scene->mNumMaterials, [this](const aiMaterial *material) {
+            return StoreMaterial(material);
+        }));
+        Link(obj, scene, &scene->mAnimations, PutPointers(scene->mAnimations, scene->mNumAnimations, [this](const aiAnimation *anim) {
+            return StoreAnimation(anim);
+        }));
+        Link(obj, scene, &scene->mTextures, PutPointers(scene->mTextures, scene->mNumTextures, [this](const aiTexture *texture) {
+            return StoreTexture(texture);
+        }));
+        Link(obj, scene, &scene->mLights, PutPointers(scene->mLights, scene->mNumLights, [this](const aiLight *light) {
+            return Put(light);
+        }));
+        Link(obj, scene, &scene->mCameras, PutPointers(scene->mCameras, scene->mNumCameras, [this](const aiCamera *camera) {
+            return Put(camera);
+        }));
+        Link(obj, scene, &scene->mMetaData, StoreMetadata(scene->mMetaData));
+        Link(obj, scene, &scene->mSkeletons, PutPointers(scene->mSkeletons, scene->mNumSkeletons, [this](const aiSkeleton *skeleton) {
+            return StoreSkeleton(skeleton);
+        }));
+        Link(obj, scene, &scene->mPrivate, 0);
+        return obj;
+    }
+
+    size_t StoreNode(const aiNode *node, size_t parent) {
+        if (nullptr == node) {
+            return 0;
+        }
+        const size_t obj = Put(node);
+        mNodes[node] = obj;
+        Link(obj, node, &node->mParent, parent);
+        Link(obj, node, &node->mMeshes, Put(node->mMeshes, node->mNumMeshes));
+        Link(obj, node, &node->mMetaData, StoreMetadata(node->mMetaData));
+        Link(obj, node, &node->mInstanceTransforms, Put(node->mInstanceTransforms, node->mNumInstances));
+        Link(obj, node, &node->mChildren, PutPointers(node->mChildren, node->mNumChildren, [this, obj](const aiNode *child) {
+            return StoreNode(child, obj);
+        }));
+        return obj;
+    }
+
+    // Stores the vertex streams shared by meshes and anim meshes.
+    template <class T>
+    void StoreVertexStreams(size_t obj, const T *mesh) {
+        const size_t num = mesh->mNumVertices;
+        Link(obj, mesh, &mesh->mVertices, Put(mesh->mVertices, num));
+        Link(obj, mesh, &mesh->mNormals, Put(mesh->mNormals, num));
+        Link(obj, mesh, &mesh->mTangents, Put(mesh->mTangents, num));
+        Link(obj, mesh, &mesh->mBitangents, Put(mesh->mBitangents, num));
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            Link(obj, mesh, &mesh->mColors[i], Put(mesh->mColors[i], num));
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            Link(obj, mesh, &mesh->mTextureCoords[i], Put(mesh->mTextureCoords[i], num));
+        }
+    }
+
+    size_t StoreMesh(const aiMesh *mesh) {
+        const size_t obj = Put(mesh);
+        mMeshes[mesh] = obj;
+        StoreVertexStreams(obj, mesh);
+        Link(obj, mesh, &mesh->mTextureCoordsNames, PutPointers(mesh->mTextureCoordsNames, mesh->mTextureCoordsNames ? AI_MAX_NUMBER_OF_TEXTURECOORDS : 0, [this](const aiString *name) {
+            return Put(name);
+        }));
+
+        const size_t faces = Put(mesh->mFaces, mesh->mNumFaces);
+        Link(obj, mesh, &mesh->mFaces, faces);
+        for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+            const aiFace &face = mesh->mFaces[i];
+            Link(faces + i * sizeof(aiFace), &face, &face.mIndices, Put(face.mIndices, face.mNumIndices));
+        }
+
+        Link(obj, mesh, &mesh->mBones, PutPointers(mesh->mBones, mesh->mNumBones, [this](const aiBone *bone) {
+            const size_t b = Put(bone);
+            Link(b, bone, &bone->mWeights, Put(bone->mWeights, bone->mNumWeights));
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+            Link(b, bone, &bone->mArmature, NodeOffset(bone->mArmature));
+            Link(b, bone, &bone->mNode, NodeOffset(bone->mNode));
+#endif
+            return b;
+        }));
+        Link(obj, mesh, &mesh->mAnimMeshes, PutPointers(mesh->mAnimMeshes, mesh->mNumAnimMeshes, [this](const aiAnimMesh *animMesh) {
+            const size_t a = Put(animMesh);
+            StoreVertexStreams(a, animMesh);
+            return a;
+        }));
+
+        const aiVertexStream *stream = mesh->mVertexStream;
+        const size_t s = Put(stream);
+        Link(obj, mesh, &mesh->mVertexStream, s);
+        if (0 != s) {
+            Link(s, stream, &stream->mAttributes, Put(stream->mAttributes, stream->mNumAttributes));
+            Link(s, stream, &stream->mData, Put(stream->mData, static_cast<size_t>(stream->mNumVertices) * stream->mStride));
+        }
+        return obj;
+    }
+
+    size_t StoreMaterial(const aiMaterial *material) {
+        const size_t obj = Put(material);
+        // the stored property array holds no spare slots
+        const unsigned int allocated = material->mNumProperties;
+        const size_t field = reinterpret_cast<const uint8_t *>(&material->mNumAllocated) - reinterpret_cast<const uint8_t *>(material);
+        ::memcpy(&mBlob[obj + field], &allocated, sizeof(allocated));
+        Link(obj, material, &material->mProperties, PutPointers(material->mProperties, material->mNumProperties, [this](const aiMaterialProperty *prop) {
+            const size_t p = Put(prop);
+            Link(p, prop, &prop->mData, Put(prop->mData, prop->mDataLength));
+            return p;
+        }));
+        return obj;
+    }
+
+    size_t StoreAnimation(const aiAnimation *anim) {
+        const size_t obj = Put(anim);
+        Link(obj, anim, &anim->mChannels, PutPointers(anim->mChannels, anim->mNumChannels, [this](const aiNodeAnim *channel) {
+            const size_t c = Put(channel);
+            Link(c, channel, &channel->mPositionKeys, Put(channel->mPositionKeys, channel->mNumPositionKeys));
+            Link(c, channel, &channel->mRotationKeys, Put(channel->mRotationKeys, channel->mNumRotationKeys));
+            Link(c, channel, &channel->mScalingKeys, Put(channel->mScalingKeys, channel->mNumScalingKeys));
+            return c;
+        }));
+        Link(obj, anim, &anim->mMeshChannels, PutPointers(anim->mMeshChannels, anim->mNumMeshChannels, [this](const aiMeshAnim *channel) {
+            const size_t c = Put(channel);
+            Link(c, channel, &channel->mKeys, Put(channel->mKeys, channel->mNumKeys));
+            return c;
+        }));
+        Link(obj, anim, &anim->mMorphMeshChannels, PutPointers(anim->mMorphMeshChannels, anim->mNumMorphMeshChannels, [this](const aiMeshMorphAnim *channel) {
+            const size_t c = Put(channel);
+            const size_t keys = Put(channel->mKeys, channel->mNumKeys);
+            Link(c, channel, &channel->mKeys, keys);
+            for (unsigned int i = 0; i < channel->mNumKeys; ++i) {
+                const aiMeshMorphKey &key = channel->mKeys[i];
+                const size_t k = keys + i * sizeof(aiMeshMorphKey);
+                Link(k, &key, &key.mValues, Put(key.mValues, key.mNumValuesAndWeights));
+                Link(k, &key, &key.mWeights, Put(key.mWeights, key.mNumValuesAndWeights));
+            }
+            return c;
+        }));
+        return obj;
+    }
+
+    size_t StoreTexture(const aiTexture *texture) {
+        const size_t obj = Put(texture);
+        if (0 == texture->mHeight) {
+            // compressed data, mWidth is its size in bytes
+            Link(obj, texture, &texture->pcData, Put(reinterpret_cast<const uint8_t *>(texture->pcData), texture->mWidth));
+        } else {
+            Link(obj, texture, &texture->pcData, Put(texture->pcData, static_cast<size_t>(texture->mWidth) * texture->mHeight));
+        }
+        return obj;
+    }
+
+    size_t StoreMetadata(const aiMetadata *metadata) {
+        if (nullptr == metadata) {
+            return 0;
+        }
+        const size_t obj = Put(metadata);
+        Link(obj, metadata, &metadata->mKeys, Put(metadata->mKeys, metadata->mNumProperties));
+        const size_t values = Put(metadata->mValues, metadata->mNumProperties);
+        Link(obj, metadata, &metadata->mValues, values);
+        for (unsigned int i = 0; i < metadata->mNumProperties; ++i) {
+            const aiMetadataEntry &entry = metadata->mValues[i];
+            size_t data = 0;
+            switch (entry.mType) {
+            case AI_BOOL:
+                data = Put(static_cast<const bool *>(entry.mData));
+                break;
+            case AI_INT32:
+                data = Put(static_cast<const int32_t *>(entry.mData));
+                break;
+            case AI_UINT64:
+                data = Put(static_cast<const uint64_t *>(entry.mData));
+                break;
+            case AI_FLOAT:
+                data = Put(static_cast<const float *>(entry.mData));
+                break;
+            case AI_DOUBLE:
+                data = Put(static_cast<const double *>(entry.mData));
+                break;
+            case AI_AISTRING:
+                data = Put(static_cast<const aiString *>(entry.mData));
+                break;
+            case AI_AIVECTOR3D:
+                data = Put(static_cast<const aiVector3D *>(entry.mData));
+                break;
+            case AI_AIMETADATA:
+                data = StoreMetadata(static_cast<const aiMetadata *>(entry.mData));
+                break;
+            case AI_INT64:
+                data = Put(static_cast<const int64_t *>(entry.mData));
+                break;
+            case AI_UINT32:
+                data = Put(static_cast<const uint32_t *>(entry.mData));
+                break;
+            default:
+                break;
+            }
+            Link(values + i * sizeof(aiMetadataEntry), &entry, &entry.mData, data);
+        }
+        return obj;
+    }
+
+    size_t StoreSkeleton(const aiSkeleton *skeleton) {
+        const size_t obj = Put(skeleton);
+        Link(obj, skeleton, &skeleton->mBones, PutPointers(skeleton->mBones, skeleton->mNumBones, [this](const aiSkeletonBone *bone) {
+            const size_t b = Put(bone);
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+            Link(b, bone, &bone->mArmature, NodeOffset(bone->mArmature));
+            Link(b, bone, &bone->mNode, NodeOffset(bone->mNode));
+#endif
+            auto mesh = mMeshes.find(bone->mMeshId);
+            Link(b, bone, &bone->mMeshId, mesh == mMeshes.end() ? 0 : mesh->second);
+            Link(b, bone, &bone->mWeights, Put(bone->mWeights, bone->mNumnWeights));
+            return b;
+        }));
+        return obj;
+    }
+
+    std::vector<uint8_t> mBlob;
+    std::vector<Relocation> mRelocations;
+    std::unordered_map<const aiNode *, size_t> mNodes;
+    std::unordered_map<const aiMesh *, size_t> mMeshes;
+};
+
+// ------------------------------------------------------------------------------------------------
+// Walks a relocated scene and checks that every array lies inside the snapshot and holds as many
+// elements as its count says, and that the indices into the vertex and mesh arrays are in range.
+// A snapshot which passes can be read by the caller without leaving the blob.
+class SnapshotChecker {
+public:
+    SnapshotChecker(const uint8_t *data, size_t size) :
+            mBegin(reinterpret_cast<uintptr_t>(data)), mSize(size) {
+        // empty
+    }
+
+    bool CheckScene(const aiScene *scene) {
+        if (!IsArray(scene, 1) || nullptr != scene->mPrivate) {
+            return false;
+        }
+
+        if (!IsArray(scene->mMeshes, scene->mNumMeshes)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+            if (!CheckMesh(scene->mMeshes[i])) {
+                return false;
+            }
+        }
+        if (!IsArray(scene->mMaterials, scene->mNumMaterials)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+            if (!CheckMaterial(scene->mMaterials[i])) {
+                return false;
+            }
+        }
+        if (!IsArray(scene->mAnimations, scene->mNumAnimations)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < scene->mNumAnimations; ++i) {
+            if (!CheckAnimation(scene->mAnimations[i])) {
+                return false;
+            }
+        }
+        if (!IsArray(scene->mTextures, scene->mNumTextures)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < scene->mNumTextures; ++i) {
+            if (!CheckTexture(scene->mTextures[i])) {
+                return false;
+            }
+        }
+        if (!IsArray(scene->mLights, scene->mNumLights) || !IsArray(scene->mCameras, scene->mNumCameras)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < scene->mNumLights; ++i) {
+            if (!IsArray(scene->mLights[i], 1)) {
+                return false;
+            }
+        }
+        for (unsigned int i = 0; i < scene->mNumCameras; ++i) {
+            if (!IsArray(scene->mCameras[i], 1)) {
+                return false;
+            }
+        }
+        if (!IsArray(scene->mSkeletons, scene->mNumSkeletons)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < scene->mNumSkeletons; ++i) {
+            if (!CheckSkeleton(scene->mSkeletons[i])) {
+                return false;
+            }
+        }
+
+        // nodes and metadata are walked without recursion, the number of visits is bounded by
+        // the number of objects which fit into the snapshot, so a cycle cannot loop forever
+        mMetadata.push_back(scene->mMetaData);
+        std::vector<const aiNode *> nodes(1, scene->mRootNode);
+        size_t budget = mSize / sizeof(aiNode);
+        while (!nodes.empty()) {
+            const aiNode *node = nodes.back();
+            nodes.pop_back();
+            if (nullptr == node) {
+                continue;
+            }
+            if (0 == budget-- || !CheckNode(node, scene->mNumMeshes)) {
+                return false;
+            }
+            nodes.insert(nodes.end(), node->mChildren, node->mChildren + node->mNumChildren);
+        }
+        return CheckMetadata();
+    }
+
+private:
+    // Checks that count elements of T at ptr lie inside the snapshot, nullptr is an empty array.
+    template <class T>
+    bool IsArray(const T *ptr, size_t count) const {
+        return nullptr == ptr ? 0 == count : InRange(ptr, count);
+    }
+
+    // As IsArray(), for optional arrays which may be missing although count is not 0.
+    template <class T>
+    bool InRange(const T *ptr, size_t count) const {
+        if (nullptr == ptr) {
+            return true;
+        }
+        const uintptr_t p = reinterpret_cast<uintptr_t>(ptr);
+        return p >= mBegin && p - mBegin <= mSize && 0 == p % alignof(T) &&
+               count <= (mSize - (p - mBegin)) / sizeof(T);
+    }
+
+    template <class T>
+    bool CheckVertexStreams(const T *mesh) const {
+        const size_t num = mesh->mNumVertices;
+        if (!InRange(mesh->mVertices, num) || !InRange(mesh->mNormals, num) ||
+                !InRange(mesh->mTangents, num) || !InRange(mesh->mBitangents, num)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+            if (!InRange(mesh->mColors[i], num)) {
+                return false;
+            }
+        }
+        for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+            if (!InRange(mesh->mTextureCoords[i], num)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool CheckMesh(const aiMesh *mesh) const {
+        if (!IsArray(mesh, 1) || !CheckVertexStreams(mesh)) {
+            return false;
+        }
+        if (nullptr != mesh->mTextureCoordsNames) {
+            if (!InRange(mesh->mTextureCoordsNames, AI_MAX_NUMBER_OF_TEXTURECOORDS)) {
+                return false;
+            }
+            for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+                if (!InRange(mesh->mTextureCoordsNames[i], 1)) {
+                    return false;
+                }
+            }
+        }
+
+        if (!IsArray(mesh->mFaces, mesh->mNumFaces)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+            const aiFace &face = mesh->mFaces[i];
+            if (!IsArray(face.mIndices, face.mNumIndices)) {
+                return false;
+            }
+            for (unsigned int j = 0; j < face.mNumIndices; ++j) {
+                if (face.mIndices[j] >= mesh->mNumVertices) {
+                    return false;
+                }
+            }
+        }
+
+        if (!IsArray(mesh->mBones, mesh->mNumBones)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < mesh->mNumBones; ++i) {
+            const aiBone *bone = mesh->mBones[i];
+            if (!IsArray(bone, 1) || !IsArray(bone->mWeights, bone->mNumWeights)) {
+                return false;
+            }
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+            if (!InRange(bone->mArmature, 1) || !InRange(bone->mNode, 1)) {
+                return false;
+            }
+#endif
+            for (unsigned int j = 0; j < bone->mNumWeights; ++j) {
+                if (bone->mWeights[j].mVertexId >= mesh->mNumVertices) {
+                    return false;
+                }
+            }
+        }
+
+        if (!IsArray(mesh->mAnimMeshes, mesh->mNumAnimMeshes)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < mesh->mNumAnimMeshes; ++i) {
+            if (!IsArray(mesh->mAnimMeshes[i], 1) || !CheckVertexStreams(mesh->mAnimMeshes[i])) {
+                return false;
+            }
+        }
+
+        const aiVertexStream *stream = mesh->mVertexStream;
+        if (nullptr != stream) {
+            if (!IsArray(stream, 1) || !IsArray(stream->mAttributes, stream->mNumAttributes) ||
+                    !IsArray(stream->mData, static_cast<size_t>(stream->mNumVertices) * stream->mStride)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool CheckMaterial(const aiMaterial *material) const {
+        if (!IsArray(material, 1) || material->mNumAllocated != material->mNumProperties ||
+                !IsArray(material->mProperties, material->mNumProperties)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < material->mNumProperties; ++i) {
+            const aiMaterialProperty *prop = material->mProperties[i];
+            if (!IsArray(prop, 1) || !IsArray(prop->mData, prop->mDataLength)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool CheckAnimation(const aiAnimation *anim) const {
+        if (!IsArray(anim, 1) || !IsArray(anim->mChannels, anim->mNumChannels) ||
+                !IsArray(anim->mMeshChannels, anim->mNumMeshChannels) ||
+                !IsArray(anim->mMorphMeshChannels, anim->mNumMorphMeshChannels)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < anim->mNumChannels; ++i) {
+            const aiNodeAnim *channel = anim->mChannels[i];
+            if (!IsArray(channel, 1) || !IsArray(channel->mPositionKeys, channel->mNumPositionKeys) ||
+                    !IsArray(channel->mRotationKeys, channel->mNumRotationKeys) ||
+                    !IsArray(channel->mScalingKeys, channel->mNumScalingKeys)) {
+                return false;
+            }
+        }
+        for (unsigned int i = 0; i < anim->mNumMeshChannels; ++i) {
+            const aiMeshAnim *channel = anim->mMeshChannels[i];
+            if (!IsArray(channel, 1) || !IsArray(channel->mKeys, channel->mNumKeys)) {
+                return false;
+            }
+        }
+        for (unsigned int i = 0; i < anim->mNumMorphMeshChannels; ++i) {
+            const aiMeshMorphAnim *channel = anim->mMorphMeshChannels[i];
+            if (!IsArray(channel, 1) || !IsArray(channel->mKeys, channel->mNumKeys)) {
+                return false;
+            }
+            for (unsigned int j = 0; j < channel->mNumKeys; ++j) {
+                const aiMeshMorphKey &key = channel->mKeys[j];
+                if (!IsArray(key.mValues, key.mNumValuesAndWeights) || !IsArray(key.mWeights, key.mNumValuesAndWeights)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool CheckTexture(const aiTexture *texture) const {
+        if (!IsArray(texture, 1)) {
+            return false;
+        }
+        if (0 == texture->mHeight) {
+            // compressed data, mWidth is its size in bytes
+            return IsArray(reinterpret_cast<const uint8_t *>(texture->pcData), texture->mWidth);
+        }
+        return IsArray(texture->pcData, static_cast<size_t>(texture->mWidth) * texture->mHeight);
+    }
+
+    bool CheckSkeleton(const aiSkeleton *skeleton) const {
+        if (!IsArray(skeleton, 1) || !IsArray(skeleton->mBones, skeleton->mNumBones)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < skeleton->mNumBones; ++i) {
+            const aiSkeletonBone *bone = skeleton->mBones[i];
+            if (!IsArray(bone, 1)) {
+                return false;
+            }
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+            if (!InRange(bone->mArmature, 1) || !InRange(bone->mNode, 1)) {
+                return false;
+            }
+#endif
+            if (!InRange(bone->mMeshId, 1) || !IsArray(bone->mWeights, bone->mNumnWeights)) {
+                return false;
+            }
+            for (unsigned int j = 0; nullptr != bone->mMeshId && j < bone->mNumnWeights; ++j) {
+                if (bone->mWeights[j].mVertexId >= bone->mMeshId->mNumVertices) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool CheckNode(const aiNode *node, unsigned int numMeshes) {
+        if (!IsArray(node, 1) || !InRange(node->mParent, 1) || !IsArray(node->mMeshes, node->mNumMeshes) ||
+                !InRange(node->mInstanceTransforms, node->mNumInstances) ||
+                !IsArray(node->mChildren, node->mNumChildren)) {
+            return false;
+        }
+        for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
+            if (node->mMeshes[i] >= numMeshes) {
+                return false;
+            }
+        }
+        for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+            if (nullptr == node->mChildren[i]) {
+                return false;
+            }
+        }
+        mMetadata.push_back(node->mMetaData);
+        return true;
+    }
+
+    bool CheckMetadata() {
+        size_t budget = mSize / sizeof(aiMetadata);
+        while (!mMetadata.empty()) {
+            const aiMetadata *metadata = mMetadata.back();
+            mMetadata.pop_back();
+            if (nullptr == metadata) {
+                continue;
+            }
+            if (0 == budget-- || !IsArray(metadata, 1) || !IsArray(metadata->mKeys, metadata->mNumProperties) ||
+                    !IsArray(metadata->mValues, metadata->mNumProperties)) {
+                return false;
+            }
+            for (unsigned int i = 0; i < metadata->mNumProperties; ++i) {
+                const aiMetadataEntry &entry = metadata->mValues[i];
+                bool valid = true;
+                switch (entry.mType) {
+                case AI_BOOL:
+                    valid = InRange(static_cast<const bool *>(entry.mData), 1);
+                    break;
+                case AI_INT32:
+                    valid = InRange(static_cast<const int32_t *>(entry.mData), 1);
+                    break;
+                case AI_UINT64:
+                    valid = InRange(static_cast<const uint64_t *>(entry.mData), 1);
+                    break;
+                case AI_FLOAT:
+                    valid = InRange(static_cast<const float *>(entry.mData), 1);
+                    break;
+                case AI_DOUBLE:
+                    valid = InRange(static_cast<const double *>(entry.mData), 1);
+                    break;
+                case AI_AISTRING:
+                    valid = InRange(static_cast<const aiString *>(entry.mData), 1);
+                    break;
+                case AI_AIVECTOR3D:
+                    valid = InRange(static_cast<const aiVector3D *>(entry.mData), 1);
+                    break;
+                case AI_AIMETADATA:
+                    mMetadata.push_back(static_cast<const aiMetadata *>(entry.mData));
+                    break;
+                case AI_INT64:
+                    valid = InRange(static_cast<const int64_t *>(entry.mData), 1);
+                    break;
+                case AI_UINT32:
+                    valid = InRange(static_cast<const uint32_t *>(entry.mData), 1);
+                    break;
+                default:
+                    // the writer stores no data for unknown types
+                    valid = nullptr == entry.mData;
+                    break;
+                }
+                if (!valid) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    const uintptr_t mBegin;
+    const size_t mSize;
+    std::vector<const aiMetadata *> mMetadata;
+};
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+SceneSnapshot::SceneSnapshot() :
+        mData(nullptr),
+        mSize(0),
+        mMapped(false),
+        mScene(nullptr) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+SceneSnapshot::~SceneSnapshot() {
+    Close();
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SceneSnapshot::Write(const aiScene *scene, IOStream *stream) {
+    if (nullptr == scene || nullptr == stream) {
+        return false;
+    }
+
+    const SnapshotWriter writer(scene);
+    const std::vector<uint8_t> &blob = writer.GetBlob();
+    return 1 == stream->Write(blob.data(), blob.size(), 1);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SceneSnapshot::Open(const char *file) {
+    Close();
+    if (nullptr == file) {
+        return false;
+    }
+
+#ifdef ASSIMP_HAS_MMAP
+    const int fd = ::open(file, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    void *data = MAP_FAILED;
+    if (0 == ::fstat(fd, &info) && S_ISREG(info.st_mode) && info.st_size > 0 &&
+            static_cast<uint64_t>(info.st_size) <= std::numeric_limits<size_t>::max()) {
+        mSize = static_cast<size_t>(info.st_size);
+        // private mapping, the relocation only copies the pages it writes to
+        data = ::mmap(nullptr, mSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        mSize = 0;
+        return false;
+    }
+    mData = static_cast<uint8_t *>(data);
+    mMapped = true;
+#else
+    FILE *f = ::fopen(file, "rb");
+    if (nullptr == f) {
+        return false;
+    }
+    ::fseek(f, 0, SEEK_END);
+    const long size = ::ftell(f);
+    ::fseek(f, 0, SEEK_SET);
+    if (size > 0) {
+        mSize = static_cast<size_t>(size);
+        mData = static_cast<uint8_t *>(::malloc(mSize));
+    }
+    const bool read = nullptr != mData && 1 == ::fread(mData, mSize, 1, f);
+    ::fclose(f);
+    if (!read) {
+        Close();
+        return false;
+    }
+#endif
+
+    if (!Relocate()) {
+        ASSIMP_LOG_WARN("SceneSnapshot: ", file, " is no valid snapshot of this build");
+        Close();
+        return false;
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SceneSnapshot::Load(const void *data, size_t size) {
+    Close();
+    if (nullptr == data || 0 == size) {
+        return false;
+    }
+
+    // malloc provides the alignment of all scene structures
+    mData = static_cast<uint8_t *>(::malloc(size));
+    if (nullptr == mData) {
+        return false;
+    }
+    ::memcpy(mData, data, size);
+    mSize = size;
+
+    if (!Relocate()) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void SceneSnapshot::Close() {
+    if (nullptr != mData) {
+#ifdef ASSIMP_HAS_MMAP
+        if (mMapped) {
+            ::munmap(mData, mSize);
+        } else {
+            ::free(mData);
+        }
+#else
+        ::free(mData);
+#endif
+    }
+    mData = nullptr;
+    mSize = 0;
+    mMapped = false;
+    mScene = nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Checks the header and turns all stored offsets into pointers.
+bool SceneSnapshot::Relocate() {
+    SnapshotHeader header;
+    if (mSize < sizeof(header)) {
+        return false;
+    }
+    ::memcpy(&header, mData, sizeof(header));
+
+    const SnapshotHeader expected = MakeHeader();
+    const size_t checked = reinterpret_cast<const uint8_t *>(&expected.mSize) - reinterpret_cast<const uint8_t *>(&expected);
+    if (0 != ::memcmp(&header, &expected, checked) || header.mSize != mSize ||
+            header.mScene == 0 || mSize < sizeof(aiScene) || header.mScene > mSize - sizeof(aiScene) ||
+            header.mRelocations > mSize ||
+            header.mNumRelocations > (mSize - header.mRelocations) / sizeof(Relocation)) {
+        return false;
+    }
+
+    const uint8_t *relocations = mData + header.mRelocations;
+    for (uint64_t i = 0; i < header.mNumRelocations; ++i) {
+        Relocation reloc;
+        ::memcpy(&reloc, relocations + i * sizeof(Relocation), sizeof(reloc));
+        if (0 == reloc.mCount || reloc.mSlot > mSize ||
+                static_cast<uint64_t>(reloc.mCount - 1) * reloc.mStride > mSize - reloc.mSlot ||
+                mSize - reloc.mSlot - static_cast<uint64_t>(reloc.mCount - 1) * reloc.mStride < sizeof(uintptr_t)) {
+            return false;
+        }
+
+        uint8_t *slot = mData + reloc.mSlot;
+        for (uint32_t n = 0; n < reloc.mCount; ++n, slot += reloc.mStride) {
+            uintptr_t value;
+            ::memcpy(&value, slot, sizeof(value));
+            if (value >= mSize) {
+                return false;
+            }
+            value += reinterpret_cast<uintptr_t>(mData);
+            ::memcpy(slot, &value, sizeof(value));
+        }
+    }
+
+    // the counts are not covered by the relocation table, a damaged snapshot must not
+    // make the scene point outside of the blob
+    const aiScene *scene = reinterpret_cast<const aiScene *>(mData + header.mScene);
+    if (!SnapshotChecker(mData, mSize).CheckScene(scene)) {
+        return false;
+    }
+    mScene = scene;
+    return true;
+}
@@ -44,6 +44,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/SpatialSort.h>
 #include <assimp/ai_assert.h>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace Assimp;
 
 // CHAR_BIT seems to be defined under MVSC, but not under GCC. Pray that the correct value is 8.
@@ -53,13 +56,28 @@ using namespace Assimp;
 
 const aiVector3D PlaneInit(0.8523f, 0.34321f, 0.5736f);
 
+namespace {
+
+// Largest cell coordinate of a grid, cell indices must fit into an int.
+constexpr ai_real MaxGridCells = ai_real(1 << 28);
+
+// Number of positions sampled by IsGridPreferable() ...
+constexpr size_t GridSampleCount = 32;
+
+// ... and the average number of visited entries per query above which the grid wins.
+// A grid query costs 27 bucket lookups plus the few entries in the cells.
+constexpr size_t GridCandidateThreshold = 64;
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Constructs a spatially sorted representation from the given position array.
 // define the reference plane. We choose some arbitrary vector away from all basic axes
 // in the hope that no model spreads all its vertices along this plane.
 SpatialSort::SpatialSort(const aiVector3D *pPositions, unsigned int pNumPositions, unsigned int pElementOffset) :
         mPlaneNormal(PlaneInit),
-        mFinalized(false) {
+        mFinalized(false),
+        mGridCellSize(0) {
     mPlaneNormal.Normalize();
     Fill(pPositions, pNumPositions, pElementOffset);
 }
@@ -67,7 +85,8 @@ SpatialSort::SpatialSort(const aiVector3D *pPositions, unsigned int pNumPosition
 // ------------------------------------------------------------------------------------------------
 SpatialSort::SpatialSort() :
         mPlaneNormal(PlaneInit),
-        mFinalized(false) {
+        mFinalized(false),
+        mGridCellSize(0) {
     mPlaneNormal.Normalize();
 }
 
@@ -77,6 +96,9 @@ void SpatialSort::Fill(const aiVector3D *pPositions, unsigned int pNumPositions,
         bool pFinalize /*= true */) {
     mPositions.clear();
     mFinalized = false;
+    mGridCellSize = 0;
+    mGridBuckets.clear();
+    mGridEntries.clear();
     Append(pPositions, pNumPositions, pElementOffset, pFinalize);
     mFinalized = pFinalize;
 }
@@ -124,6 +146,17 @@ void SpatialSort::Append(const aiVector3D *pPositions, unsigned int pNumPosition
 void SpatialSort::FindPositions(const aiVector3D &pPosition,
         ai_real pRadius, std::vector<unsigned int> &poResults) const {
     ai_assert(mFinalized && "The SpatialSort object must be finalized before FindPositions can be called.");
+    if (mGridCellSize > 0 && pRadius <= mGridCellSize) {
+        poResults.clear();
+        const ai_real pSquared = pRadius * pRadius;
+        VisitGridNeighbours(pPosition, [&](const GridEntry &entry) {
+            if ((entry.mPosition - pPosition).SquareLength() < pSquared) {
+                poResults.push_back(entry.mIndex);
+            }
+        });
+        return;
+    }
+
     const ai_real dist = CalculateDistance(pPosition);
     const ai_real minDist = dist - pRadius, maxDist = dist + pRadius;
 
@@ -263,6 +296,17 @@ void SpatialSort::FindIdenticalPositions(const aiVector3D &pPosition, std::vecto
     //  subtraction.
     static const int distance3DToleranceInULPs = distanceToleranceInULPs + 1;
 
+    // The grid only needs the 3D test, identical positions are in the same or a neighbouring cell.
+    if (mGridCellSize > 0) {
+        poResults.resize(0);
+        VisitGridNeighbours(pPosition, [&](const GridEntry &entry) {
+            if (distance3DToleranceInULPs >= ToBinary((entry.mPosition - pPosition).SquareLength())) {
+                poResults.push_back(entry.mIndex);
+            }
+        });
+        return;
+    }
+
     // Convert the plane distance to its signed integer representation so the ULPs tolerance can be
     //  applied. For some reason, VC won't optimize two calls of the bit pattern conversion.
     const BinFloat minDistBinary = ToBinary(CalculateDistance(pPosition)) - distanceToleranceInULPs;
@@ -336,3 +380,143 @@ unsigned int SpatialSort::GenerateMappingTable(std::vector<unsigned int> &fill,
 #endif
     return t;
 }
+
+// ------------------------------------------------------------------------------------------------
+bool SpatialSort::CalculateGridCell(const aiVector3D &pPosition, int *pCell) const {
+    for (unsigned int i = 0; i < 3; ++i) {
+        const ai_real cell = std::floor((pPosition[i] - mGridOrigin[i]) / mGridCellSize);
+        // also rejects NaN
+        if (!(cell >= ai_real(-2) && cell <= MaxGridCells + 2)) {
+            return false;
+        }
+        pCell[i] = static_cast<int>(cell);
+    }
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+namespace {
+
+// Spreads the cell coordinates over the buckets, numBuckets must be a power of two.
+unsigned int GridHash(const int *cell, size_t numBuckets) {
+    const unsigned int hash = (static_cast<unsigned int>(cell[0]) * 73856093u) ^
+            (static_cast<unsigned int>(cell[1]) * 19349663u) ^
+            (static_cast<unsigned int>(cell[2]) * 83492791u);
+    return hash & static_cast<unsigned int>(numBuckets - 1);
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+template <typename Visitor>
+void SpatialSort::VisitGridNeighbours(const aiVector3D &pPosition, Visitor pVisitor) const {
+    int cell[3];
+    if (!CalculateGridCell(pPosition, cell)) {
+        return;
+    }
+
+    const size_t numBuckets = mGridBuckets.size() - 1;
+    int neighbour[3];
+    for (int z = -1; z <= 1; ++z) {
+        neighbour[2] = cell[2] + z;
+        for (int y = -1; y <= 1; ++y) {
+            neighbour[1] = cell[1] + y;
+            for (int x = -1; x <= 1; ++x) {
+                neighbour[0] = cell[0] + x;
+                const unsigned int bucket = GridHash(neighbour, numBuckets);
+                for (unsigned int i = mGridBuckets[bucket]; i < mGridBuckets[bucket + 1]; ++i) {
+                    // other cells can share the bucket
+                    const GridEntry &entry = mGridEntries[i];
+                    if (entry.mCell[0] == neighbour[0] && entry.mCell[1] == neighbour[1] && entry.mCell[2] == neighbour[2]) {
+                        pVisitor(entry);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void SpatialSort::BuildGrid(ai_real pCellSize) {
+    ai_assert(mFinalized && "The SpatialSort object must be finalized before BuildGrid can be called.");
+    if (mGridCellSize > 0 && mGridCellSize >= pCellSize) {
+        return;
+    }
+
+    mGridCellSize = 0;
+    mGridBuckets.clear();
+    mGridEntries.clear();
+    if (!(pCellSize > 0) || mPositions.empty()) {
+        return;
+    }
+
+    aiVector3D minVec(std::numeric_limits<ai_real>::max());
+    aiVector3D maxVec(-std::numeric_limits<ai_real>::max());
+    for (const Entry &entry : mPositions) {
+        for (unsigned int i = 0; i < 3; ++i) {
+            minVec[i] = std::min(minVec[i], entry.mPosition[i]);
+            maxVec[i] = std::max(maxVec[i], entry.mPosition[i]);
+        }
+    }
+    for (unsigned int i = 0; i < 3; ++i) {
+        // a cell size this small would overflow the cell indices, keep using the plane
+        if (!(maxVec[i] >= minVec[i]) || (maxVec[i] - minVec[i]) / pCellSize > MaxGridCells) {
+            return;
+        }
+    }
+    mGridOrigin = minVec;
+    mGridCellSize = pCellSize;
+
+    // Counting sort of the entries by bucket
+    size_t numBuckets = 1;
+    while (numBuckets < mPositions.size()) {
+        numBuckets <<= 1;
+    }
+    mGridBuckets.assign(numBuckets + 1, 0);
+
+    std::vector<GridEntry> entries;
+    std::vector<unsigned int> buckets;
+    entries.reserve(mPositions.size());
+    buckets.reserve(mPositions.size());
+    for (const Entry &entry : mPositions) {
+        GridEntry gridEntry;
+        if (!CalculateGridCell(entry.mPosition, gridEntry.mCell)) {
+            // NaN positions can't be found by the plane search either
+            continue;
+        }
+        gridEntry.mIndex = entry.mIndex;
+        gridEntry.mPosition = entry.mPosition;
+        entries.push_back(gridEntry);
+        buckets.push_back(GridHash(gridEntry.mCell, numBuckets));
+        ++mGridBuckets[buckets.back() + 1];
+    }
+    for (size_t i = 1; i <= numBuckets; ++i) {
+        mGridBuckets[i] += mGridBuckets[i - 1];
+    }
+
+    mGridEntries.resize(entries.size());
+    std::vector<unsigned int> next(mGridBuckets.begin(), mGridBuckets.end() - 1);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        mGridEntries[next[buckets[i]]++] = entries[i];
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool SpatialSort::IsGridPreferable(ai_real pRadius) const {
+    ai_assert(mFinalized && "The SpatialSort object must be finalized before IsGridPreferable can be called.");
+    if (mPositions.size() < 2 * GridCandidateThreshold) {
+        return false;
+    }
+
+    size_t visited = 0;
+    const size_t step = mPositions.size() / GridSampleCount;
+    for (size_t i = 0; i < GridSampleCount; ++i) {
+        const ai_real dist = mPositions[i * step].mDistance;
+        const auto first = std::lower_bound(mPositions.begin(), mPositions.end(), dist - pRadius,
+                [](const Entry &entry, ai_real value) { return entry.mDistance < value; });
+        const auto last = std::upper_bound(first, mPositions.end(), dist + pRadius,
+                [](ai_real value, const Entry &entry) { return value < entry.mDistance; });
+        visited += static_cast<size_t>(last - first);
+    }
+    return visited > GridCandidateThreshold * GridSampleCount;
+}
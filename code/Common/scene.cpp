@@ -128,7 +128,9 @@ aiNode::aiNode() :
         mChildren(nullptr),
         mNumMeshes(0),
         mMeshes(nullptr),
-        mMetaData(nullptr) {
+        mMetaData(nullptr),
+        mNumInstances(0),
+        mInstanceTransforms(nullptr) {
     // empty
 }
 
@@ -139,7 +141,9 @@ aiNode::aiNode(const std::string &name) :
         mChildren(nullptr),
         mNumMeshes(0),
         mMeshes(nullptr),
-        mMetaData(nullptr) {
+        mMetaData(nullptr),
+        mNumInstances(0),
+        mInstanceTransforms(nullptr) {
     // empty
 }
 
@@ -154,6 +158,7 @@ aiNode::~aiNode() {
     delete[] mChildren;
     delete[] mMeshes;
     delete mMetaData;
+    delete[] mInstanceTransforms;
 }
 
 const aiNode *aiNode::FindNode(const char *name) const {
@@ -50,10 +50,112 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/material.h>
 #include <assimp/types.h>
 #include <assimp/DefaultLogger.hpp>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 using namespace Assimp;
 
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Hashed lookup index for the property list of a material, see aiMaterial::BuildPropertyIndex().
+// Open addressing with linear probing, each slot holds the property position + 1.
+struct MaterialPropertyIndex {
+    // State of the property list the index was built for
+    const aiMaterialProperty *const *properties = nullptr;
+    unsigned int numProperties = 0;
+
+    unsigned int mask = 0;
+    std::vector<unsigned int> slots;
+    std::vector<uint32_t> keyHashes;
+
+    static uint32_t Combine(uint32_t keyHash, unsigned int type, unsigned int index) {
+        uint32_t h = keyHash ^ (type * 0x9e3779b1u);
+        h ^= (index + 0x7f4a7c15u) * 0x85ebca6bu;
+        h ^= h >> 16;
+        return h;
+    }
+
+    bool IsValidFor(const aiMaterial *pMat) const {
+        return properties == pMat->mProperties && numProperties == pMat->mNumProperties;
+    }
+
+    void Build(const aiMaterial *pMat) {
+        properties = pMat->mProperties;
+        numProperties = pMat->mNumProperties;
+
+        unsigned int size = 8;
+        while (size < numProperties * 2) {
+            size *= 2;
+        }
+        mask = size - 1;
+        slots.assign(size, 0);
+        keyHashes.assign(numProperties, 0);
+
+        for (unsigned int i = 0; i < numProperties; ++i) {
+            const aiMaterialProperty *prop = properties[i];
+            if (nullptr == prop) {
+                continue;
+            }
+            keyHashes[i] = SuperFastHash(prop->mKey.data);
+
+            // the first property with a given triple wins, as with a linear search
+            if (nullptr == Find(prop->mKey.data, keyHashes[i], prop->mSemantic, prop->mIndex)) {
+                unsigned int slot = Combine(keyHashes[i], prop->mSemantic, prop->mIndex) & mask;
+                while (slots[slot]) {
+                    slot = (slot + 1) & mask;
+                }
+                slots[slot] = i + 1;
+            }
+        }
+    }
+
+    const aiMaterialProperty *Find(const char *pKey, uint32_t keyHash, unsigned int type, unsigned int index) const {
+        for (unsigned int slot = Combine(keyHash, type, index) & mask; slots[slot]; slot = (slot + 1) & mask) {
+            const unsigned int i = slots[slot] - 1;
+            const aiMaterialProperty *prop = properties[i];
+            if (keyHashes[i] == keyHash && prop->mSemantic == type && prop->mIndex == index &&
+                    0 == strcmp(prop->mKey.data, pKey)) {
+                return prop;
+            }
+        }
+        return nullptr;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+// The indices live in a table keyed by the material, so aiMaterial keeps its public layout.
+// Lookups take a shared lock and are skipped entirely while no index exists. The table is
+// never destroyed, materials may outlive static destruction.
+struct PropertyIndexTable {
+    std::shared_mutex lock;
+    std::unordered_map<const aiMaterial *, std::unique_ptr<MaterialPropertyIndex>> indices;
+    std::atomic<size_t> size{ 0 };
+};
+
+PropertyIndexTable &GetPropertyIndexTable() {
+    static PropertyIndexTable *table = new PropertyIndexTable();
+    return *table;
+}
+
+// ------------------------------------------------------------------------------------------------
+void DeletePropertyIndex(const aiMaterial *pMat) {
+    PropertyIndexTable &table = GetPropertyIndexTable();
+    if (0 == table.size.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::unique_lock<std::shared_mutex> guard(table.lock);
+    if (table.indices.erase(pMat)) {
+        table.size.store(table.indices.size(), std::memory_order_release);
+    }
+}
+
+} // namespace
+
 // ------------------------------------------------------------------------------------------------
 // Get a specific property from a material
 aiReturn aiGetMaterialProperty(const aiMaterial *pMat,
@@ -65,15 +167,25 @@ aiReturn aiGetMaterialProperty(const aiMaterial *pMat,
     ai_assert(pKey != nullptr);
     ai_assert(pPropOut != nullptr);
 
-    /*  Just search for a property with exactly this name ..
-     *  could be improved by hashing, but it's possibly
-     *  no worth the effort (we're bound to C structures,
-     *  thus std::map or derivates are not applicable. */
+    /*  Use the hashed index if it is present and still matches the property list,
+     *  see aiMaterial::BuildPropertyIndex(). Wild-card queries always take the
+     *  linear search. */
+    PropertyIndexTable &table = GetPropertyIndexTable();
+    if (UINT_MAX != type && UINT_MAX != index && 0 != table.size.load(std::memory_order_acquire)) {
+        std::shared_lock<std::shared_mutex> guard(table.lock);
+        const auto it = table.indices.find(pMat);
+        if (it != table.indices.end() && it->second->IsValidFor(pMat)) {
+            *pPropOut = it->second->Find(pKey, SuperFastHash(pKey), type, index);
+            return nullptr != *pPropOut ? AI_SUCCESS : AI_FAILURE;
+        }
+    }
+
+    /*  Just search for a property with exactly this name .. */
     for (unsigned int i = 0; i < pMat->mNumProperties; ++i) {
         aiMaterialProperty *prop = pMat->mProperties[i];
 
         if (prop /* just for safety ... */
-                && 0 == strncmp(prop->mKey.data, pKey, strlen(pKey)) && (UINT_MAX == type || prop->mSemantic == type) /* UINT_MAX is a wild-card, but this is undocumented :-) */
+                && 0 == strcmp(prop->mKey.data, pKey) && (UINT_MAX == type || prop->mSemantic == type) /* UINT_MAX is a wild-card, but this is undocumented :-) */
                 && (UINT_MAX == index || prop->mIndex == index)) {
             *pPropOut = pMat->mProperties[i];
             return AI_SUCCESS;
@@ -491,6 +603,7 @@ aiMaterial::aiMaterial() :
 // ------------------------------------------------------------------------------------------------
 aiMaterial::~aiMaterial() {
     Clear();
+    DeletePropertyIndex(this);
 
     delete[] mProperties;
 }
@@ -505,6 +618,8 @@ aiString aiMaterial::GetName() const {
 
 // ------------------------------------------------------------------------------------------------
 void aiMaterial::Clear() {
+    DeletePropertyIndex(this);
+
     for (unsigned int i = 0; i < mNumProperties; ++i) {
         // delete this entry
         delete mProperties[i];
@@ -519,6 +634,8 @@ void aiMaterial::Clear() {
 aiReturn aiMaterial::RemoveProperty(const char *pKey, unsigned int type, unsigned int index) {
     ai_assert(nullptr != pKey);
 
+    DeletePropertyIndex(this);
+
     for (unsigned int i = 0; i < mNumProperties; ++i) {
         aiMaterialProperty *prop = mProperties[i];
 
@@ -554,6 +671,8 @@ aiReturn aiMaterial::AddBinaryProperty(const void *pInput,
         return AI_FAILURE;
     }
 
+    DeletePropertyIndex(this);
+
     // first search the list whether there is already an entry with this key
     unsigned int iOutIndex(UINT_MAX);
     for (unsigned int i = 0; i < mNumProperties; ++i) {
@@ -656,6 +775,8 @@ void aiMaterial::CopyPropertyList(aiMaterial *const pcDest,
     ai_assert(pcDest->mNumProperties <= pcDest->mNumAllocated);
     ai_assert(pcSrc->mNumProperties <= pcSrc->mNumAllocated);
 
+    DeletePropertyIndex(pcDest);
+
     const unsigned int iOldNum = pcDest->mNumProperties;
     pcDest->mNumAllocated += pcSrc->mNumAllocated;
     pcDest->mNumProperties += pcSrc->mNumProperties;
@@ -706,3 +827,14 @@ void aiMaterial::CopyPropertyList(aiMaterial *const pcDest,
         memcpy(prop->mData, propSrc->mData, prop->mDataLength);
     }
 }
+
+// ------------------------------------------------------------------------------------------------
+void aiMaterial::BuildPropertyIndex() {
+    std::unique_ptr<MaterialPropertyIndex> lookup(new MaterialPropertyIndex());
+    lookup->Build(this);
+
+    PropertyIndexTable &table = GetPropertyIndexTable();
+    std::unique_lock<std::shared_mutex> guard(table.lock);
+    table.indices[this] = std::move(lookup);
+    table.size.store(table.indices.size(), std::memory_order_release);
+}
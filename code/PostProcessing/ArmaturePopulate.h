@@ -74,7 +74,13 @@ public:
     virtual ~ArmaturePopulate() = default;
 
     /// Overwritten, @see BaseProcess
-    virtual bool IsActive( unsigned int pFlags ) const;
+    virtual bool IsActive( aiPostProcessStepMask pFlags ) const;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "ArmaturePopulate";
+    }
 
     /// Overwritten, @see BaseProcess
     virtual void SetupProperties( const Importer* pImp );
@@ -51,18 +51,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/TinyFormatter.h>
 #include <assimp/qnan.h>
 
+#include <atomic>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 CalcTangentsProcess::CalcTangentsProcess() :
-        configMaxAngle(float(AI_DEG_TO_RAD(45.f))), configSourceUV(0) {
+        configMaxAngle(float(AI_DEG_TO_RAD(45.f))), configSourceUV(0), configSpatialIndex(0) {
     // nothing to do here
 }
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool CalcTangentsProcess::IsActive(unsigned int pFlags) const {
+bool CalcTangentsProcess::IsActive(aiPostProcessStepMask pFlags) const {
     return (pFlags & aiProcess_CalcTangentSpace) != 0;
 }
 
@@ -77,6 +79,7 @@ void CalcTangentsProcess::SetupProperties(const Importer *pImp) {
     configMaxAngle = AI_DEG_TO_RAD(configMaxAngle);
 
     configSourceUV = pImp->GetPropertyInteger(AI_CONFIG_PP_CT_TEXTURE_CHANNEL_INDEX, 0);
+    configSpatialIndex = pImp->GetPropertyInteger(AI_CONFIG_PP_SPATIAL_INDEX, 0);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -86,10 +89,10 @@ void CalcTangentsProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("CalcTangentsProcess begin");
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; a++) {
+    std::atomic<bool> bHas(false);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
         if (ProcessMesh(pScene->mMeshes[a], a)) bHas = true;
-    }
+    });
 
     if (bHas) {
         ASSIMP_LOG_INFO("CalcTangentsProcess finished. Tangents have been calculated");
@@ -240,6 +243,7 @@ bool CalcTangentsProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshIndex) {
         vertexFinder = &_vertexFinder;
         posEpsilon = ComputePositionEpsilon(pMesh);
     }
+    SelectSpatialIndex(*vertexFinder, posEpsilon, configSpatialIndex);
     std::vector<unsigned int> verticesFound;
 
     const float fLimit = std::cos(configMaxAngle);
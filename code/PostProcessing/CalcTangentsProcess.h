@@ -70,7 +70,13 @@ public:
     * @return true if the process is present in this flag fields,
     *   false if not.
     */
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "CalcTangentsProcess";
+    }
 
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
@@ -102,6 +108,8 @@ private:
     /** Configuration option: maximum smoothing angle, in radians*/
     float configMaxAngle;
     unsigned int configSourceUV;
+    /** Configuration option: spatial index selection, see AI_CONFIG_PP_SPATIAL_INDEX */
+    int configSpatialIndex;
 };
 
 } // end of namespace Assimp
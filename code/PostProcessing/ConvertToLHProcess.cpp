@@ -79,7 +79,7 @@ void flipUVs(aiMeshType *pMesh) {
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool MakeLeftHandedProcess::IsActive(unsigned int pFlags) const {
+bool MakeLeftHandedProcess::IsActive(aiPostProcessStepMask pFlags) const {
     return 0 != (pFlags & aiProcess_MakeLeftHanded);
 }
 
@@ -121,20 +121,31 @@ void MakeLeftHandedProcess::Execute(aiScene *pScene) {
 }
 
 // ------------------------------------------------------------------------------------------------
-// Recursively converts a node, all of its children and all of its meshes
-void MakeLeftHandedProcess::ProcessNode(aiNode *pNode, const aiMatrix4x4 &pParentGlobalRotation) {
+// Converts a node or instance transformation
+static void MirrorTransformation(aiMatrix4x4 &mat) {
     // mirror all base vectors at the local Z axis
-    pNode->mTransformation.c1 = -pNode->mTransformation.c1;
-    pNode->mTransformation.c2 = -pNode->mTransformation.c2;
-    pNode->mTransformation.c3 = -pNode->mTransformation.c3;
-    pNode->mTransformation.c4 = -pNode->mTransformation.c4;
+    mat.c1 = -mat.c1;
+    mat.c2 = -mat.c2;
+    mat.c3 = -mat.c3;
+    mat.c4 = -mat.c4;
 
     // now invert the Z axis again to keep the matrix determinant positive.
     // The local meshes will be inverted accordingly so that the result should look just fine again.
-    pNode->mTransformation.a3 = -pNode->mTransformation.a3;
-    pNode->mTransformation.b3 = -pNode->mTransformation.b3;
-    pNode->mTransformation.c3 = -pNode->mTransformation.c3;
-    pNode->mTransformation.d3 = -pNode->mTransformation.d3; // useless, but anyways...
+    mat.a3 = -mat.a3;
+    mat.b3 = -mat.b3;
+    mat.c3 = -mat.c3;
+    mat.d3 = -mat.d3; // useless, but anyways...
+}
+
+// ------------------------------------------------------------------------------------------------
+// Recursively converts a node, all of its children and all of its meshes
+void MakeLeftHandedProcess::ProcessNode(aiNode *pNode, const aiMatrix4x4 &pParentGlobalRotation) {
+    MirrorTransformation(pNode->mTransformation);
+
+    // the instances are placed in the space of the node, just like its meshes
+    for (unsigned int a = 0; a < pNode->mNumInstances; ++a) {
+        MirrorTransformation(pNode->mInstanceTransforms[a]);
+    }
 
     // continue for all children
     for (size_t a = 0; a < pNode->mNumChildren; ++a) {
@@ -249,7 +260,7 @@ FlipUVsProcess::~FlipUVsProcess() = default;
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool FlipUVsProcess::IsActive(unsigned int pFlags) const {
+bool FlipUVsProcess::IsActive(aiPostProcessStepMask pFlags) const {
     return 0 != (pFlags & aiProcess_FlipUVs);
 }
 
@@ -303,7 +314,7 @@ void FlipUVsProcess::ProcessMesh(aiMesh *pMesh) {
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool FlipWindingOrderProcess::IsActive(unsigned int pFlags) const {
+bool FlipWindingOrderProcess::IsActive(aiPostProcessStepMask pFlags) const {
     return 0 != (pFlags & aiProcess_FlipWindingOrder);
 }
 
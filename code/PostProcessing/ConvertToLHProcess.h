@@ -78,7 +78,13 @@ public:
     ~MakeLeftHandedProcess() override = default;
 
     // -------------------------------------------------------------------
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "MakeLeftHandedProcess";
+    }
 
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
@@ -135,7 +141,13 @@ public:
     ~FlipWindingOrderProcess() override = default;
 
     // -------------------------------------------------------------------
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "FlipWindingOrderProcess";
+    }
 
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
@@ -159,7 +171,13 @@ public:
     ~FlipUVsProcess();
 
     // -------------------------------------------------------------------
-    bool IsActive( unsigned int pFlags) const;
+    bool IsActive( aiPostProcessStepMask pFlags) const;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const {
+        return "FlipUVsProcess";
+    }
 
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene);
@@ -78,7 +78,13 @@ public:
     * @return true if the process is present in this flag fields,
     *   false if not.
     */
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "DeboneProcess";
+    }
 
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
@@ -67,7 +67,13 @@ public:
     ~EmbedTexturesProcess() override = default;
 
     /// Overwritten, @see BaseProcess
-    bool IsActive(unsigned int pFlags) const override;
+    bool IsActive(aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "EmbedTexturesProcess";
+    }
 
     /// Overwritten, @see BaseProcess
     void SetupProperties(const Importer* pImp) override;
@@ -62,7 +62,13 @@ public:
 
     // -------------------------------------------------------------------
     // Check whether step is active
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "FindDegeneratesProcess";
+    }
 
     // -------------------------------------------------------------------
     // Execute step on a given scene
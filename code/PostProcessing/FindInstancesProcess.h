@@ -112,7 +112,13 @@ public:
 
     // -------------------------------------------------------------------
     // Check whether step is active in given flags combination
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "FindInstancesProcess";
+    }
 
     // -------------------------------------------------------------------
     // Execute step on a given scene
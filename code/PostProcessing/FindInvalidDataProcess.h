@@ -71,7 +71,13 @@ public:
 
     // -------------------------------------------------------------------
     /// Returns active state.
-    bool IsActive(unsigned int pFlags) const override;
+    bool IsActive(aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "FindInvalidDataProcess";
+    }
 
     // -------------------------------------------------------------------
     /// Setup import settings
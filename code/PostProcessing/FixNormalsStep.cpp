@@ -58,7 +58,7 @@ using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool FixInfacingNormalsProcess::IsActive( unsigned int pFlags) const {
+bool FixInfacingNormalsProcess::IsActive( aiPostProcessStepMask pFlags) const {
     return (pFlags & aiProcess_FixInfacingNormals) != 0;
 }
 
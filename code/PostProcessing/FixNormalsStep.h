@@ -68,7 +68,13 @@ public:
      *   combination of #aiPostProcessSteps.
      * @return true if the process is present in this flag fields, false if not.
     */
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "FixInfacingNormalsProcess";
+    }
 
     // -------------------------------------------------------------------
     /** Executes the post processing step on the given imported data.
@@ -67,7 +67,13 @@ public:
 
     // -------------------------------------------------------------------
     /// @brief Will return true, if aiProcess_GenBoundingBoxes is defined.
-    bool IsActive(unsigned int pFlags) const override;
+    bool IsActive(aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "GenBoundingBoxesProcess";
+    }
 
     // -------------------------------------------------------------------
     /// @brief The execution callback.
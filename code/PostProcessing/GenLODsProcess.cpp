@@ -0,0 +1,708 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post-processing step to generate levels of detail.
+ *
+ * The meshes are simplified with half edge collapses ordered by the quadric error metric of
+ * Garland and Heckbert. Vertices are grouped by position with a SpatialSort, so a group with
+ * more than one vertex lies on a UV or normal seam. Seam vertices are never removed, and neither
+ * are vertices next to vertices influenced by a different set of bones. Vertices on open
+ * borders - which are the material borders after the meshes were split by material - are
+ * either locked or only collapse along the border.
+ */
+
+#ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+
+#include "PostProcessing/GenLODsProcess.h"
+#include "PostProcessing/ProcessHelper.h"
+
+#include <assimp/SpatialSort.h>
+#include <assimp/StringUtils.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <unordered_set>
+
+namespace Assimp {
+
+namespace {
+
+// ------------------------------------------------------------------------------------------------
+// Quadric error metric: a symmetric 4x4 matrix, stored as the 3x3 part A, the vector b and
+// the scalar c, so that the error of a position p is p*A*p + 2*b*p + c.
+struct Quadric {
+    double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+    double b0 = 0, b1 = 0, b2 = 0;
+    double c = 0;
+    double w = 0;
+
+    // Sums the squared distance to the plane n*p + d = 0, weighted by w
+    void AddPlane(const aiVector3D &n, double d, double weight) {
+        a00 += weight * n.x * n.x;
+        a01 += weight * n.x * n.y;
+        a02 += weight * n.x * n.z;
+        a11 += weight * n.y * n.y;
+        a12 += weight * n.y * n.z;
+        a22 += weight * n.z * n.z;
+        b0 += weight * n.x * d;
+        b1 += weight * n.y * d;
+        b2 += weight * n.z * d;
+        c += weight * d * d;
+        w += weight;
+    }
+
+    Quadric &operator+=(const Quadric &o) {
+        a00 += o.a00;
+        a01 += o.a01;
+        a02 += o.a02;
+        a11 += o.a11;
+        a12 += o.a12;
+        a22 += o.a22;
+        b0 += o.b0;
+        b1 += o.b1;
+        b2 += o.b2;
+        c += o.c;
+        w += o.w;
+        return *this;
+    }
+
+    // Returns the weighted mean of the squared distances of p to the planes
+    double Error(const aiVector3D &p) const {
+        const double x = p.x, y = p.y, z = p.z;
+        const double rx = a00 * x + a01 * y + a02 * z + 2 * b0;
+        const double ry = a01 * x + a11 * y + a12 * z + 2 * b1;
+        const double rz = a02 * x + a12 * y + a22 * z + 2 * b2;
+        const double e = std::fabs(rx * x + ry * y + rz * z + c);
+        return w > 0 ? e / w : e;
+    }
+};
+
+// Borders are weighted stronger than faces to keep their shape
+const double BorderWeight = 10.0;
+
+enum class VertexKind {
+    Manifold, // may collapse to any neighbour
+    Border, // may collapse along the border only
+    Locked // is never removed
+};
+
+inline uint64_t EdgeKey(unsigned int a, unsigned int b) {
+    return (static_cast<uint64_t>(a) << 32) | b;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Simplifies the triangles of a mesh step by step, the state is kept between the levels so
+// every level continues with the result of the previous one.
+class MeshSimplifier {
+public:
+    MeshSimplifier(const aiMesh *mesh, bool lockBorders);
+
+    // Collapses edges until there are at most targetFaces faces left, no more edges can be
+    // collapsed or each collapse would exceed the given error, relative to the mesh extent.
+    void Simplify(unsigned int targetFaces, ai_real maxError);
+
+    const std::vector<unsigned int> &GetIndices() const {
+        return mIndices;
+    }
+
+    // Returns the largest error of all collapses so far, relative to the mesh extent
+    ai_real GetError() const {
+        return mExtent > 0 ? static_cast<ai_real>(std::sqrt(mError) / mExtent) : 0;
+    }
+
+private:
+    void ClassifyVertices(std::vector<VertexKind> &kinds, std::unordered_set<uint64_t> &edges) const;
+    bool HasFlips(unsigned int from, unsigned int to, const unsigned int *tris, unsigned int numTris) const;
+
+    const aiMesh *mMesh;
+    const bool mLockBorders;
+    std::vector<unsigned int> mIndices;
+    std::vector<unsigned int> mGroups;
+    std::vector<unsigned int> mWedges;
+    std::vector<uint64_t> mBoneSignatures;
+    std::vector<bool> mBoneBoundaries;
+    std::vector<Quadric> mQuadrics;
+    double mExtent = 0;
+    double mError = 0;
+};
+
+// ------------------------------------------------------------------------------------------------
+MeshSimplifier::MeshSimplifier(const aiMesh *mesh, bool lockBorders) :
+        mMesh(mesh), mLockBorders(lockBorders) {
+    const unsigned int numVertices = mesh->mNumVertices;
+    mIndices.reserve(mesh->mNumFaces * 3);
+    for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+        const aiFace &face = mesh->mFaces[i];
+        mIndices.insert(mIndices.end(), face.mIndices, face.mIndices + 3);
+    }
+
+    // vertices at the same position form a group, groups of several vertices are seams
+    SpatialSort sort(mesh->mVertices, numVertices, sizeof(aiVector3D));
+    const unsigned int numGroups = sort.GenerateMappingTable(mGroups, ComputePositionEpsilon(mesh));
+    mWedges.assign(numGroups, 0);
+    std::vector<bool> used(numVertices, false);
+    for (const unsigned int idx : mIndices) {
+        if (!used[idx]) {
+            used[idx] = true;
+            ++mWedges[mGroups[idx]];
+        }
+    }
+
+    // vertices influenced by the same bones have the same signature
+    mBoneSignatures.assign(numVertices, 0);
+    for (unsigned int b = 0; b < mesh->mNumBones; ++b) {
+        const aiBone *bone = mesh->mBones[b];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            const aiVertexWeight &weight = bone->mWeights[w];
+            if (weight.mWeight > 0 && weight.mVertexId < numVertices) {
+                uint64_t &signature = mBoneSignatures[weight.mVertexId];
+                signature = (signature ^ (b + 1)) * 0x100000001B3ull;
+            }
+        }
+    }
+
+    // vertices next to a vertex with other bones lie on a bone weight boundary
+    mBoneBoundaries.assign(numGroups, false);
+    for (size_t i = 0; i < mIndices.size(); i += 3) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            const unsigned int a = mIndices[i + k], b = mIndices[i + (k + 1) % 3];
+            if (mBoneSignatures[a] != mBoneSignatures[b]) {
+                mBoneBoundaries[mGroups[a]] = true;
+                mBoneBoundaries[mGroups[b]] = true;
+            }
+        }
+    }
+
+    aiVector3D min, max;
+    ArrayBounds(mesh->mVertices, numVertices, min, max);
+    mExtent = std::max(max.x - min.x, std::max(max.y - min.y, max.z - min.z));
+
+    // face quadrics weighted by area and border quadrics perpendicular to the faces
+    std::unordered_set<uint64_t> edges;
+    for (size_t i = 0; i < mIndices.size(); i += 3) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            edges.insert(EdgeKey(mGroups[mIndices[i + k]], mGroups[mIndices[i + (k + 1) % 3]]));
+        }
+    }
+    mQuadrics.resize(numGroups);
+    for (size_t i = 0; i < mIndices.size(); i += 3) {
+        const aiVector3D *p[3] = { &mesh->mVertices[mIndices[i]], &mesh->mVertices[mIndices[i + 1]], &mesh->mVertices[mIndices[i + 2]] };
+        aiVector3D normal = (*p[1] - *p[0]) ^ (*p[2] - *p[0]);
+        const ai_real length = normal.Length();
+        if (length <= 0) {
+            continue;
+        }
+        normal /= length;
+        for (unsigned int k = 0; k < 3; ++k) {
+            mQuadrics[mGroups[mIndices[i + k]]].AddPlane(normal, -(normal * *p[0]), length * 0.5);
+        }
+        for (unsigned int k = 0; k < 3; ++k) {
+            const unsigned int ga = mGroups[mIndices[i + k]], gb = mGroups[mIndices[i + (k + 1) % 3]];
+            if (edges.count(EdgeKey(gb, ga))) {
+                continue;
+            }
+            const aiVector3D edge = *p[(k + 1) % 3] - *p[k];
+            aiVector3D borderNormal = edge ^ normal;
+            const ai_real borderLength = borderNormal.Length();
+            if (borderLength <= 0) {
+                continue;
+            }
+            borderNormal /= borderLength;
+            const double weight = edge.SquareLength() * BorderWeight;
+            mQuadrics[ga].AddPlane(borderNormal, -(borderNormal * *p[k]), weight);
+            mQuadrics[gb].AddPlane(borderNormal, -(borderNormal * *p[k]), weight);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Finds the kind of each position group for the current faces
+void MeshSimplifier::ClassifyVertices(std::vector<VertexKind> &kinds, std::unordered_set<uint64_t> &edges) const {
+    edges.clear();
+    for (size_t i = 0; i < mIndices.size(); i += 3) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            edges.insert(EdgeKey(mGroups[mIndices[i + k]], mGroups[mIndices[i + (k + 1) % 3]]));
+        }
+    }
+
+    // count the border edges leaving and entering each group
+    std::vector<unsigned int> borderOut(mWedges.size(), 0), borderIn(mWedges.size(), 0);
+    for (const uint64_t edge : edges) {
+        const unsigned int ga = static_cast<unsigned int>(edge >> 32), gb = static_cast<unsigned int>(edge);
+        if (!edges.count(EdgeKey(gb, ga))) {
+            ++borderOut[ga];
+            ++borderIn[gb];
+        }
+    }
+
+    kinds.resize(mWedges.size());
+    for (size_t g = 0; g < mWedges.size(); ++g) {
+        if (mWedges[g] > 1 || mBoneBoundaries[g]) {
+            // seams and bone weight boundaries
+            kinds[g] = VertexKind::Locked;
+        } else if (borderOut[g] || borderIn[g]) {
+            // vertices where several borders meet are locked, too
+            const bool simpleBorder = 1 == borderOut[g] && 1 == borderIn[g];
+            kinds[g] = mLockBorders || !simpleBorder ? VertexKind::Locked : VertexKind::Border;
+        } else {
+            kinds[g] = VertexKind::Manifold;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Checks whether moving a vertex onto another one turns one of its remaining faces around
+bool MeshSimplifier::HasFlips(unsigned int from, unsigned int to, const unsigned int *tris, unsigned int numTris) const {
+    const aiVector3D *positions = mMesh->mVertices;
+    const unsigned int target = mGroups[to];
+    for (unsigned int t = 0; t < numTris; ++t) {
+        const unsigned int *tri = &mIndices[tris[t] * 3];
+        if (mGroups[tri[0]] == target || mGroups[tri[1]] == target || mGroups[tri[2]] == target) {
+            // this face is removed by the collapse
+            continue;
+        }
+        aiVector3D p[3], q[3];
+        for (unsigned int k = 0; k < 3; ++k) {
+            p[k] = positions[tri[k]];
+            q[k] = tri[k] == from ? positions[to] : p[k];
+        }
+        const aiVector3D before = (p[1] - p[0]) ^ (p[2] - p[0]);
+        const aiVector3D after = (q[1] - q[0]) ^ (q[2] - q[0]);
+        if (before * after < 0.25f * before.Length() * after.Length()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ------------------------------------------------------------------------------------------------
+void MeshSimplifier::Simplify(unsigned int targetFaces, ai_real maxError) {
+    const double errorLimit = static_cast<double>(maxError) * mExtent * static_cast<double>(maxError) * mExtent;
+    const unsigned int numVertices = mMesh->mNumVertices;
+
+    std::vector<VertexKind> kinds;
+    std::unordered_set<uint64_t> edges;
+    std::vector<unsigned int> triOffsets, triList, remap;
+    std::vector<bool> locked;
+
+    struct Collapse {
+        unsigned int from, to;
+        double cost;
+    };
+    std::vector<Collapse> collapses;
+
+    while (mIndices.size() / 3 > targetFaces) {
+        const unsigned int numFaces = static_cast<unsigned int>(mIndices.size() / 3);
+        ClassifyVertices(kinds, edges);
+
+        // faces around each vertex
+        triOffsets.assign(numVertices + 1, 0);
+        for (const unsigned int idx : mIndices) {
+            ++triOffsets[idx + 1];
+        }
+        for (unsigned int v = 0; v < numVertices; ++v) {
+            triOffsets[v + 1] += triOffsets[v];
+        }
+        triList.resize(mIndices.size());
+        {
+            std::vector<unsigned int> fill(triOffsets.begin(), triOffsets.end() - 1);
+            for (size_t i = 0; i < mIndices.size(); ++i) {
+                triList[fill[mIndices[i]]++] = static_cast<unsigned int>(i / 3);
+            }
+        }
+
+        // all allowed collapses along the edges of the faces
+        collapses.clear();
+        const auto consider = [&](unsigned int from, unsigned int to) {
+            const unsigned int ga = mGroups[from], gb = mGroups[to];
+            if (ga == gb || VertexKind::Locked == kinds[ga] || mBoneSignatures[from] != mBoneSignatures[to]) {
+                return;
+            }
+            if (VertexKind::Border == kinds[ga] && edges.count(EdgeKey(ga, gb)) && edges.count(EdgeKey(gb, ga))) {
+                // an inner edge, border vertices may only slide along the border
+                return;
+            }
+            const double cost = mQuadrics[ga].Error(mMesh->mVertices[to]);
+            if (cost <= errorLimit) {
+                collapses.push_back({ from, to, cost });
+            }
+        };
+        for (size_t i = 0; i < mIndices.size(); i += 3) {
+            for (unsigned int k = 0; k < 3; ++k) {
+                consider(mIndices[i + k], mIndices[i + (k + 1) % 3]);
+                consider(mIndices[i + (k + 1) % 3], mIndices[i + k]);
+            }
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse &a, const Collapse &b) {
+            return a.cost < b.cost || (a.cost == b.cost && (a.from < b.from || (a.from == b.from && a.to < b.to)));
+        });
+
+        // take the cheapest collapses which don't touch each other's faces
+        remap.resize(numVertices);
+        for (unsigned int v = 0; v < numVertices; ++v) {
+            remap[v] = v;
+        }
+        locked.assign(mWedges.size(), false);
+        unsigned int removed = 0, applied = 0;
+        for (const Collapse &collapse : collapses) {
+            if (removed >= numFaces - targetFaces) {
+                break;
+            }
+            const unsigned int ga = mGroups[collapse.from], gb = mGroups[collapse.to];
+            if (locked[ga] || locked[gb]) {
+                continue;
+            }
+            const unsigned int *tris = &triList[triOffsets[collapse.from]];
+            const unsigned int numTris = triOffsets[collapse.from + 1] - triOffsets[collapse.from];
+            if (HasFlips(collapse.from, collapse.to, tris, numTris)) {
+                continue;
+            }
+
+            remap[collapse.from] = collapse.to;
+            mQuadrics[gb] += mQuadrics[ga];
+            mError = std::max(mError, collapse.cost);
+            ++applied;
+            for (unsigned int t = 0; t < numTris; ++t) {
+                const unsigned int *tri = &mIndices[tris[t] * 3];
+                bool degenerate = false;
+                for (unsigned int k = 0; k < 3; ++k) {
+                    locked[mGroups[tri[k]]] = true;
+                    degenerate = degenerate || mGroups[tri[k]] == gb;
+                }
+                removed += degenerate ? 1 : 0;
+            }
+        }
+        if (0 == applied) {
+            break;
+        }
+
+        // remove the faces which collapsed
+        size_t out = 0;
+        for (size_t i = 0; i < mIndices.size(); i += 3) {
+            const unsigned int a = remap[mIndices[i]], b = remap[mIndices[i + 1]], c = remap[mIndices[i + 2]];
+            if (mGroups[a] == mGroups[b] || mGroups[b] == mGroups[c] || mGroups[c] == mGroups[a]) {
+                continue;
+            }
+            mIndices[out++] = a;
+            mIndices[out++] = b;
+            mIndices[out++] = c;
+        }
+        mIndices.resize(out);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+T *CopyVertexStream(const T *in, const std::vector<unsigned int> &remap, unsigned int numVertices) {
+    if (nullptr == in) {
+        return nullptr;
+    }
+    T *out = new T[numVertices];
+    for (size_t i = 0; i < remap.size(); ++i) {
+        if (~0u != remap[i]) {
+            out[remap[i]] = in[i];
+        }
+    }
+    return out;
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename MeshType>
+void CopyVertexStreams(const MeshType *in, MeshType *out, const std::vector<unsigned int> &remap) {
+    out->mNumVertices = static_cast<unsigned int>(std::count_if(remap.begin(), remap.end(), [](unsigned int v) {
+        return ~0u != v;
+    }));
+    out->mVertices = CopyVertexStream(in->mVertices, remap, out->mNumVertices);
+    out->mNormals = CopyVertexStream(in->mNormals, remap, out->mNumVertices);
+    out->mTangents = CopyVertexStream(in->mTangents, remap, out->mNumVertices);
+    out->mBitangents = CopyVertexStream(in->mBitangents, remap, out->mNumVertices);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+        out->mColors[i] = CopyVertexStream(in->mColors[i], remap, out->mNumVertices);
+    }
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        out->mTextureCoords[i] = CopyVertexStream(in->mTextureCoords[i], remap, out->mNumVertices);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Builds a mesh from the faces of a level, only the referenced vertices are kept
+aiMesh *CreateLODMesh(const aiMesh *in, const std::vector<unsigned int> &indices, unsigned int level) {
+    std::vector<unsigned int> remap(in->mNumVertices, ~0u);
+    unsigned int next = 0;
+    for (const unsigned int idx : indices) {
+        if (~0u == remap[idx]) {
+            remap[idx] = next++;
+        }
+    }
+
+    aiMesh *out = new aiMesh();
+    out->mName.Set(std::string(in->mName.C_Str()) + "_LOD" + ai_to_string(level));
+    out->mMaterialIndex = in->mMaterialIndex;
+    out->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+    out->mMethod = in->mMethod;
+    CopyVertexStreams(in, out, remap);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        out->mNumUVComponents[i] = in->mNumUVComponents[i];
+        if (in->HasTextureCoordsName(i)) {
+            out->SetTextureCoordsName(i, *in->mTextureCoordsNames[i]);
+        }
+    }
+
+    out->mNumFaces = static_cast<unsigned int>(indices.size() / 3);
+    out->mFaces = new aiFace[out->mNumFaces];
+    for (unsigned int i = 0; i < out->mNumFaces; ++i) {
+        aiFace &face = out->mFaces[i];
+        face.mIndices = new unsigned int[face.mNumIndices = 3];
+        for (unsigned int k = 0; k < 3; ++k) {
+            face.mIndices[k] = remap[indices[i * 3 + k]];
+        }
+    }
+
+    // keep the bones which still influence a vertex
+    std::vector<aiBone *> bones;
+    for (unsigned int b = 0; b < in->mNumBones; ++b) {
+        const aiBone *inBone = in->mBones[b];
+        std::vector<aiVertexWeight> weights;
+        for (unsigned int w = 0; w < inBone->mNumWeights; ++w) {
+            const aiVertexWeight &weight = inBone->mWeights[w];
+            if (weight.mVertexId < in->mNumVertices && ~0u != remap[weight.mVertexId]) {
+                weights.emplace_back(remap[weight.mVertexId], weight.mWeight);
+            }
+        }
+        if (weights.empty()) {
+            continue;
+        }
+        aiBone *bone = new aiBone();
+        bone->mName = inBone->mName;
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+        bone->mArmature = inBone->mArmature;
+        bone->mNode = inBone->mNode;
+#endif
+        bone->mOffsetMatrix = inBone->mOffsetMatrix;
+        bone->mNumWeights = static_cast<unsigned int>(weights.size());
+        bone->mWeights = new aiVertexWeight[bone->mNumWeights];
+        std::copy(weights.begin(), weights.end(), bone->mWeights);
+        bones.push_back(bone);
+    }
+    if (!bones.empty()) {
+        out->mNumBones = static_cast<unsigned int>(bones.size());
+        out->mBones = new aiBone *[out->mNumBones];
+        std::copy(bones.begin(), bones.end(), out->mBones);
+    }
+
+    std::vector<aiAnimMesh *> animMeshes;
+    for (unsigned int i = 0; i < in->mNumAnimMeshes; ++i) {
+        const aiAnimMesh *inAnim = in->mAnimMeshes[i];
+        if (inAnim->mNumVertices != in->mNumVertices) {
+            continue;
+        }
+        aiAnimMesh *anim = new aiAnimMesh();
+        anim->mName = inAnim->mName;
+        anim->mWeight = inAnim->mWeight;
+        CopyVertexStreams(inAnim, anim, remap);
+        animMeshes.push_back(anim);
+    }
+    if (!animMeshes.empty()) {
+        out->mNumAnimMeshes = static_cast<unsigned int>(animMeshes.size());
+        out->mAnimMeshes = new aiAnimMesh *[out->mNumAnimMeshes];
+        std::copy(animMeshes.begin(), animMeshes.end(), out->mAnimMeshes);
+    }
+    return out;
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+GenLODsProcess::GenLODsProcess() :
+        mConfigRatios(), mConfigMaxError(AI_LOD_DEFAULT_MAX_ERROR), mConfigLockBorders(true) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenLODsProcess::IsActive(aiPostProcessStepMask pFlags) const {
+    return 0 != (pFlags & aiProcess_GenerateLODs);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsProcess::SetupProperties(const Importer *pImp) {
+    // AI_CONFIG_PP_LOD_RATIOS is a list of face ratios separated by whitespace
+    const std::string ratios = pImp->GetPropertyString(AI_CONFIG_PP_LOD_RATIOS, AI_LOD_DEFAULT_RATIOS);
+    mConfigRatios.clear();
+    const char *cur = ratios.c_str();
+    for (;;) {
+        char *end = nullptr;
+        const double ratio = std::strtod(cur, &end);
+        if (end == cur) {
+            break;
+        }
+        cur = end;
+        if (ratio > 0.0 && ratio < 1.0) {
+            mConfigRatios.push_back(static_cast<ai_real>(ratio));
+        } else {
+            ASSIMP_LOG_WARN("GenLODsProcess: Ignoring LOD ratio ", ratio, ", it must be between 0 and 1");
+        }
+    }
+    std::sort(mConfigRatios.begin(), mConfigRatios.end(), std::greater<ai_real>());
+    mConfigRatios.erase(std::unique(mConfigRatios.begin(), mConfigRatios.end()), mConfigRatios.end());
+
+    mConfigMaxError = pImp->GetPropertyFloat(AI_CONFIG_PP_LOD_MAX_ERROR, AI_LOD_DEFAULT_MAX_ERROR);
+    mConfigLockBorders = pImp->GetPropertyBool(AI_CONFIG_PP_LOD_LOCK_BORDERS, true);
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenLODsProcess::ProcessMesh(const aiMesh *pMesh, std::vector<aiMesh *> &lods, std::vector<ai_real> &errors) const {
+    lods.clear();
+    errors.clear();
+    if (!pMesh->HasFaces() || !pMesh->HasPositions() || pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
+        return false;
+    }
+
+    MeshSimplifier simplifier(pMesh, mConfigLockBorders);
+    for (size_t l = 0; l < mConfigRatios.size(); ++l) {
+        const unsigned int target = static_cast<unsigned int>(pMesh->mNumFaces * mConfigRatios[l]);
+        simplifier.Simplify(target, mConfigMaxError);
+        if (simplifier.GetIndices().empty()) {
+            // keep the previous level rather than an empty mesh
+            break;
+        }
+        lods.push_back(CreateLODMesh(pMesh, simplifier.GetIndices(), static_cast<unsigned int>(l + 1)));
+        errors.push_back(simplifier.GetError());
+    }
+    return !lods.empty();
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("GenLODsProcess begin");
+    if (mConfigRatios.empty() || 0 == pScene->mNumMeshes) {
+        ASSIMP_LOG_DEBUG("GenLODsProcess finished. There was nothing to be done.");
+        return;
+    }
+
+    std::vector<std::vector<aiMesh *>> lods(pScene->mNumMeshes);
+    std::vector<std::vector<ai_real>> lodErrors(pScene->mNumMeshes);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
+        ProcessMesh(pScene->mMeshes[a], lods[a], lodErrors[a]);
+    });
+
+    // append the new meshes in mesh order
+    unsigned int numNew = 0;
+    for (const std::vector<aiMesh *> &meshLods : lods) {
+        numNew += static_cast<unsigned int>(meshLods.size());
+    }
+    if (0 == numNew) {
+        ASSIMP_LOG_DEBUG("GenLODsProcess finished. There was nothing to be done.");
+        return;
+    }
+    aiMesh **meshes = new aiMesh *[pScene->mNumMeshes + numNew];
+    std::copy(pScene->mMeshes, pScene->mMeshes + pScene->mNumMeshes, meshes);
+    std::vector<std::vector<unsigned int>> lodMeshes(pScene->mNumMeshes);
+    unsigned int next = pScene->mNumMeshes;
+    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+        for (aiMesh *lod : lods[a]) {
+            lodMeshes[a].push_back(next);
+            meshes[next++] = lod;
+        }
+    }
+    delete[] pScene->mMeshes;
+    pScene->mMeshes = meshes;
+    pScene->mNumMeshes = next;
+
+    AddLODNodes(pScene->mRootNode, lodMeshes, lodErrors);
+
+    if (!DefaultLogger::isNullLogger()) {
+        ASSIMP_LOG_INFO("GenLODsProcess finished. Generated ", numNew, " LOD meshes");
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenLODsProcess::AddLODNodes(aiNode *pNode, const std::vector<std::vector<unsigned int>> &lodMeshes,
+        const std::vector<std::vector<ai_real>> &lodErrors) const {
+    for (unsigned int i = 0; i < pNode->mNumChildren; ++i) {
+        AddLODNodes(pNode->mChildren[i], lodMeshes, lodErrors);
+    }
+
+    // one child per level referencing the levels of all simplified meshes of this node
+    std::vector<aiNode *> children;
+    for (size_t l = 0; l < mConfigRatios.size(); ++l) {
+        std::vector<unsigned int> meshes;
+        ai_real error = 0;
+        for (unsigned int i = 0; i < pNode->mNumMeshes; ++i) {
+            const unsigned int mesh = pNode->mMeshes[i];
+            if (l < lodMeshes[mesh].size()) {
+                meshes.push_back(lodMeshes[mesh][l]);
+                error = std::max(error, lodErrors[mesh][l]);
+            }
+        }
+        if (meshes.empty()) {
+            break;
+        }
+
+        const unsigned int level = static_cast<unsigned int>(l + 1);
+        aiNode *child = new aiNode(std::string(pNode->mName.C_Str()) + "_LOD" + ai_to_string(level));
+        child->mParent = pNode;
+        child->mNumMeshes = static_cast<unsigned int>(meshes.size());
+        child->mMeshes = new unsigned int[child->mNumMeshes];
+        std::copy(meshes.begin(), meshes.end(), child->mMeshes);
+        if (pNode->mNumInstances) {
+            child->mNumInstances = pNode->mNumInstances;
+            child->mInstanceTransforms = new aiMatrix4x4[child->mNumInstances];
+            std::copy(pNode->mInstanceTransforms, pNode->mInstanceTransforms + pNode->mNumInstances, child->mInstanceTransforms);
+        }
+        child->mMetaData = aiMetadata::Alloc(3);
+        child->mMetaData->Set(0, AI_LOD_METADATA_LEVEL, static_cast<int32_t>(level));
+        child->mMetaData->Set(1, AI_LOD_METADATA_RATIO, static_cast<float>(mConfigRatios[l]));
+        child->mMetaData->Set(2, AI_LOD_METADATA_ERROR, static_cast<float>(error));
+        children.push_back(child);
+    }
+    if (!children.empty()) {
+        pNode->addChildren(static_cast<unsigned int>(children.size()), children.data());
+    }
+}
+
+} // Namespace Assimp
+
+#endif // ASSIMP_BUILD_NO_GENLODS_PROCESS
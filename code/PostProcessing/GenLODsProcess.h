@@ -0,0 +1,126 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Defines a post-processing step to generate simplified levels of detail
+ *        for all triangle meshes.
+ */
+
+#pragma once
+
+#ifndef AI_GENLODSPROCESS_H_INC
+#define AI_GENLODSPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+
+#include "Common/BaseProcess.h"
+
+#include <vector>
+
+struct aiMesh;
+struct aiNode;
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** The GenLODsProcess simplifies all triangle meshes with a quadric error
+ *  edge collapse simplifier and adds the levels of detail as new meshes.
+ *  For every node referencing simplified meshes one child node per level
+ *  is added, its metadata holds the level, the ratio and the error.
+ *
+ *  @note This step expects triangulated input data with joined vertices.
+ */
+class ASSIMP_API GenLODsProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    GenLODsProcess();
+    ~GenLODsProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Will return true, if aiProcess_GenerateLODs is defined.
+    bool IsActive(aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "GenLODsProcess";
+    }
+
+    // -------------------------------------------------------------------
+    /// @brief Reads the ratios, the error limit and the border handling.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /** Simplifies a mesh to the configured levels of detail.
+     * @param pMesh The triangle mesh to simplify.
+     * @param lods Receives one new mesh per level.
+     * @param errors Receives the error of each level, relative to the
+     *   extent of the mesh.
+     * @return false if the mesh can't be simplified. */
+    bool ProcessMesh(const aiMesh *pMesh, std::vector<aiMesh *> &lods, std::vector<ai_real> &errors) const;
+
+protected:
+    // -------------------------------------------------------------------
+    /** Adds the level of detail nodes below a node and its children. */
+    void AddLODNodes(aiNode *pNode, const std::vector<std::vector<unsigned int>> &lodMeshes,
+            const std::vector<std::vector<ai_real>> &lodErrors) const;
+
+private:
+    //! Configuration parameter: the face ratios of the levels, descending.
+    std::vector<ai_real> mConfigRatios;
+
+    //! Configuration parameter: the largest error of an edge collapse,
+    //! relative to the extent of the mesh.
+    ai_real mConfigMaxError;
+
+    //! Configuration parameter: don't move vertices on open borders.
+    bool mConfigLockBorders;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_GENLODS_PROCESS
+
+#endif // AI_GENLODSPROCESS_H_INC
@@ -49,18 +49,20 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exceptional.h>
 #include <assimp/qnan.h>
 
+#include <atomic>
+
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 GenVertexNormalsProcess::GenVertexNormalsProcess() :
-        configMaxAngle(AI_DEG_TO_RAD(175.f)) {
+        configMaxAngle(AI_DEG_TO_RAD(175.f)), configSpatialIndex(0) {
     // empty
 }
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool GenVertexNormalsProcess::IsActive(unsigned int pFlags) const {
+bool GenVertexNormalsProcess::IsActive(aiPostProcessStepMask pFlags) const {
     force_ = (pFlags & aiProcess_ForceGenNormals) != 0;
     flippedWindingOrder_ = (pFlags & aiProcess_FlipWindingOrder) != 0;
     leftHanded_ = (pFlags & aiProcess_MakeLeftHanded) != 0;
@@ -73,6 +75,8 @@ void GenVertexNormalsProcess::SetupProperties(const Importer *pImp) {
     // Get the current value of the AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE property
     configMaxAngle = pImp->GetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, (ai_real)175.0);
     configMaxAngle = AI_DEG_TO_RAD(std::max(std::min(configMaxAngle, (ai_real)175.0), (ai_real)0.0));
+
+    configSpatialIndex = pImp->GetPropertyInteger(AI_CONFIG_PP_SPATIAL_INDEX, 0);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -84,11 +88,11 @@ void GenVertexNormalsProcess::Execute(aiScene *pScene) {
         throw DeadlyImportError("Post-processing order mismatch: expecting pseudo-indexed (\"verbose\") vertices here");
     }
 
-    bool bHas = false;
-    for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+    std::atomic<bool> bHas(false);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
         if (GenMeshVertexNormals(pScene->mMeshes[a], a))
             bHas = true;
-    }
+    });
 
     if (bHas) {
         ASSIMP_LOG_INFO("GenVertexNormalsProcess finished. "
@@ -168,6 +172,7 @@ bool GenVertexNormalsProcess::GenMeshVertexNormals(aiMesh *pMesh, unsigned int m
         vertexFinder = &_vertexFinder;
         posEpsilon = ComputePositionEpsilon(pMesh);
     }
+    SelectSpatialIndex(*vertexFinder, posEpsilon, configSpatialIndex);
     std::vector<unsigned int> verticesFound;
     aiVector3D *pcNew = new aiVector3D[pMesh->mNumVertices];
 
@@ -71,7 +71,13 @@ public:
     * @return true if the process is present in this flag fields,
     *   false if not.
     */
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "GenVertexNormalsProcess";
+    }
 
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
@@ -103,6 +109,8 @@ public:
 private:
     /** Configuration option: maximum smoothing angle, in radians*/
     ai_real configMaxAngle;
+    /** Configuration option: spatial index selection, see AI_CONFIG_PP_SPATIAL_INDEX */
+    int configSpatialIndex;
     mutable bool force_ = false;
     mutable bool flippedWindingOrder_ = false;
     mutable bool leftHanded_ = false;
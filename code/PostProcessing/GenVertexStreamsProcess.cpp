@@ -0,0 +1,427 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Implementation of the post-processing step to generate interleaved vertex streams.
+ *
+ * Every attribute starts on a 4-byte boundary. Positions and texture coordinates in normalized
+ * formats are stored relative to their bounds, normals and tangents in normalized formats use
+ * the octahedral mapping of the unit sphere onto the square [-1, 1]^2.
+ */
+
+#ifndef ASSIMP_BUILD_NO_GENVERTEXSTREAMS_PROCESS
+
+#include "PostProcessing/GenVertexStreamsProcess.h"
+
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Assimp {
+
+namespace {
+
+// Property value to leave an attribute out of the stream.
+constexpr int SkipAttribute = -1;
+
+// ------------------------------------------------------------------------------------------------
+// Converts to an IEEE half-float, rounding to nearest even.
+uint16_t FloatToHalf(float value) {
+    uint32_t bits;
+    ::memcpy(&bits, &value, sizeof(bits));
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    uint32_t abs = bits & 0x7fffffffu;
+
+    if (abs >= 0x7f800000u) {
+        // infinity or NaN
+        return sign | 0x7c00u | (abs > 0x7f800000u ? 0x200u : 0u);
+    }
+    if (abs >= 0x477ff000u) {
+        // 65520 and above round to infinity
+        return sign | 0x7c00u;
+    }
+    if (abs < 0x38800000u) {
+        // below 2^-14 the result is subnormal, count multiples of 2^-24
+        float a;
+        ::memcpy(&a, &abs, sizeof(a));
+        return sign | static_cast<uint16_t>(std::nearbyint(a * 16777216.0f));
+    }
+    abs -= 0x38000000u; // rebias the exponent from 127 to 15
+    return sign | static_cast<uint16_t>((abs + 0xfffu + ((abs >> 13) & 1u)) >> 13);
+}
+
+// ------------------------------------------------------------------------------------------------
+unsigned int GetFormatSize(aiVertexFormat format) {
+    switch (format) {
+    case aiVertexFormat_Float32:
+        return 4;
+    case aiVertexFormat_Float16:
+    case aiVertexFormat_Unorm16:
+    case aiVertexFormat_Snorm16:
+        return 2;
+    default:
+        return 1;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+bool IsNormalized(aiVertexFormat format) {
+    return format != aiVertexFormat_Float32 && format != aiVertexFormat_Float16;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Writes num components in the given format, normalized formats are clamped to their range.
+void EncodeComponents(unsigned char *dest, aiVertexFormat format, const float *values, unsigned int num) {
+    for (unsigned int i = 0; i < num; ++i) {
+        const float v = values[i];
+        switch (format) {
+        case aiVertexFormat_Float32:
+            ::memcpy(dest + i * 4, &v, 4);
+            break;
+        case aiVertexFormat_Float16: {
+            const uint16_t h = FloatToHalf(v);
+            ::memcpy(dest + i * 2, &h, 2);
+            break;
+        }
+        case aiVertexFormat_Unorm16: {
+            const uint16_t u = static_cast<uint16_t>(std::lround(std::min(std::max(v, 0.0f), 1.0f) * 65535.0f));
+            ::memcpy(dest + i * 2, &u, 2);
+            break;
+        }
+        case aiVertexFormat_Snorm16: {
+            const int16_t s = static_cast<int16_t>(std::lround(std::min(std::max(v, -1.0f), 1.0f) * 32767.0f));
+            ::memcpy(dest + i * 2, &s, 2);
+            break;
+        }
+        case aiVertexFormat_Unorm8:
+            dest[i] = static_cast<uint8_t>(std::lround(std::min(std::max(v, 0.0f), 1.0f) * 255.0f));
+            break;
+        case aiVertexFormat_Snorm8: {
+            const int8_t s = static_cast<int8_t>(std::lround(std::min(std::max(v, -1.0f), 1.0f) * 127.0f));
+            ::memcpy(dest + i, &s, 1);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Maps a unit vector onto the octahedron and unfolds it into [-1, 1]^2.
+void EncodeOctahedral(const aiVector3D &v, float *out) {
+    const float l1 = std::fabs(static_cast<float>(v.x)) + std::fabs(static_cast<float>(v.y)) + std::fabs(static_cast<float>(v.z));
+    if (l1 <= 0.0f) {
+        out[0] = out[1] = 0.0f;
+        return;
+    }
+    float x = static_cast<float>(v.x) / l1;
+    float y = static_cast<float>(v.y) / l1;
+    if (v.z < 0) {
+        const float fx = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float fy = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+    out[0] = x;
+    out[1] = y;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Validates a format property. Formats the attribute can't store in a normalized way are
+// replaced by their signed or unsigned counterpart.
+int SelectFormat(int requested, int fallback, bool isSigned, const char *name) {
+    if (requested == SkipAttribute) {
+        return SkipAttribute;
+    }
+    if (requested < aiVertexFormat_Float32 || requested > aiVertexFormat_Snorm8) {
+        ASSIMP_LOG_WARN("GenVertexStreamsProcess: Unknown ", name, " format ", requested, ", using ", fallback);
+        return fallback;
+    }
+    switch (requested) {
+    case aiVertexFormat_Unorm16:
+    case aiVertexFormat_Snorm16:
+        return isSigned ? aiVertexFormat_Snorm16 : aiVertexFormat_Unorm16;
+    case aiVertexFormat_Unorm8:
+    case aiVertexFormat_Snorm8:
+        return isSigned ? aiVertexFormat_Snorm8 : aiVertexFormat_Unorm8;
+    default:
+        return requested;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Sets up the decode transform of an attribute quantized relative to its bounds.
+void SetBounds(aiVertexAttribute &attr, const aiVector3D &min, const aiVector3D &max) {
+    if (!IsNormalized(attr.mFormat)) {
+        return;
+    }
+    attr.mDecodeOffset = min;
+    attr.mDecodeScale = max - min;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Applies the inverse of the decode transform of an attribute.
+void ToNormalized(const aiVertexAttribute &attr, float *values) {
+    for (unsigned int i = 0; i < attr.mNumComponents && i < 3; ++i) {
+        const float scale = static_cast<float>(attr.mDecodeScale[i]);
+        values[i] = scale != 0.0f ? (values[i] - static_cast<float>(attr.mDecodeOffset[i])) / scale : 0.0f;
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+GenVertexStreamsProcess::GenVertexStreamsProcess() :
+        mConfigPositionFormat(aiVertexFormat_Unorm16),
+        mConfigNormalFormat(aiVertexFormat_Snorm16),
+        mConfigTangentFormat(aiVertexFormat_Snorm16),
+        mConfigColorFormat(aiVertexFormat_Unorm8),
+        mConfigTexCoordFormat(aiVertexFormat_Unorm16) {
+    // empty
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenVertexStreamsProcess::IsActive(aiPostProcessStepMask pFlags) const {
+    return 0 != (pFlags & aiProcess_GenVertexStreams);
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenVertexStreamsProcess::SetupProperties(const Importer *pImp) {
+    mConfigPositionFormat = SelectFormat(pImp->GetPropertyInteger(AI_CONFIG_PP_GVS_POSITION_FORMAT, aiVertexFormat_Unorm16),
+            aiVertexFormat_Unorm16, false, "position");
+    mConfigNormalFormat = SelectFormat(pImp->GetPropertyInteger(AI_CONFIG_PP_GVS_NORMAL_FORMAT, aiVertexFormat_Snorm16),
+            aiVertexFormat_Snorm16, true, "normal");
+    mConfigTangentFormat = SelectFormat(pImp->GetPropertyInteger(AI_CONFIG_PP_GVS_TANGENT_FORMAT, aiVertexFormat_Snorm16),
+            aiVertexFormat_Snorm16, true, "tangent");
+    mConfigColorFormat = SelectFormat(pImp->GetPropertyInteger(AI_CONFIG_PP_GVS_COLOR_FORMAT, aiVertexFormat_Unorm8),
+            aiVertexFormat_Unorm8, false, "color");
+    mConfigTexCoordFormat = SelectFormat(pImp->GetPropertyInteger(AI_CONFIG_PP_GVS_TEXCOORD_FORMAT, aiVertexFormat_Unorm16),
+            aiVertexFormat_Unorm16, false, "texture coordinate");
+}
+
+// ------------------------------------------------------------------------------------------------
+bool GenVertexStreamsProcess::ProcessMesh(aiMesh *pMesh) const {
+    delete pMesh->mVertexStream;
+    pMesh->mVertexStream = nullptr;
+    if (!pMesh->HasPositions() || 0 == pMesh->mNumVertices) {
+        return false;
+    }
+    const unsigned int numVertices = pMesh->mNumVertices;
+
+    // collect the attributes in their interleaved order
+    std::vector<aiVertexAttribute> attributes;
+    auto addAttribute = [&attributes](aiVertexAttributeType type, unsigned int index, int format, unsigned int numComponents) {
+        aiVertexAttribute attr;
+        attr.mType = type;
+        attr.mIndex = index;
+        attr.mFormat = static_cast<aiVertexFormat>(format);
+        attr.mNumComponents = numComponents;
+        attributes.push_back(attr);
+        return &attributes.back();
+    };
+
+    if (mConfigPositionFormat != SkipAttribute) {
+        aiVector3D min = pMesh->mVertices[0], max = pMesh->mVertices[0];
+        for (unsigned int i = 1; i < numVertices; ++i) {
+            min = aiVector3D(std::min(min.x, pMesh->mVertices[i].x), std::min(min.y, pMesh->mVertices[i].y), std::min(min.z, pMesh->mVertices[i].z));
+            max = aiVector3D(std::max(max.x, pMesh->mVertices[i].x), std::max(max.y, pMesh->mVertices[i].y), std::max(max.z, pMesh->mVertices[i].z));
+        }
+        // prefer the bounding box of the mesh as long as it encloses all vertices
+        const aiAABB &aabb = pMesh->mAABB;
+        if (aabb.mMin != aabb.mMax && aabb.mMin.x <= min.x && aabb.mMin.y <= min.y && aabb.mMin.z <= min.z &&
+                aabb.mMax.x >= max.x && aabb.mMax.y >= max.y && aabb.mMax.z >= max.z) {
+            min = aabb.mMin;
+            max = aabb.mMax;
+        }
+        SetBounds(*addAttribute(aiVertexAttributeType_Position, 0, mConfigPositionFormat, 3), min, max);
+    }
+    if (mConfigNormalFormat != SkipAttribute && pMesh->HasNormals()) {
+        addAttribute(aiVertexAttributeType_Normal, 0, mConfigNormalFormat, IsNormalized(static_cast<aiVertexFormat>(mConfigNormalFormat)) ? 2 : 3);
+    }
+    if (mConfigTangentFormat != SkipAttribute && pMesh->HasTangentsAndBitangents()) {
+        addAttribute(aiVertexAttributeType_Tangent, 0, mConfigTangentFormat, IsNormalized(static_cast<aiVertexFormat>(mConfigTangentFormat)) ? 3 : 4);
+    }
+    if (mConfigColorFormat != SkipAttribute) {
+        for (unsigned int c = 0; pMesh->HasVertexColors(c); ++c) {
+            addAttribute(aiVertexAttributeType_Color, c, mConfigColorFormat, 4);
+        }
+    }
+    if (mConfigTexCoordFormat != SkipAttribute) {
+        for (unsigned int c = 0; pMesh->HasTextureCoords(c); ++c) {
+            const unsigned int numComponents = std::min(std::max(pMesh->mNumUVComponents[c], 1u), 3u);
+            aiVector3D min = pMesh->mTextureCoords[c][0], max = pMesh->mTextureCoords[c][0];
+            for (unsigned int i = 1; i < numVertices; ++i) {
+                const aiVector3D &uv = pMesh->mTextureCoords[c][i];
+                min = aiVector3D(std::min(min.x, uv.x), std::min(min.y, uv.y), std::min(min.z, uv.z));
+                max = aiVector3D(std::max(max.x, uv.x), std::max(max.y, uv.y), std::max(max.z, uv.z));
+            }
+            SetBounds(*addAttribute(aiVertexAttributeType_TextureCoords, c, mConfigTexCoordFormat, numComponents), min, max);
+        }
+    }
+    if (attributes.empty()) {
+        return false;
+    }
+
+    // lay out the vertex, every attribute is 4-byte aligned
+    unsigned int stride = 0;
+    for (aiVertexAttribute &attr : attributes) {
+        attr.mOffset = stride;
+        stride += (attr.mNumComponents * GetFormatSize(attr.mFormat) + 3u) & ~3u;
+    }
+
+    aiVertexStream *stream = new aiVertexStream();
+    stream->mNumVertices = numVertices;
+    stream->mStride = stride;
+    stream->mNumAttributes = static_cast<unsigned int>(attributes.size());
+    stream->mAttributes = new aiVertexAttribute[attributes.size()];
+    std::copy(attributes.begin(), attributes.end(), stream->mAttributes);
+    stream->mData = new unsigned char[static_cast<size_t>(numVertices) * stride]();
+
+    for (const aiVertexAttribute &attr : attributes) {
+        const bool normalized = IsNormalized(attr.mFormat);
+        for (unsigned int i = 0; i < numVertices; ++i) {
+            float values[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            switch (attr.mType) {
+            case aiVertexAttributeType_Position:
+            case aiVertexAttributeType_TextureCoords: {
+                const aiVector3D &v = attr.mType == aiVertexAttributeType_Position ? pMesh->mVertices[i] : pMesh->mTextureCoords[attr.mIndex][i];
+                values[0] = static_cast<float>(v.x);
+                values[1] = static_cast<float>(v.y);
+                values[2] = static_cast<float>(v.z);
+                if (normalized) {
+                    ToNormalized(attr, values);
+                }
+                break;
+            }
+            case aiVertexAttributeType_Normal: {
+                const aiVector3D &n = pMesh->mNormals[i];
+                if (normalized) {
+                    EncodeOctahedral(n, values);
+                } else {
+                    values[0] = static_cast<float>(n.x);
+                    values[1] = static_cast<float>(n.y);
+                    values[2] = static_cast<float>(n.z);
+                }
+                break;
+            }
+            case aiVertexAttributeType_Tangent: {
+                const aiVector3D &t = pMesh->mTangents[i];
+                // the bitangent is rebuilt from normal and tangent, keep its direction only
+                float handedness = 1.0f;
+                if (pMesh->HasNormals() && ((pMesh->mNormals[i] ^ t) * pMesh->mBitangents[i]) < 0) {
+                    handedness = -1.0f;
+                }
+                if (normalized) {
+                    EncodeOctahedral(t, values);
+                    values[2] = handedness;
+                } else {
+                    values[0] = static_cast<float>(t.x);
+                    values[1] = static_cast<float>(t.y);
+                    values[2] = static_cast<float>(t.z);
+                    values[3] = handedness;
+                }
+                break;
+            }
+            case aiVertexAttributeType_Color: {
+                const aiColor4D &c = pMesh->mColors[attr.mIndex][i];
+                values[0] = static_cast<float>(c.r);
+                values[1] = static_cast<float>(c.g);
+                values[2] = static_cast<float>(c.b);
+                values[3] = static_cast<float>(c.a);
+                break;
+            }
+            default:
+                break;
+            }
+            EncodeComponents(stream->mData + static_cast<size_t>(i) * stride + attr.mOffset, attr.mFormat, values, attr.mNumComponents);
+        }
+    }
+
+    pMesh->mVertexStream = stream;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------
+void GenVertexStreamsProcess::Execute(aiScene *pScene) {
+    ASSIMP_LOG_DEBUG("GenVertexStreamsProcess begin");
+    if (0 == pScene->mNumMeshes) {
+        ASSIMP_LOG_DEBUG("GenVertexStreamsProcess finished. There was nothing to be done.");
+        return;
+    }
+
+    std::atomic<unsigned int> numStreams(0);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
+        if (ProcessMesh(pScene->mMeshes[a])) {
+            ++numStreams;
+        }
+    });
+
+    if (!DefaultLogger::isNullLogger()) {
+        size_t inBytes = 0, outBytes = 0;
+        for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
+            const aiMesh *mesh = pScene->mMeshes[a];
+            if (!mesh->HasVertexStream()) {
+                continue;
+            }
+            size_t floats = 0;
+            for (unsigned int i = 0; i < mesh->mVertexStream->mNumAttributes; ++i) {
+                const aiVertexAttribute &attr = mesh->mVertexStream->mAttributes[i];
+                floats += attr.mType == aiVertexAttributeType_Color ? 4 : (attr.mType == aiVertexAttributeType_Tangent ? 6 : 3);
+            }
+            inBytes += floats * sizeof(ai_real) * mesh->mNumVertices;
+            outBytes += static_cast<size_t>(mesh->mVertexStream->mStride) * mesh->mNumVertices;
+        }
+        ASSIMP_LOG_INFO("GenVertexStreamsProcess finished. Packed ", numStreams.load(), " meshes, ",
+                inBytes, " bytes of vertex data into ", outBytes, " bytes");
+    }
+}
+
+} // Namespace Assimp
+
+#endif // ASSIMP_BUILD_NO_GENVERTEXSTREAMS_PROCESS
@@ -0,0 +1,109 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+
+/** @file Defines a post-processing step to pack the vertex data of all meshes
+ *        into interleaved, quantized vertex streams.
+ */
+
+#pragma once
+
+#ifndef AI_GENVERTEXSTREAMSPROCESS_H_INC
+#define AI_GENVERTEXSTREAMSPROCESS_H_INC
+
+#ifndef ASSIMP_BUILD_NO_GENVERTEXSTREAMS_PROCESS
+
+#include "Common/BaseProcess.h"
+
+#include <assimp/mesh.h>
+
+namespace Assimp {
+
+// ---------------------------------------------------------------------------
+/** The GenVertexStreamsProcess packs positions, normals, tangents, colors
+ *  and texture coordinates of every mesh into an aiVertexStream, each one
+ *  in a configurable aiVertexFormat. The float data of the meshes is kept.
+ */
+class ASSIMP_API GenVertexStreamsProcess : public BaseProcess {
+public:
+    // -------------------------------------------------------------------
+    /// The default class constructor / destructor.
+    GenVertexStreamsProcess();
+    ~GenVertexStreamsProcess() override = default;
+
+    // -------------------------------------------------------------------
+    /// @brief Will return true, if aiProcess_GenVertexStreams is defined.
+    bool IsActive(aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "GenVertexStreamsProcess";
+    }
+
+    // -------------------------------------------------------------------
+    /// @brief Reads the formats of the attributes.
+    void SetupProperties(const Importer *pImp) override;
+
+    // -------------------------------------------------------------------
+    /// @brief The execution callback.
+    void Execute(aiScene *pScene) override;
+
+    // -------------------------------------------------------------------
+    /** Builds the vertex stream of a mesh, replacing an existing one.
+     * @param pMesh The mesh to process.
+     * @return false if the mesh has no vertex data to pack. */
+    bool ProcessMesh(aiMesh *pMesh) const;
+
+private:
+    //! Configuration parameter: the formats of the positions, normals,
+    //! tangents, colors and texture coordinates, -1 to skip them.
+    int mConfigPositionFormat;
+    int mConfigNormalFormat;
+    int mConfigTangentFormat;
+    int mConfigColorFormat;
+    int mConfigTexCoordFormat;
+};
+
+} // Namespace Assimp
+
+#endif // #ifndef ASSIMP_BUILD_NO_GENVERTEXSTREAMS_PROCESS
+
+#endif // AI_GENVERTEXSTREAMSPROCESS_H_INC
@@ -41,9 +41,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 /** @file Implementation of the post processing step to improve the cache locality of a mesh.
  * <br>
- * The algorithm is roughly basing on this paper:
+ * The faces are ordered either roughly basing on the Tipsify algorithm:
  * http://www.cs.princeton.edu/gfx/pubs/Sander_2007_%3ETR/tipsy.pdf
- *   .. although overdraw reduction isn't implemented yet ...
+ * or with Tom Forsyth's "Linear-Speed Vertex Cache Optimisation":
+ * https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+ * Overdraw is reduced by sorting clusters of the optimized faces as described in the
+ * Tipsify paper. At last the vertices can be reordered in the order of their first use.
  */
 
 // internal headers
@@ -54,21 +57,27 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/DefaultLogger.hpp>
+#include <algorithm>
+#include <cmath>
 #include <stdio.h>
 #include <stack>
+#include <vector>
 
 namespace Assimp {
 
 // ------------------------------------------------------------------------------------------------
 // Constructor to be privately used by Importer
 ImproveCacheLocalityProcess::ImproveCacheLocalityProcess() :
-        mConfigCacheDepth(PP_ICL_PTCACHE_SIZE) {
+        mConfigCacheDepth(PP_ICL_PTCACHE_SIZE),
+        mConfigAlgorithm(AI_ICL_ALGORITHM_TIPSIFY),
+        mConfigOverdrawThreshold(0.f),
+        mConfigOptimizeFetch(false) {
     // empty
 }
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool ImproveCacheLocalityProcess::IsActive(unsigned int pFlags) const {
+bool ImproveCacheLocalityProcess::IsActive(aiPostProcessStepMask pFlags) const {
     return (pFlags & aiProcess_ImproveCacheLocality) != 0;
 }
 
@@ -77,6 +86,9 @@ bool ImproveCacheLocalityProcess::IsActive(unsigned int pFlags) const {
 void ImproveCacheLocalityProcess::SetupProperties(const Importer *pImp) {
     // AI_CONFIG_PP_ICL_PTCACHE_SIZE controls the target cache size for the optimizer
     mConfigCacheDepth = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE, PP_ICL_PTCACHE_SIZE);
+    mConfigAlgorithm = pImp->GetPropertyInteger(AI_CONFIG_PP_ICL_ALGORITHM, AI_ICL_ALGORITHM_TIPSIFY);
+    mConfigOverdrawThreshold = pImp->GetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, 0.f);
+    mConfigOptimizeFetch = pImp->GetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_FETCH, false);
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -89,98 +101,55 @@ void ImproveCacheLocalityProcess::Execute(aiScene *pScene) {
 
     ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess begin");
 
-    float out = 0.f;
-    unsigned int numf = 0, numm = 0;
+    std::vector<ai_real> missesIn(pScene->mNumMeshes, static_cast<ai_real>(0.f));
+    std::vector<ai_real> missesOut(pScene->mNumMeshes, static_cast<ai_real>(0.f));
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
+        missesOut[a] = ProcessMesh(pScene->mMeshes[a], a, &missesIn[a], pScene);
+    });
+
+    // accumulate in mesh order to get the same statistics as a serial run
+    float in = 0.f, out = 0.f;
+    unsigned int numf = 0, numv = 0, numm = 0;
     for (unsigned int a = 0; a < pScene->mNumMeshes; ++a) {
-        const float res = ProcessMesh(pScene->mMeshes[a], a);
-        if (res) {
+        if (missesOut[a]) {
             numf += pScene->mMeshes[a]->mNumFaces;
-            out += res;
+            numv += pScene->mMeshes[a]->mNumVertices;
+            in += missesIn[a];
+            out += missesOut[a];
             ++numm;
         }
     }
     if (!DefaultLogger::isNullLogger()) {
         if (numf > 0) {
-            ASSIMP_LOG_INFO("Cache relevant are ", numm, " meshes (", numf, " faces). Average output ACMR is ", out / numf);
+            ASSIMP_LOG_INFO("Cache relevant are ", numm, " meshes (", numf, " faces). Average ACMR in: ", in / numf,
+                    " out: ", out / numf, " | average ATVR in: ", in / numv, " out: ", out / numv);
         }
         ASSIMP_LOG_DEBUG("ImproveCacheLocalityProcess finished. ");
     }
 }
 
+namespace {
+
 // ------------------------------------------------------------------------------------------------
-static ai_real calculateInputACMR(aiMesh *pMesh, const aiFace *const pcEnd,
-        unsigned int configCacheDepth, unsigned int meshNum) {
-    ai_real fACMR = 0.0f;
-    unsigned int *piFIFOStack = new unsigned int[configCacheDepth];
-    memset(piFIFOStack, 0xff, configCacheDepth * sizeof(unsigned int));
-    unsigned int *piCur = piFIFOStack;
-    const unsigned int *const piCurEnd = piFIFOStack + configCacheDepth;
-
-    // count the number of cache misses
+// Simulates a FIFO post-transform cache and returns the number of cache misses. A vertex is
+// in the cache as long as less than configCacheDepth vertices were added after it.
+unsigned int countCacheMisses(const std::vector<unsigned int> &indices, unsigned int numVertices,
+        unsigned int configCacheDepth) {
+    std::vector<unsigned int> stamps(numVertices, 0);
+    unsigned int stamp = configCacheDepth + 1;
     unsigned int iCacheMisses = 0;
-    for (const aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
-        for (unsigned int qq = 0; qq < 3; ++qq) {
-            bool bInCache = false;
-            for (unsigned int *pp = piFIFOStack; pp < piCurEnd; ++pp) {
-                if (*pp == pcFace->mIndices[qq]) {
-                    // the vertex is in cache
-                    bInCache = true;
-                    break;
-                }
-            }
-            if (!bInCache) {
-                ++iCacheMisses;
-                if (piCurEnd == piCur) {
-                    piCur = piFIFOStack;
-                }
-                *piCur++ = pcFace->mIndices[qq];
-            }
+    for (const unsigned int idx : indices) {
+        if (stamp - stamps[idx] > configCacheDepth) {
+            stamps[idx] = stamp++;
+            ++iCacheMisses;
         }
     }
-    delete[] piFIFOStack;
-    fACMR = (ai_real)iCacheMisses / pMesh->mNumFaces;
-    if (3.0 == fACMR) {
-        char szBuff[128]; // should be sufficiently large in every case
-
-        // the JoinIdenticalVertices process has not been executed on this
-        // mesh, otherwise this value would normally be at least minimally
-        // smaller than 3.0 ...
-        ai_snprintf(szBuff, 128, "Mesh %u: Not suitable for vcache optimization", meshNum);
-        ASSIMP_LOG_WARN(szBuff);
-        return static_cast<ai_real>(0.f);
-    }
-    return fACMR;
+    return iCacheMisses;
 }
 
 // ------------------------------------------------------------------------------------------------
-// Improves the cache coherency of a specific mesh
-ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshNum) {
-    // TODO: rewrite this to use std::vector or boost::shared_array
-    ai_assert(nullptr != pMesh);
-
-    // Check whether the input data is valid
-    // - there must be vertices and faces
-    // - all faces must be triangulated or we can't operate on them
-    if (!pMesh->HasFaces() || !pMesh->HasPositions())
-        return static_cast<ai_real>(0.f);
-
-    if (pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
-        ASSIMP_LOG_ERROR("This algorithm works on triangle meshes only");
-        return static_cast<ai_real>(0.f);
-    }
-
-    if (pMesh->mNumVertices <= mConfigCacheDepth) {
-        return static_cast<ai_real>(0.f);
-    }
-
-    ai_real fACMR = 3.f;
-    const aiFace *const pcEnd = pMesh->mFaces + pMesh->mNumFaces;
-
-    // Input ACMR is for logging purposes only
-    if (!DefaultLogger::isNullLogger()) {
-        fACMR = calculateInputACMR(pMesh, pcEnd, mConfigCacheDepth, meshNum);
-    }
-
+// Orders the faces with the Tipsify algorithm
+void optimizeTipsify(const aiMesh *pMesh, unsigned int configCacheDepth, std::vector<unsigned int> &piIBOutput) {
     // first we need to build a vertex-triangle adjacency list
     VertexTriangleAdjacency adj(pMesh->mFaces, pMesh->mNumFaces, pMesh->mNumVertices, true);
 
@@ -193,7 +162,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
     // Since the number of triangles won't change the input faces can be reused. This is how
     // we save thousands of redundant mini allocations for aiFace::mIndices
     const unsigned int iIdxCnt = pMesh->mNumFaces * 3;
-    std::vector<unsigned int> piIBOutput;
     piIBOutput.resize(iIdxCnt);
     std::vector<unsigned int>::iterator piCSIter = piIBOutput.begin();
 
@@ -220,8 +188,6 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
     ai_assert(iMaxRefTris > 0);
     std::vector<unsigned int> piCandidates;
     piCandidates.resize(iMaxRefTris * 3);
-    unsigned int iCacheMisses = 0;
-
     // ...................................................................................
     /** PSEUDOCODE for the algorithm
 
@@ -254,7 +220,7 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
 
     int ivdx = 0;
     int ics = 1;
-    int iStampCnt = mConfigCacheDepth + 1;
+    int iStampCnt = configCacheDepth + 1;
     while (ivdx >= 0) {
 
         unsigned int icnt = piNumTriPtrNoModify[ivdx];
@@ -290,9 +256,8 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
                     *piCSIter++ = dp;
 
                     // if the vertex is not yet in cache, set its cache count
-                    if (iStampCnt - piCachingStamps[dp] > mConfigCacheDepth) {
+                    if (iStampCnt - piCachingStamps[dp] > configCacheDepth) {
                         piCachingStamps[dp] = iStampCnt++;
-                        ++iCacheMisses;
                     }
                 }
                 // flag triangle as emitted
@@ -315,7 +280,7 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
 
                 // will the vertex be in cache, even after fanning occurs?
                 unsigned int tmp;
-                if ((tmp = iStampCnt - piCachingStamps[dp]) + 2 * piNumTriPtr[dp] <= mConfigCacheDepth) {
+                if ((tmp = iStampCnt - piCachingStamps[dp]) + 2 * piNumTriPtr[dp] <= configCacheDepth) {
                     priority = tmp;
                 }
 
@@ -352,32 +317,421 @@ ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int mes
             }
         }
     }
-    ai_real fACMR2 = 0.0f;
-    if (!DefaultLogger::isNullLogger()) {
-        fACMR2 = static_cast<ai_real>(iCacheMisses / pMesh->mNumFaces);
-        const ai_real averageACMR = ((fACMR - fACMR2) / fACMR) * 100.f;
-        // very intense verbose logging ... prepare for much text if there are many meshes
-        if (DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
-            ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", meshNum, "| ACMR in: ", fACMR, " out: ", fACMR2, " | average ACMR ", averageACMR);
+}
+
+// Weights of the vertex scores proposed by Tom Forsyth
+const float ForsythCacheDecayPower = 1.5f;
+const float ForsythLastTriScore = 0.75f;
+const float ForsythValenceBoostScale = 2.0f;
+const float ForsythValenceBoostPower = 0.5f;
+const unsigned int ForsythMaxCacheSize = 64;
+const unsigned int ForsythMaxValence = 32;
+
+// ------------------------------------------------------------------------------------------------
+// Orders the faces with Tom Forsyth's algorithm: every vertex gets a score from its position in
+// a simulated LRU cache and its number of remaining triangles, the face with the highest sum of
+// its vertex scores is emitted next. Only faces of the vertices in the cache are considered,
+// at a dead end the next face in input order is taken.
+void optimizeForsyth(const aiMesh *pMesh, unsigned int configCacheDepth, std::vector<unsigned int> &piIBOutput) {
+    const unsigned int numFaces = pMesh->mNumFaces;
+    const unsigned int cacheSize = std::min(std::max(configCacheDepth, 4u), ForsythMaxCacheSize);
+
+    float cacheScores[ForsythMaxCacheSize];
+    for (unsigned int i = 0; i < cacheSize; ++i) {
+        // the vertices of the last face get a fixed score to avoid emitting strips
+        cacheScores[i] = i < 3 ? ForsythLastTriScore :
+                                 std::pow(1.f - float(i - 3) / float(cacheSize - 3), ForsythCacheDecayPower);
+    }
+    float valenceScores[ForsythMaxValence + 1];
+    valenceScores[0] = 0.f;
+    for (unsigned int i = 1; i <= ForsythMaxValence; ++i) {
+        valenceScores[i] = ForsythValenceBoostScale * std::pow(float(i), -ForsythValenceBoostPower);
+    }
+    const auto vertexScore = [&](int cachePos, unsigned int liveTris) {
+        if (0 == liveTris) {
+            return 0.f;
+        }
+        return (cachePos >= 0 ? cacheScores[cachePos] : 0.f) + valenceScores[std::min(liveTris, ForsythMaxValence)];
+    };
+
+    // the live triangles of each vertex are kept at the front of its adjacency list
+    VertexTriangleAdjacency adj(pMesh->mFaces, numFaces, pMesh->mNumVertices, true);
+    unsigned int *const liveTris = adj.mLiveTriangles;
+
+    std::vector<int> cachePositions(pMesh->mNumVertices, -1);
+    std::vector<float> vertexScores(pMesh->mNumVertices);
+    for (unsigned int v = 0; v < pMesh->mNumVertices; ++v) {
+        vertexScores[v] = vertexScore(-1, liveTris[v]);
+    }
+    std::vector<float> faceScores(numFaces);
+    unsigned int best = 0;
+    for (unsigned int f = 0; f < numFaces; ++f) {
+        const unsigned int *ind = pMesh->mFaces[f].mIndices;
+        faceScores[f] = vertexScores[ind[0]] + vertexScores[ind[1]] + vertexScores[ind[2]];
+        if (faceScores[f] > faceScores[best]) {
+            best = f;
         }
-        fACMR2 *= pMesh->mNumFaces;
     }
 
-    // sort the output index buffer back to the input array
-    piCSIter = piIBOutput.begin();
-    for (aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
-        unsigned nind = pcFace->mNumIndices;
+    std::vector<bool> abEmitted(numFaces, false);
+    std::vector<unsigned int> cache, newCache;
+    cache.reserve(cacheSize + 3);
+    newCache.reserve(cacheSize + 3);
+    piIBOutput.clear();
+    piIBOutput.reserve(numFaces * 3);
+    unsigned int cursor = 0;
+    const unsigned int None = ~0u;
+
+    for (unsigned int n = 0; n < numFaces; ++n) {
+        if (None == best) {
+            // dead end, continue with the next face in input order
+            while (abEmitted[cursor]) {
+                ++cursor;
+            }
+            best = cursor;
+        }
+
+        // emit the face and put its vertices in front of the cache
+        const unsigned int *ind = pMesh->mFaces[best].mIndices;
+        abEmitted[best] = true;
+        newCache.clear();
+        for (unsigned int k = 0; k < 3; ++k) {
+            const unsigned int v = ind[k];
+            piIBOutput.push_back(v);
+            if (std::find(newCache.begin(), newCache.end(), v) != newCache.end()) {
+                continue;
+            }
+            newCache.push_back(v);
+
+            unsigned int *const tris = adj.GetAdjacentTriangles(v);
+            unsigned int *const trisEnd = tris + liveTris[v];
+            unsigned int *const it = std::find(tris, trisEnd, best);
+            if (it != trisEnd) {
+                std::swap(*it, *(trisEnd - 1));
+                --liveTris[v];
+            }
+        }
+        for (const unsigned int v : cache) {
+            if (v != ind[0] && v != ind[1] && v != ind[2]) {
+                newCache.push_back(v);
+            }
+        }
+
+        // update the scores of all vertices which were in the cache or have been added to it
+        for (size_t i = 0; i < newCache.size(); ++i) {
+            const unsigned int v = newCache[i];
+            cachePositions[v] = i < cacheSize ? static_cast<int>(i) : -1;
+            const float score = vertexScore(cachePositions[v], liveTris[v]);
+            const float delta = score - vertexScores[v];
+            vertexScores[v] = score;
+
+            const unsigned int *const tris = adj.GetAdjacentTriangles(v);
+            for (unsigned int t = 0; t < liveTris[v]; ++t) {
+                faceScores[tris[t]] += delta;
+            }
+        }
+        if (newCache.size() > cacheSize) {
+            newCache.resize(cacheSize);
+        }
+        cache.swap(newCache);
+
+        // the next face is the best face of the cached vertices
+        best = None;
+        float bestScore = -1.f;
+        for (const unsigned int v : cache) {
+            const unsigned int *const tris = adj.GetAdjacentTriangles(v);
+            for (unsigned int t = 0; t < liveTris[v]; ++t) {
+                if (faceScores[tris[t]] > bestScore) {
+                    bestScore = faceScores[tris[t]];
+                    best = tris[t];
+                }
+            }
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reduces overdraw as described in the Tipsify paper: the ordered faces are split into clusters
+// wherever the cache would be flushed anyway and wherever the ACMR of the current cluster
+// falls below threshold times the ACMR of the enclosing run. The clusters are then sorted so
+// that clusters facing away from the center of the mesh are drawn first.
+void optimizeOverdraw(const aiMesh *pMesh, unsigned int configCacheDepth, float threshold,
+        std::vector<unsigned int> &piIBOutput) {
+    const unsigned int numFaces = static_cast<unsigned int>(piIBOutput.size() / 3);
+
+    std::vector<unsigned int> stamps(pMesh->mNumVertices, 0);
+    unsigned int stamp = configCacheDepth + 1;
+    const auto faceMisses = [&](unsigned int f) {
+        unsigned int misses = 0;
+        for (unsigned int k = 0; k < 3; ++k) {
+            const unsigned int v = piIBOutput[f * 3 + k];
+            if (stamp - stamps[v] > configCacheDepth) {
+                stamps[v] = stamp++;
+                ++misses;
+            }
+        }
+        return misses;
+    };
+    const auto flushCache = [&]() {
+        stamp += configCacheDepth + 1;
+    };
+
+    // hard boundaries at faces which don't share a vertex with the cache
+    std::vector<unsigned int> hardBoundaries;
+    for (unsigned int f = 0; f < numFaces; ++f) {
+        if (3 == faceMisses(f) || 0 == f) {
+            hardBoundaries.push_back(f);
+        }
+    }
+    hardBoundaries.push_back(numFaces);
+
+    // soft boundaries where a cluster is cache efficient enough on its own
+    std::vector<unsigned int> clusters;
+    for (size_t c = 0; c + 1 < hardBoundaries.size(); ++c) {
+        const unsigned int begin = hardBoundaries[c], end = hardBoundaries[c + 1];
+        flushCache();
+        unsigned int misses = 0;
+        for (unsigned int f = begin; f < end; ++f) {
+            misses += faceMisses(f);
+        }
+        const float clusterThreshold = threshold * float(misses) / float(end - begin);
+
+        flushCache();
+        clusters.push_back(begin);
+        misses = 0;
+        for (unsigned int f = begin, start = begin; f + 1 < end; ++f) {
+            misses += faceMisses(f);
+            if (float(misses) <= clusterThreshold * float(f + 1 - start)) {
+                clusters.push_back(start = f + 1);
+                misses = 0;
+                flushCache();
+            }
+        }
+    }
+    clusters.push_back(numFaces);
+    const size_t numClusters = clusters.size() - 1;
+
+    // area weighted centroids and normals of the clusters and of the whole mesh
+    std::vector<aiVector3D> centroids(numClusters), normals(numClusters);
+    std::vector<ai_real> areas(numClusters, 0);
+    aiVector3D meshCentroid;
+    ai_real meshArea = 0;
+    for (size_t c = 0; c < numClusters; ++c) {
+        for (unsigned int f = clusters[c]; f < clusters[c + 1]; ++f) {
+            const aiVector3D &p0 = pMesh->mVertices[piIBOutput[f * 3]];
+            const aiVector3D &p1 = pMesh->mVertices[piIBOutput[f * 3 + 1]];
+            const aiVector3D &p2 = pMesh->mVertices[piIBOutput[f * 3 + 2]];
+            const aiVector3D normal = (p1 - p0) ^ (p2 - p0);
+            const ai_real area = normal.Length();
+            centroids[c] += (p0 + p1 + p2) * (area / 3);
+            normals[c] += normal;
+            areas[c] += area;
+        }
+        meshCentroid += centroids[c];
+        meshArea += areas[c];
+    }
+    if (meshArea > 0) {
+        meshCentroid /= meshArea;
+    }
+
+    std::vector<ai_real> keys(numClusters);
+    std::vector<unsigned int> order(numClusters);
+    for (size_t c = 0; c < numClusters; ++c) {
+        const aiVector3D centroid = areas[c] > 0 ? centroids[c] / areas[c] : centroids[c];
+        keys[c] = (centroid - meshCentroid) * normals[c].NormalizeSafe();
+        order[c] = static_cast<unsigned int>(c);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b) {
+        return keys[a] > keys[b];
+    });
+
+    std::vector<unsigned int> sorted;
+    sorted.reserve(piIBOutput.size());
+    for (const unsigned int c : order) {
+        sorted.insert(sorted.end(), piIBOutput.begin() + clusters[c] * 3, piIBOutput.begin() + clusters[c + 1] * 3);
+    }
+    piIBOutput.swap(sorted);
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename T>
+void reorderVertexStream(T *&data, const std::vector<unsigned int> &remap) {
+    if (nullptr == data) {
+        return;
+    }
+    T *out = new T[remap.size()];
+    for (size_t i = 0; i < remap.size(); ++i) {
+        out[remap[i]] = data[i];
+    }
+    delete[] data;
+    data = out;
+}
+
+// ------------------------------------------------------------------------------------------------
+template <typename MeshType>
+void reorderVertexStreams(MeshType *pMesh, const std::vector<unsigned int> &remap) {
+    reorderVertexStream(pMesh->mVertices, remap);
+    reorderVertexStream(pMesh->mNormals, remap);
+    reorderVertexStream(pMesh->mTangents, remap);
+    reorderVertexStream(pMesh->mBitangents, remap);
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+        reorderVertexStream(pMesh->mColors[i], remap);
+    }
+    for (unsigned int i = 0; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+        reorderVertexStream(pMesh->mTextureCoords[i], remap);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Reorders the vertices in the order in which the faces reference them first, unreferenced
+// vertices are moved to the end.
+void optimizeVertexFetch(aiMesh *pMesh, unsigned int meshNum, const aiScene *pScene, std::vector<unsigned int> &piIBOutput) {
+    const unsigned int Unused = ~0u;
+    std::vector<unsigned int> remap(pMesh->mNumVertices, Unused);
+    unsigned int next = 0;
+    for (unsigned int &idx : piIBOutput) {
+        if (Unused == remap[idx]) {
+            remap[idx] = next++;
+        }
+        idx = remap[idx];
+    }
+    bool identity = true;
+    for (unsigned int v = 0; v < pMesh->mNumVertices; ++v) {
+        if (Unused == remap[v]) {
+            remap[v] = next++;
+        }
+        identity = identity && remap[v] == v;
+    }
+    if (identity) {
+        return;
+    }
+
+    reorderVertexStreams(pMesh, remap);
+    for (unsigned int i = 0; i < pMesh->mNumBones; ++i) {
+        aiBone *bone = pMesh->mBones[i];
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w) {
+            aiVertexWeight &weight = bone->mWeights[w];
+            if (weight.mVertexId < pMesh->mNumVertices) {
+                weight.mVertexId = remap[weight.mVertexId];
+            }
+        }
+    }
+    // skeleton bones of this mesh are only touched by this mesh, meshes run in parallel
+    for (unsigned int s = 0; nullptr != pScene && s < pScene->mNumSkeletons; ++s) {
+        const aiSkeleton *skeleton = pScene->mSkeletons[s];
+        for (unsigned int i = 0; i < skeleton->mNumBones; ++i) {
+            aiSkeletonBone *bone = skeleton->mBones[i];
+            if (bone->mMeshId != pMesh) {
+                continue;
+            }
+            for (unsigned int w = 0; w < bone->mNumnWeights; ++w) {
+                aiVertexWeight &weight = bone->mWeights[w];
+                if (weight.mVertexId < pMesh->mNumVertices) {
+                    weight.mVertexId = remap[weight.mVertexId];
+                }
+            }
+        }
+    }
+    for (unsigned int i = 0; i < pMesh->mNumAnimMeshes; ++i) {
+        aiAnimMesh *animMesh = pMesh->mAnimMeshes[i];
+        if (animMesh->mNumVertices != pMesh->mNumVertices) {
+            ASSIMP_LOG_WARN("Mesh ", meshNum, ": Animation mesh ", i, " has a different vertex count, it is not reordered");
+            continue;
+        }
+        reorderVertexStreams(animMesh, remap);
+    }
+}
+
+} // namespace
+
+// ------------------------------------------------------------------------------------------------
+// Writes an index buffer back to the triangles of a mesh.
+static void writeIndexBuffer(aiMesh *pMesh, const std::vector<unsigned int> &piIB) {
+    std::vector<unsigned int>::const_iterator piCSIter = piIB.begin();
+    for (aiFace *pcFace = pMesh->mFaces, *const pcEnd = pMesh->mFaces + pMesh->mNumFaces; pcFace != pcEnd; ++pcFace) {
         unsigned *ind = pcFace->mIndices;
-        if (nind > 0)
-            ind[0] = *piCSIter++;
-        if (nind > 1)
-            ind[1] = *piCSIter++;
-        if (nind > 2)
-            ind[2] = *piCSIter++;
+        ind[0] = *piCSIter++;
+        ind[1] = *piCSIter++;
+        ind[2] = *piCSIter++;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+// Improves the cache coherency of a specific mesh
+ai_real ImproveCacheLocalityProcess::ProcessMesh(aiMesh *pMesh, unsigned int meshNum, ai_real *pInputMisses,
+        const aiScene *pScene) {
+    ai_assert(nullptr != pMesh);
+
+    // Check whether the input data is valid
+    // - there must be vertices and faces
+    // - all faces must be triangulated or we can't operate on them
+    if (!pMesh->HasFaces() || !pMesh->HasPositions())
+        return static_cast<ai_real>(0.f);
+
+    if (pMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) {
+        ASSIMP_LOG_ERROR("This algorithm works on triangle meshes only");
+        return static_cast<ai_real>(0.f);
+    }
+
+    const aiFace *const pcEnd = pMesh->mFaces + pMesh->mNumFaces;
+    const unsigned int iIdxCnt = pMesh->mNumFaces * 3;
+    std::vector<unsigned int> piIBInput;
+    piIBInput.reserve(iIdxCnt);
+    for (const aiFace *pcFace = pMesh->mFaces; pcFace != pcEnd; ++pcFace) {
+        piIBInput.insert(piIBInput.end(), pcFace->mIndices, pcFace->mIndices + 3);
     }
 
-    return fACMR2;
+    // meshes which fit into the cache keep their triangle order, but the vertex
+    // fetch pass does not depend on the cache and runs for them as well
+    if (pMesh->mNumVertices <= mConfigCacheDepth) {
+        if (mConfigOptimizeFetch) {
+            optimizeVertexFetch(pMesh, meshNum, pScene, piIBInput);
+            writeIndexBuffer(pMesh, piIBInput);
+        }
+        return static_cast<ai_real>(0.f);
+    }
+
+    const unsigned int iInputMisses = countCacheMisses(piIBInput, pMesh->mNumVertices, mConfigCacheDepth);
+    if (iInputMisses == iIdxCnt) {
+        // the JoinIdenticalVertices process has not been executed on this
+        // mesh, otherwise this value would normally be at least minimally
+        // smaller than 3.0 ...
+        ASSIMP_LOG_WARN("Mesh ", meshNum, ": Not suitable for vcache optimization");
+        return static_cast<ai_real>(0.f);
+    }
+    const bool logStatistics = !DefaultLogger::isNullLogger();
+
+    std::vector<unsigned int> piIBOutput;
+    if (AI_ICL_ALGORITHM_FORSYTH == mConfigAlgorithm) {
+        optimizeForsyth(pMesh, mConfigCacheDepth, piIBOutput);
+    } else {
+        optimizeTipsify(pMesh, mConfigCacheDepth, piIBOutput);
+    }
+    if (mConfigOverdrawThreshold >= 1.f) {
+        optimizeOverdraw(pMesh, mConfigCacheDepth, mConfigOverdrawThreshold, piIBOutput);
+    }
+    if (mConfigOptimizeFetch) {
+        optimizeVertexFetch(pMesh, meshNum, pScene, piIBOutput);
+    }
+
+    // sort the output index buffer back to the input array
+    writeIndexBuffer(pMesh, piIBOutput);
+
+    if (!logStatistics) {
+        return static_cast<ai_real>(0.f);
+    }
+    const unsigned int iOutputMisses = countCacheMisses(piIBOutput, pMesh->mNumVertices, mConfigCacheDepth);
+    // very intense verbose logging ... prepare for much text if there are many meshes
+    if (DefaultLogger::get()->getLogSeverity() == Logger::VERBOSE) {
+        const ai_real numFaces = static_cast<ai_real>(pMesh->mNumFaces);
+        const ai_real numVertices = static_cast<ai_real>(pMesh->mNumVertices);
+        ASSIMP_LOG_VERBOSE_DEBUG("Mesh ", meshNum, "| ACMR in: ", iInputMisses / numFaces, " out: ", iOutputMisses / numFaces,
+                " | ATVR in: ", iInputMisses / numVertices, " out: ", iOutputMisses / numVertices);
+    }
+    if (nullptr != pInputMisses) {
+        *pInputMisses = static_cast<ai_real>(iInputMisses);
+    }
+    return static_cast<ai_real>(iOutputMisses);
 }
 
 } // namespace Assimp
-
@@ -56,10 +56,12 @@ namespace Assimp {
 /** The ImproveCacheLocalityProcess reorders all faces for improved vertex
  *  cache locality. It tries to arrange all faces to fans and to render
  *  faces which share vertices directly one after the other.
+ *  Optionally the faces are reordered afterwards to reduce overdraw and
+ *  the vertices are reordered for sequential vertex fetches.
  *
  *  @note This step expects triagulated input data.
  */
-class ImproveCacheLocalityProcess : public BaseProcess {
+class ASSIMP_API ImproveCacheLocalityProcess : public BaseProcess {
 public:
     // -------------------------------------------------------------------
     /// The default class constructor / destructor.
@@ -68,7 +70,13 @@ public:
 
     // -------------------------------------------------------------------
     // Check whether the pp step is active
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "ImproveCacheLocalityProcess";
+    }
 
     // -------------------------------------------------------------------
     // Executes the pp step on a given scene
@@ -83,13 +91,31 @@ protected:
     /** Executes the postprocessing step on the given mesh
      * @param pMesh The mesh to process.
      * @param meshNum Index of the mesh to process
+     * @param pInputMisses Receives the number of cache misses of the
+     *   input faces, may be nullptr.
+     * @param pScene The scene holding the mesh, the weights of its
+     *   skeletons are updated if the vertices are reordered. May be nullptr.
+     * @return The number of cache misses of the output faces. Statistics
+     *   are only gathered if logging is enabled, otherwise 0.
      */
-    ai_real ProcessMesh( aiMesh* pMesh, unsigned int meshNum);
+    ai_real ProcessMesh( aiMesh* pMesh, unsigned int meshNum, ai_real *pInputMisses = nullptr,
+            const aiScene *pScene = nullptr);
 
 private:
     //! Configuration parameter: specifies the size of the cache to
     //! optimize the vertex data for.
     unsigned int mConfigCacheDepth;
+
+    //! Configuration parameter: the face ordering algorithm, one of
+    //! the AI_ICL_ALGORITHM_XXX values.
+    unsigned int mConfigAlgorithm;
+
+    //! Configuration parameter: overdraw threshold, values below 1
+    //! disable the overdraw optimization.
+    float mConfigOverdrawThreshold;
+
+    //! Configuration parameter: reorder the vertices for fetch locality.
+    bool mConfigOptimizeFetch;
 };
 
 } // end of namespace Assimp
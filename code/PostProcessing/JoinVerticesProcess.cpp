@@ -55,12 +55,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <unordered_map>
 #include <memory>
 #include <map>
+#include <vector>
 
 using namespace Assimp;
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool JoinVerticesProcess::IsActive( unsigned int pFlags) const {
+bool JoinVerticesProcess::IsActive( aiPostProcessStepMask pFlags) const {
     return (pFlags & aiProcess_JoinIdenticalVertices) != 0;
 }
 // ------------------------------------------------------------------------------------------------
@@ -76,10 +77,15 @@ void JoinVerticesProcess::Execute( aiScene* pScene) {
         }
     }
 
-    // execute the step
+    // execute the step, the meshes are independent from each other
+    std::vector<int> numVerticesPerMesh(pScene->mNumMeshes, 0);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
+        numVerticesPerMesh[a] = ProcessMesh( pScene->mMeshes[a],a);
+    });
+
     int iNumVertices = 0;
     for( unsigned int a = 0; a < pScene->mNumMeshes; a++) {
-        iNumVertices += ProcessMesh( pScene->mMeshes[a],a);
+        iNumVertices += numVerticesPerMesh[a];
     }
 
     pScene->mFlags |= AI_SCENE_FLAGS_NON_VERBOSE_FORMAT;
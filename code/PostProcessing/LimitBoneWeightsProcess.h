@@ -85,7 +85,13 @@ public:
     * @return true if the process is present in this flag fields,
     *   false if not.
     */
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "LimitBoneWeightsProcess";
+    }
 
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
@@ -80,7 +80,7 @@ OptimizeGraphProcess::OptimizeGraphProcess() :
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool OptimizeGraphProcess::IsActive(unsigned int pFlags) const {
+bool OptimizeGraphProcess::IsActive(aiPostProcessStepMask pFlags) const {
 	return (0 != (pFlags & aiProcess_OptimizeGraph));
 }
 
@@ -138,7 +138,7 @@ void OptimizeGraphProcess::CollectNewChildren(aiNode *nd, std::list<aiNode *> &n
 		std::list<aiNode *> join;
 		for (std::list<aiNode *>::iterator it = child_nodes.begin(); it != child_nodes.end();) {
 			aiNode *child = *it;
-			if (child->mNumChildren == 0 && locked.find(AI_OG_GETKEY(child->mName)) == end) {
+			if (child->mNumChildren == 0 && child->mNumInstances == 0 && locked.find(AI_OG_GETKEY(child->mName)) == end) {
 
 				// There may be no instanced meshes
 				unsigned int n = 0;
@@ -76,7 +76,13 @@ public:
     ~OptimizeGraphProcess() override = default;
 
     // -------------------------------------------------------------------
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "OptimizeGraphProcess";
+    }
 
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
@@ -93,7 +93,13 @@ public:
     };
 
     // -------------------------------------------------------------------
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "OptimizeMeshesProcess";
+    }
 
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
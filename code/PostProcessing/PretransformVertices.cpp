@@ -95,7 +95,7 @@ PretransformVertices::PretransformVertices() :
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool PretransformVertices::IsActive(unsigned int pFlags) const {
+bool PretransformVertices::IsActive(aiPostProcessStepMask pFlags) const {
 	return (pFlags & aiProcess_PreTransformVertices) != 0;
 }
 
@@ -434,6 +434,11 @@ void PretransformVertices::Execute(aiScene *pScene) {
 	if (!pScene->mNumMeshes)
 		return;
 
+	// the instances of a mesh are placed like any other mesh referenced by several nodes
+	if (const unsigned int instanced = ExpandNodeInstances(pScene->mRootNode)) {
+		ASSIMP_LOG_DEBUG("PretransformVerticesProcess: Expanded the mesh instances of ", instanced, " nodes");
+	}
+
 	const unsigned int oldMeshes = pScene->mNumMeshes;
 	const unsigned int oldAnimationChannels = pScene->mNumAnimations;
 	const unsigned int oldNodes = CountNodes(pScene->mRootNode);
@@ -74,7 +74,13 @@ public:
 
 	// -------------------------------------------------------------------
 	// Check whether step is active
-	bool IsActive(unsigned int pFlags) const override;
+	bool IsActive(aiPostProcessStepMask pFlags) const override;
+
+	// -------------------------------------------------------------------
+	/// @brief Returns the name of the step.
+	const char *GetName() const override {
+	    return "PretransformVertices";
+	}
 
 	// -------------------------------------------------------------------
 	// Execute step on a given scene
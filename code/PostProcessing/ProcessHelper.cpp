@@ -44,7 +44,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ProcessHelper.h"
 
+#include <algorithm>
 #include <limits>
+#include <string>
 
 namespace Assimp {
 
@@ -142,6 +144,13 @@ ai_real ComputePositionEpsilon(const aiMesh *pMesh) {
     return (maxVec - minVec).Length() * epsilon;
 }
 
+// -------------------------------------------------------------------------------
+void SelectSpatialIndex(SpatialSort &sort, ai_real radius, int mode) {
+    if (mode == 2 || (mode == 0 && sort.IsGridPreferable(radius))) {
+        sort.BuildGrid(radius);
+    }
+}
+
 // -------------------------------------------------------------------------------
 ai_real ComputePositionEpsilon(const aiMesh *const *pMeshes, size_t num) {
     ai_assert(nullptr != pMeshes);
@@ -379,4 +388,65 @@ aiMesh *MakeSubmesh(const aiMesh *pMesh, const std::vector<unsigned int> &subMes
     return oMesh;
 }
 
+// -------------------------------------------------------------------------------
+unsigned int ExpandNodeInstances(aiNode *node) {
+    unsigned int expanded = 0;
+    for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+        expanded += ExpandNodeInstances(node->mChildren[i]);
+    }
+    if (!node->mNumInstances) {
+        return expanded;
+    }
+
+    // the instance transformations are relative to the node, so they become the local
+    // transformations of the new children, each of which references all meshes of the node
+    if (node->mNumMeshes) {
+        aiNode **children = new aiNode *[node->mNumChildren + node->mNumInstances];
+        if (node->mNumChildren) {
+            std::copy(node->mChildren, node->mChildren + node->mNumChildren, children);
+        }
+        for (unsigned int i = 0; i < node->mNumInstances; ++i) {
+            aiNode *child = new aiNode(std::string(node->mName.C_Str()) + "_instance" + std::to_string(i));
+            child->mParent = node;
+            child->mTransformation = node->mInstanceTransforms[i];
+            child->mNumMeshes = node->mNumMeshes;
+            child->mMeshes = new unsigned int[child->mNumMeshes];
+            std::copy(node->mMeshes, node->mMeshes + node->mNumMeshes, child->mMeshes);
+            children[node->mNumChildren + i] = child;
+        }
+        delete[] node->mChildren;
+        node->mChildren = children;
+        node->mNumChildren += node->mNumInstances;
+
+        delete[] node->mMeshes;
+        node->mMeshes = nullptr;
+        node->mNumMeshes = 0;
+    }
+    delete[] node->mInstanceTransforms;
+    node->mInstanceTransforms = nullptr;
+    node->mNumInstances = 0;
+    return expanded + 1;
+}
+
+// -------------------------------------------------------------------------------
+unsigned int DropVertexStreams(aiScene *scene, aiPostProcessStepMask steps) {
+    // the steps which leave the vertex data of the meshes alone
+    static const aiPostProcessStepMask keepStreams = aiProcess_ValidateDataStructure | aiProcess_RemoveRedundantMaterials |
+            aiProcess_EmbedTextures | aiProcess_PopulateArmatureData | aiProcess_GenBoundingBoxes | aiProcess_GenVertexStreams;
+    if (!(steps & ~keepStreams)) {
+        return 0;
+    }
+
+    unsigned int dropped = 0;
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        aiMesh *mesh = scene->mMeshes[i];
+        if (nullptr != mesh->mVertexStream) {
+            delete mesh->mVertexStream;
+            mesh->mVertexStream = nullptr;
+            ++dropped;
+        }
+    }
+    return dropped;
+}
+
 } // namespace Assimp
@@ -307,6 +307,12 @@ ai_real ComputePositionEpsilon(const aiMesh *pMesh);
 // Compute a good epsilon value for position comparisons on a array of meshes
 ai_real ComputePositionEpsilon(const aiMesh *const *pMeshes, size_t num);
 
+// -------------------------------------------------------------------------------
+// Build the grid of a SpatialSort according to the AI_CONFIG_PP_SPATIAL_INDEX mode:
+// always for mode 2, never for mode 1, and for mode 0 if the positions are laid out
+// such that scanning along the sorting plane would be slow for the given radius.
+void SelectSpatialIndex(SpatialSort &sort, ai_real radius, int mode);
+
 // -------------------------------------------------------------------------------
 // Compute an unique value for the vertex format of a mesh
 unsigned int GetMeshVFormatUnique(const aiMesh *pcMesh);
@@ -330,15 +336,31 @@ const char *MappingTypeToString(aiTextureMapping in);
 // Split a mesh given a list of faces to be contained in the sub mesh
 aiMesh *MakeSubmesh(const aiMesh *superMesh, const std::vector<unsigned int> &subMeshFaces, unsigned int subFlags);
 
+// -------------------------------------------------------------------------------
+// Replace the mesh instances of a node and its children by one child node per
+// instance, for consumers which know nothing of aiNode::mInstanceTransforms.
+// Returns the number of nodes whose instances were expanded.
+unsigned int ExpandNodeInstances(aiNode *node);
+
+// -------------------------------------------------------------------------------
+// Delete the vertex streams of all meshes if any of the given steps may change
+// the vertex data, the streams would be stale afterwards. Returns the number of
+// deleted streams.
+unsigned int DropVertexStreams(aiScene *scene, aiPostProcessStepMask steps);
+
 // -------------------------------------------------------------------------------
 // Utility post-process step to share the spatial sort tree between
 // all steps which use it to speedup its computations.
 class ComputeSpatialSortProcess : public BaseProcess {
-    bool IsActive(unsigned int pFlags) const {
+    bool IsActive(aiPostProcessStepMask pFlags) const {
         return nullptr != shared && 0 != (pFlags & (aiProcess_CalcTangentSpace |
                                                            aiProcess_GenNormals | aiProcess_JoinIdenticalVertices));
     }
 
+    const char *GetName() const {
+        return "ComputeSpatialSortProcess";
+    }
+
     void Execute(aiScene *pScene) {
         typedef std::pair<SpatialSort, ai_real> _Type;
         ASSIMP_LOG_DEBUG("Generate spatially-sorted vertex cache");
@@ -360,11 +382,15 @@ class ComputeSpatialSortProcess : public BaseProcess {
 // -------------------------------------------------------------------------------
 // ... and the same again to cleanup the whole stuff
 class DestroySpatialSortProcess : public BaseProcess {
-    bool IsActive(unsigned int pFlags) const {
+    bool IsActive(aiPostProcessStepMask pFlags) const {
         return nullptr != shared && 0 != (pFlags & (aiProcess_CalcTangentSpace |
                                                         aiProcess_GenNormals | aiProcess_JoinIdenticalVertices));
     }
 
+    const char *GetName() const {
+        return "DestroySpatialSortProcess";
+    }
+
     void Execute(aiScene * /*pScene*/) {
         shared->RemoveProperty(AI_SPP_SPATIAL_SORT);
     }
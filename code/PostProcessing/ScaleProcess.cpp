@@ -62,7 +62,7 @@ ai_real ScaleProcess::getScale() const {
 }
 
 // ------------------------------------------------------------------------------------------------
-bool ScaleProcess::IsActive( unsigned int pFlags ) const {
+bool ScaleProcess::IsActive( aiPostProcessStepMask pFlags ) const {
     return ( pFlags & aiProcess_GlobalScale ) != 0;
 }
 
@@ -173,28 +173,38 @@ void ScaleProcess::traverseNodes( aiNode *node, unsigned int nested_node_id ) {
 // ------------------------------------------------------------------------------------------------
 void ScaleProcess::applyScaling( aiNode *currentNode ) {
     if ( nullptr != currentNode ) {
-        // Reconstruct matrix by transform rather than by scale
-        // This prevent scale values being changed which can
-        // be meaningful in some cases
-        // like when you want the modeller to
-        // see 1:1 compatibility.
+        applyScaling( currentNode->mTransformation );
 
-        aiVector3D pos, scale;
-        aiQuaternion rotation;
-        currentNode->mTransformation.Decompose( scale, rotation, pos);
+        // the instances are placed in the space of the node, so their offsets scale as well
+        for( unsigned int i = 0; i < currentNode->mNumInstances; i++) {
+            applyScaling( currentNode->mInstanceTransforms[i] );
+        }
+    }
+}
 
-        aiMatrix4x4 translation;
-        aiMatrix4x4::Translation( pos * mScale, translation );
+// ------------------------------------------------------------------------------------------------
+void ScaleProcess::applyScaling( aiMatrix4x4 &transformation ) {
+    // Reconstruct matrix by transform rather than by scale
+    // This prevent scale values being changed which can
+    // be meaningful in some cases
+    // like when you want the modeller to
+    // see 1:1 compatibility.
 
-        aiMatrix4x4 scaling;
+    aiVector3D pos, scale;
+    aiQuaternion rotation;
+    transformation.Decompose( scale, rotation, pos);
 
-        // note: we do not use mScale here, this is on purpose.
-        aiMatrix4x4::Scaling( scale, scaling );
+    aiMatrix4x4 translation;
+    aiMatrix4x4::Translation( pos * mScale, translation );
 
-        aiMatrix4x4 RotMatrix = aiMatrix4x4 (rotation.GetMatrix());
+    aiMatrix4x4 scaling;
 
-        currentNode->mTransformation = translation * RotMatrix * scaling;
-    }
+    // note: we do not use mScale here, this is on purpose.
+    aiMatrix4x4::Scaling( scale, scaling );
+
+    aiMatrix4x4 RotMatrix = aiMatrix4x4 (rotation.GetMatrix());
+
+    transformation = translation * RotMatrix * scaling;
 }
 
 } // Namespace Assimp
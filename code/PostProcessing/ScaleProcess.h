@@ -73,7 +73,13 @@ public:
     ai_real getScale() const;
 
     /// Overwritten, @see BaseProcess
-    bool IsActive( unsigned int pFlags ) const override;
+    bool IsActive( aiPostProcessStepMask pFlags ) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "ScaleProcess";
+    }
 
     /// Overwritten, @see BaseProcess
     void SetupProperties( const Importer* pImp ) override;
@@ -84,6 +90,7 @@ public:
 private:
     void traverseNodes( aiNode *currentNode, unsigned int nested_node_id = 0 );
     void applyScaling( aiNode *currentNode );
+    void applyScaling( aiMatrix4x4 &transformation );
 
 private:
     ai_real mScale;
@@ -56,7 +56,7 @@ SortByPTypeProcess::SortByPTypeProcess() : mConfigRemoveMeshes(0) {}
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool SortByPTypeProcess::IsActive(unsigned int pFlags) const {
+bool SortByPTypeProcess::IsActive(aiPostProcessStepMask pFlags) const {
     return (pFlags & aiProcess_SortByPType) != 0;
 }
 
@@ -65,7 +65,13 @@ public:
     ~SortByPTypeProcess() override = default;
 
     // -------------------------------------------------------------------
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "SortByPTypeProcess";
+    }
 
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
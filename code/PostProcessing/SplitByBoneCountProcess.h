@@ -69,7 +69,13 @@ public:
     /// @param pFlags The processing flags the importer was called with. A
     ///        bitwise combination of #aiPostProcessSteps.
     /// @return true if the process is present in this flag fields, false if not.
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "SplitByBoneCountProcess";
+    }
 
     /// @brief Called prior to ExecuteOnScene().
     /// The function is a request to the process to update its configuration
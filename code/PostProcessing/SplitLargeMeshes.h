@@ -99,7 +99,13 @@ public:
     * @return true if the process is present in this flag fields,
     *   false if not.
     */
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "SplitLargeMeshesProcess_Triangle";
+    }
 
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
@@ -156,7 +162,13 @@ public:
     *   combination of #aiPostProcessSteps.
     * @return true if the process is present in this flag fields, false if not.
     */
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "SplitLargeMeshesProcess_Vertex";
+    }
 
     // -------------------------------------------------------------------
     /** Called prior to ExecuteOnScene().
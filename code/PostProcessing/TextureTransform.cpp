@@ -59,7 +59,7 @@ TextureTransformStep::TextureTransformStep() : configFlags()  {
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool TextureTransformStep::IsActive( unsigned int pFlags) const {
+bool TextureTransformStep::IsActive( aiPostProcessStepMask pFlags) const {
     return  (pFlags & aiProcess_TransformUVCoords) != 0;
 }
 
@@ -200,7 +200,13 @@ public:
     ~TextureTransformStep() override = default;
 
     // -------------------------------------------------------------------
-    bool IsActive( unsigned int pFlags) const override;
+    bool IsActive( aiPostProcessStepMask pFlags) const override;
+
+    // -------------------------------------------------------------------
+    /// @brief Returns the name of the step.
+    const char *GetName() const override {
+        return "TextureTransformStep";
+    }
 
     // -------------------------------------------------------------------
     void Execute( aiScene* pScene) override;
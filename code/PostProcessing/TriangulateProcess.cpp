@@ -64,6 +64,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Common/PolyTools.h"
 #include "contrib/earcut-hpp/earcut.hpp"
 
+#include <atomic>
 #include <memory>
 #include <cstdint>
 
@@ -176,7 +177,7 @@ namespace {
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool TriangulateProcess::IsActive( unsigned int pFlags) const {
+bool TriangulateProcess::IsActive( aiPostProcessStepMask pFlags) const {
     return (pFlags & aiProcess_Triangulate) != 0;
 }
 
@@ -185,15 +186,14 @@ bool TriangulateProcess::IsActive( unsigned int pFlags) const {
 void TriangulateProcess::Execute( aiScene* pScene) {
     ASSIMP_LOG_DEBUG("TriangulateProcess begin");
 
-    bool bHas = false;
-    for( unsigned int a = 0; a < pScene->mNumMeshes; a++)
-    {
+    std::atomic<bool> bHas(false);
+    ParallelFor(pScene->mNumMeshes, [&](unsigned int a) {
         if (pScene->mMeshes[ a ]) {
             if ( TriangulateMesh( pScene->mMeshes[ a ] ) ) {
                 bHas = true;
             }
         }
-    }
+    });
     if ( bHas ) {
         ASSIMP_LOG_INFO( "TriangulateProcess finished. All polygons have been triangulated." );
     } else {
@@ -62,7 +62,7 @@ ValidateDSProcess::ValidateDSProcess() : mScene(nullptr) {}
 
 // ------------------------------------------------------------------------------------------------
 // Returns whether the processing step is present in the given flag field.
-bool ValidateDSProcess::IsActive(unsigned int pFlags) const {
+bool ValidateDSProcess::IsActive(aiPostProcessStepMask pFlags) const {
     return (pFlags & aiProcess_ValidateDataStructure) != 0;
 }
 // ------------------------------------------------------------------------------------------------
@@ -385,6 +385,32 @@ void ValidateDSProcess::Validate(const aiMesh *pMesh) {
             }
     }
 
+    // the interleaved vertex stream must mirror the mesh
+    if (pMesh->mVertexStream) {
+        const aiVertexStream *stream = pMesh->mVertexStream;
+        if (stream->mNumVertices != pMesh->mNumVertices) {
+            ReportError("aiMesh::mVertexStream::mNumVertices is %u, but the mesh has %u vertices",
+                    stream->mNumVertices, pMesh->mNumVertices);
+        }
+        if (!stream->mData || !stream->mStride) {
+            ReportError("aiMesh::mVertexStream::mData is nullptr or mStride is 0");
+        }
+        if (stream->mNumAttributes && !stream->mAttributes) {
+            ReportError("aiMesh::mVertexStream::mAttributes is nullptr (mNumAttributes is %u)",
+                    stream->mNumAttributes);
+        }
+        for (unsigned int i = 0; i < stream->mNumAttributes; ++i) {
+            const aiVertexAttribute &attr = stream->mAttributes[i];
+            static const unsigned int sizes[] = { 4, 2, 2, 2, 1, 1 };
+            if (static_cast<unsigned int>(attr.mFormat) > aiVertexFormat_Snorm8) {
+                ReportError("aiMesh::mVertexStream::mAttributes[%u] has an invalid format", i);
+            }
+            if (attr.mOffset + attr.mNumComponents * sizes[attr.mFormat] > stream->mStride) {
+                ReportError("aiMesh::mVertexStream::mAttributes[%u] exceeds the vertex stride", i);
+            }
+        }
+    }
+
     // now validate all bones
     if (pMesh->mNumBones) {
         if (!pMesh->mBones) {
@@ -878,6 +904,19 @@ void ValidateDSProcess::Validate(const aiNode *pNode) {
             abHadMesh[pNode->mMeshes[i]] = true;
         }
     }
+    if (pNode->mNumInstances) {
+        if (!pNode->mInstanceTransforms) {
+            ReportError("aiNode::mInstanceTransforms is nullptr for node %s (aiNode::mNumInstances is %i)",
+                    nodeName, pNode->mNumInstances);
+        }
+        if (!pNode->mNumMeshes) {
+            ReportWarning("aiNode::mNumInstances is %i for node %s, but it has no meshes",
+                    pNode->mNumInstances, nodeName);
+        }
+    } else if (pNode->mInstanceTransforms) {
+        ReportError("aiNode::mInstanceTransforms is not nullptr for node %s (aiNode::mNumInstances is 0)",
+                nodeName);
+    }
     if (pNode->mNumChildren) {
         if (!pNode->mChildren) {
             ReportError("aiNode::mChildren is nullptr for node %s (aiNode::mNumChildren is %i)",
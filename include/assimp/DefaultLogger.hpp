@@ -54,10 +54,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "LogStream.hpp"
 #include "Logger.hpp"
 #include "NullLogger.hpp"
+#include <mutex>
 #include <vector>
 
 #ifndef ASSIMP_BUILD_SINGLETHREADED
-#include <mutex>
 #include <thread>
 #endif
 
@@ -189,9 +189,9 @@ private:
     //! Attached streams
     StreamArray m_StreamArray;
 
-#ifndef ASSIMP_BUILD_SINGLETHREADED
+    //! Guards the streams and the repeated message filter, the
+    //! library logs from its own worker threads in any build.
     std::mutex m_arrayMutex;
-#endif
 
     bool noRepeatMsg;
     char lastMsg[MAX_LOG_MESSAGE_LENGTH * 2];
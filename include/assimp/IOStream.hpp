@@ -124,8 +124,26 @@ public:
      *  See fflush() for more details.
      */
     virtual void Flush() = 0;
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the complete file contents if the stream keeps them
+     *  in memory, nullptr otherwise.
+     *
+     *  Streams backed by a memory mapping or by a memory buffer can hand
+     *  out their data directly, so readers can access the file without
+     *  copying it. The returned block is FileSize() bytes long, is not
+     *  zero-terminated and stays valid until the stream is closed. It is
+     *  independent of the read cursor. Readers must fall back to Read()
+     *  if nullptr is returned.
+     */
+    virtual const uint8_t* GetMappedData() const;
 }; //! class IOStream
 
+// ----------------------------------------------------------------------------------
+AI_FORCE_INLINE const uint8_t* IOStream::GetMappedData() const {
+    return nullptr;
+}
+
 } //!namespace Assimp
 
 #endif //!!AI_IOSTREAM_H_INC
@@ -56,6 +56,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // Public ASSIMP data structures
 #include <assimp/types.h>
+#include <assimp/postprocess.h>
 
 #include <exception>
 
@@ -78,6 +79,13 @@ class BaseProcess;
 class SharedPostProcessInfo;
 class BatchLoader;
 
+// =======================================================================
+// Profiling, see Profiler.h for the declarations
+namespace Profiling {
+class Profiler;
+struct ProfileReport;
+} // namespace Profiling
+
 // =======================================================================
 // Holy stuff, only for members of the high council of the Jedi.
 class ImporterPimpl;
@@ -390,6 +398,16 @@ public:
      */
     bool ValidateFlags(unsigned int pFlags) const;
 
+    // -------------------------------------------------------------------
+    /** @brief Check whether a given 64 bit set of post-processing flags
+     *  is supported.
+     *
+     *  @param pFlags Bitwise combination of the aiPostProcess flags,
+     *    including the ones beyond the first 32 bits.
+     *  @return true if this flag combination is fine.
+     *  @see ValidateFlags(unsigned int)  */
+    bool ValidateFlags64(aiPostProcessStepMask pFlags) const;
+
     // -------------------------------------------------------------------
     /** Reads the given file and returns its contents if successful.
      *
@@ -416,6 +434,19 @@ public:
             const char *pFile,
             unsigned int pFlags);
 
+    // -------------------------------------------------------------------
+    /** @brief Reads the given file and returns its contents if successful.
+     *
+     * Same as ReadFile(const char*, unsigned int), but takes a 64 bit
+     * mask so that post processing steps beyond the first 32 bits
+     * can be requested as well.
+     * @param pFile Path and filename to the file to be imported.
+     * @param pFlags Optional post processing steps, see #aiPostProcessStepMask.
+     * @return A pointer to the imported data, nullptr if the import failed.  */
+    const aiScene *ReadFile64(
+            const char *pFile,
+            aiPostProcessStepMask pFlags);
+
     // -------------------------------------------------------------------
     /** Reads the given file from a memory buffer and returns its
      *  contents if successful.
@@ -459,6 +490,17 @@ public:
             unsigned int pFlags,
             const char *pHint = "");
 
+    // -------------------------------------------------------------------
+    /** @brief Reads the given file from a memory buffer.
+     *
+     * Same as ReadFileFromMemory(), but takes a 64 bit mask of post
+     * processing steps, see #aiPostProcessStepMask.  */
+    const aiScene *ReadFileFromMemory64(
+            const void *pBuffer,
+            size_t pLength,
+            aiPostProcessStepMask pFlags,
+            const char *pHint = "");
+
     // -------------------------------------------------------------------
     /** Apply post-processing to an already-imported scene.
      *
@@ -479,6 +521,13 @@ public:
      *    to the #Importer instance.  */
     const aiScene *ApplyPostProcessing(unsigned int pFlags);
 
+    // -------------------------------------------------------------------
+    /** @brief Apply post-processing to an already-imported scene.
+     *
+     *  Same as ApplyPostProcessing(unsigned int), but takes a 64 bit mask
+     *  of post processing steps, see #aiPostProcessStepMask.  */
+    const aiScene *ApplyPostProcessing64(aiPostProcessStepMask pFlags);
+
     const aiScene *ApplyCustomizedPostProcessing(BaseProcess *rootProcess, bool requestValidation);
 
     // -------------------------------------------------------------------
@@ -638,6 +687,18 @@ public:
      *   is (naturally) not included.*/
     void GetMemoryRequirements(aiMemoryInfo &in) const;
 
+    // -------------------------------------------------------------------
+    /** Returns the timings collected during the last import.
+     *
+     * Timings are only collected if #AI_CONFIG_GLOB_MEASURE_TIME is set.
+     * The report contains the nested regions "total", "import",
+     * "preprocess" and "postprocess" (with one child per executed step)
+     * and all sub-regions added by the importer, e.g. "FBX parse".
+     * Include <assimp/Profiler.h> to access the report.
+     * @param report Data structure to be filled.
+     * @return false if no timings have been collected. */
+    bool GetProfileReport(Profiling::ProfileReport &report) const;
+
     // -------------------------------------------------------------------
     /** Enables "extra verbose" mode.
      *
@@ -0,0 +1,136 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/**
+ *  @file  MMapIOSystem.h
+ *  @brief IOSystem implementation which maps files into memory instead of
+ *         reading them through the C file functions.
+ */
+#pragma once
+#ifndef AI_MMAPIOSYSTEM_H_INC
+#define AI_MMAPIOSYSTEM_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/IOStream.hpp>
+
+#include <string>
+
+namespace Assimp {
+
+// ----------------------------------------------------------------------------------
+//! @class  MMapIOStream
+//! @brief  Read-only stream on top of a memory mapped file.
+//!
+//! The contents are available through GetMappedData() without any copy, Read()
+//! is a plain memcpy from the mapping. Instances are created by MMapIOSystem.
+class ASSIMP_API MMapIOStream : public IOStream {
+    friend class MMapIOSystem;
+
+protected:
+    /// @brief The class constructor, takes ownership of the mapping.
+    /// @param data         The mapped file contents
+    /// @param size         The size of the mapping in bytes
+    /// @param strFilename  The file name
+    MMapIOStream(const uint8_t *data, size_t size, const std::string &strFilename);
+
+public:
+    /** Destructor, unmaps the file. */
+    ~MMapIOStream() override;
+
+    // -------------------------------------------------------------------
+    /// Read from stream
+    size_t Read(void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Write to stream, always fails
+    size_t Write(const void *pvBuffer, size_t pSize, size_t pCount) override;
+
+    // -------------------------------------------------------------------
+    /// Seek specific position
+    aiReturn Seek(size_t pOffset, aiOrigin pOrigin) override;
+
+    // -------------------------------------------------------------------
+    /// Get current seek position
+    size_t Tell() const override;
+
+    // -------------------------------------------------------------------
+    /// Get size of file
+    size_t FileSize() const override;
+
+    // -------------------------------------------------------------------
+    /// Flush file contents, nothing to do for a read-only mapping
+    void Flush() override;
+
+    // -------------------------------------------------------------------
+    /// Returns the mapped file contents
+    const uint8_t *GetMappedData() const override;
+
+private:
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mPos;
+    std::string mFilename;
+};
+
+// ---------------------------------------------------------------------------
+/** IOSystem which memory maps files opened for reading.
+ *
+ *  Files opened in a read mode are mapped into memory, so format readers
+ *  can access their contents through IOStream::GetMappedData() instead of
+ *  copying them into a buffer of their own. Files opened for writing, empty
+ *  files and files which cannot be mapped are handled by DefaultIOSystem.
+ *  Mapping is only supported on POSIX systems, elsewhere this class behaves
+ *  like DefaultIOSystem.
+ */
+class ASSIMP_API MMapIOSystem : public DefaultIOSystem {
+public:
+    // -------------------------------------------------------------------
+    /** Open a new file with a given path. */
+    IOStream *Open(const char *pFile, const char *pMode = "rb") override;
+};
+
+} //!ns Assimp
+
+#endif //AI_MMAPIOSYSTEM_H_INC
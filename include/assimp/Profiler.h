@@ -54,7 +54,10 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/DefaultLogger.hpp>
 #include <assimp/TinyFormatter.h>
 
-#include <map>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
 
 namespace Assimp {
 namespace Profiling {
@@ -62,39 +65,311 @@ namespace Profiling {
 using namespace Formatter;
 
 // ------------------------------------------------------------------------------------------------
-/** Simple wrapper around boost::timer to simplify reporting. Timings are automatically
- *  dumped to the log file.
+/** Accumulated timings of a named region. Regions are nested, the same region name
+ *  can occur below different parents.
+ */
+struct ProfileEntry {
+    /** Name of the region, empty for the root of a report */
+    std::string name;
+
+    /** Accumulated wall time of all calls, including the child regions, in seconds */
+    double seconds = 0.0;
+
+    /** Number of times the region was entered */
+    uint64_t calls = 0;
+
+    /** Number of bytes processed inside the region, as reported by AddBytes() */
+    uint64_t bytes = 0;
+
+    /** Nested regions, in the order they were entered first */
+    std::vector<ProfileEntry> children;
+
+    /** Looks up a nested region by a '/'-separated path, e.g. "total/import/FBX parse" */
+    const ProfileEntry *Find(const std::string &path) const {
+        const ProfileEntry *cur = this;
+        std::string::size_type pos = 0;
+        while (cur != nullptr && pos <= path.length()) {
+            std::string::size_type end = path.find('/', pos);
+            if (end == std::string::npos) {
+                end = path.length();
+            }
+            const std::string part = path.substr(pos, end - pos);
+            const ProfileEntry *next = nullptr;
+            for (const ProfileEntry &child : cur->children) {
+                if (child.name == part) {
+                    next = &child;
+                    break;
+                }
+            }
+            cur = next;
+            pos = end + 1;
+        }
+        return cur;
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+/** A single, closed call of a region. */
+struct ProfileEvent {
+    /** Name of the region */
+    std::string name;
+
+    /** Nesting depth, 0 for top-level regions */
+    unsigned int depth = 0;
+
+    /** Start time in seconds, relative to the creation of the profiler */
+    double start = 0.0;
+
+    /** Duration in seconds */
+    double duration = 0.0;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Snapshot of all timings collected by a Profiler. */
+struct ProfileReport {
+    /** Unnamed root, its children are the top-level regions */
+    ProfileEntry root;
+
+    /** All closed calls in the order they were closed */
+    std::vector<ProfileEvent> events;
+
+    /** Looks up a region by a '/'-separated path, e.g. "total/postprocess" */
+    const ProfileEntry *Find(const std::string &path) const {
+        return root.Find(path);
+    }
+
+    /** Returns the region tree as JSON document */
+    std::string ToJSON() const {
+        std::string out;
+        AppendEntry(out, root);
+        return out;
+    }
+
+    /** Returns all calls in the Chrome trace event format, which can be loaded into
+     *  chrome://tracing or Perfetto. */
+    std::string ToChromeTrace() const {
+        std::string out = "{\"traceEvents\":[";
+        for (size_t i = 0; i < events.size(); ++i) {
+            const ProfileEvent &ev = events[i];
+            if (i > 0) {
+                out += ',';
+            }
+            out += "{\"name\":";
+            AppendString(out, ev.name);
+            out += ",\"cat\":\"assimp\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":";
+            AppendNumber(out, ev.start * 1e6);
+            out += ",\"dur\":";
+            AppendNumber(out, ev.duration * 1e6);
+            out += '}';
+        }
+        out += "],\"displayTimeUnit\":\"ms\"}";
+        return out;
+    }
+
+private:
+    static void AppendNumber(std::string &out, double value) {
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "%.3f", value);
+        out += buffer;
+    }
+
+    static void AppendString(std::string &out, const std::string &value) {
+        out += '"';
+        for (const char c : value) {
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char buffer[8];
+                ::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(c));
+                out += buffer;
+            } else {
+                out += c;
+            }
+        }
+        out += '"';
+    }
+
+    static void AppendEntry(std::string &out, const ProfileEntry &entry) {
+        out += "{\"name\":";
+        AppendString(out, entry.name);
+        out += ",\"seconds\":";
+        char buffer[32];
+        ::snprintf(buffer, sizeof(buffer), "%.9f", entry.seconds);
+        out += buffer;
+        out += ",\"calls\":" + std::to_string(entry.calls);
+        out += ",\"bytes\":" + std::to_string(entry.bytes);
+        out += ",\"children\":[";
+        for (size_t i = 0; i < entry.children.size(); ++i) {
+            if (i > 0) {
+                out += ',';
+            }
+            AppendEntry(out, entry.children[i]);
+        }
+        out += "]}";
+    }
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Hierarchical profiler based on a monotonic clock. Regions opened while another region is
+ *  open become children of it. Timings are accumulated per region and automatically dumped to
+ *  the log file. The profiler is not thread-safe, each Importer owns its own instance.
  */
 class Profiler {
 public:
-    Profiler() = default;
+    using Clock = std::chrono::steady_clock;
 
+    Profiler() :
+            mEpoch(Clock::now()) {
+        Reset();
+    }
 
-    /** Start a named timer */
+    /** Start a named timer, nested into the currently open region */
     void BeginRegion(const std::string& region) {
-        regions[region] = std::chrono::system_clock::now();
+        const size_t parent = mStack.empty() ? 0 : mStack.back().node;
+        size_t node = 0;
+        for (const size_t child : mNodes[parent].children) {
+            if (mNodes[child].name == region) {
+                node = child;
+                break;
+            }
+        }
+        if (node == 0) {
+            node = mNodes.size();
+            mNodes.push_back(Node(region));
+            mNodes[parent].children.push_back(node);
+        }
+
+        mStack.push_back({ node, Clock::now() });
         ASSIMP_LOG_DEBUG("START `",region,"`");
     }
 
-
-    /** End a specific named timer and write its end time to the log */
+    /** End a specific named timer and write its end time to the log. Regions which were
+     *  opened after it and are still open are closed, too. */
     void EndRegion(const std::string& region) {
-        RegionMap::const_iterator it = regions.find(region);
-        if (it == regions.end()) {
+        size_t pos = mStack.size();
+        while (pos > 0 && mNodes[mStack[pos - 1].node].name != region) {
+            --pos;
+        }
+        if (pos == 0) {
             return;
         }
 
-        std::chrono::duration<double> elapsedSeconds = std::chrono::system_clock::now() - regions[region];
-        ASSIMP_LOG_DEBUG("END   `",region,"`, dt= ", elapsedSeconds.count()," s");
+        const Clock::time_point now = Clock::now();
+        double elapsedSeconds = 0.0;
+        while (mStack.size() >= pos) {
+            const Frame &frame = mStack.back();
+            Node &node = mNodes[frame.node];
+            elapsedSeconds = std::chrono::duration<double>(now - frame.start).count();
+            node.seconds += elapsedSeconds;
+            ++node.calls;
+
+            ProfileEvent ev;
+            ev.name = node.name;
+            ev.depth = static_cast<unsigned int>(mStack.size() - 1);
+            ev.start = std::chrono::duration<double>(frame.start - mEpoch).count();
+            ev.duration = elapsedSeconds;
+            mEvents.push_back(ev);
+
+            mStack.pop_back();
+        }
+        ASSIMP_LOG_DEBUG("END   `",region,"`, dt= ", elapsedSeconds," s");
+    }
+
+    /** Adds a number of processed bytes to the innermost open region */
+    void AddBytes(uint64_t bytes) {
+        if (!mStack.empty()) {
+            mNodes[mStack.back().node].bytes += bytes;
+        }
+    }
+
+    /** Discards all collected timings and closes all open regions */
+    void Reset() {
+        mNodes.clear();
+        mNodes.push_back(Node(std::string()));
+        mStack.clear();
+        mEvents.clear();
+        mEpoch = Clock::now();
+    }
+
+    /** Returns a snapshot of the collected timings, regions still open are not included */
+    ProfileReport GetReport() const {
+        ProfileReport report;
+        BuildEntry(0, report.root);
+        report.events = mEvents;
+        return report;
+    }
+
+private:
+    struct Node {
+        explicit Node(const std::string &n) :
+                name(n), seconds(0.0), calls(0), bytes(0) {}
+
+        std::string name;
+        double seconds;
+        uint64_t calls;
+        uint64_t bytes;
+        std::vector<size_t> children;
+    };
+
+    struct Frame {
+        size_t node;
+        Clock::time_point start;
+    };
+
+    void BuildEntry(size_t index, ProfileEntry &entry) const {
+        const Node &node = mNodes[index];
+        entry.name = node.name;
+        entry.seconds = node.seconds;
+        entry.calls = node.calls;
+        entry.bytes = node.bytes;
+        entry.children.resize(node.children.size());
+        for (size_t i = 0; i < node.children.size(); ++i) {
+            BuildEntry(node.children[i], entry.children[i]);
+        }
+    }
+
+    Clock::time_point mEpoch;
+    std::vector<Node> mNodes;
+    std::vector<Frame> mStack;
+    std::vector<ProfileEvent> mEvents;
+};
+
+// ------------------------------------------------------------------------------------------------
+/** Opens a region for the lifetime of the object. A nullptr profiler is accepted, so
+ *  importers can use it unconditionally.
+ */
+class ProfileScope {
+public:
+    ProfileScope(Profiler *profiler, const char *region) :
+            mProfiler(profiler), mRegion(region) {
+        if (mProfiler != nullptr) {
+            mProfiler->BeginRegion(mRegion);
+        }
     }
 
+    ~ProfileScope() {
+        if (mProfiler != nullptr) {
+            mProfiler->EndRegion(mRegion);
+        }
+    }
+
+    /** Adds a number of processed bytes to the innermost open region */
+    void AddBytes(uint64_t bytes) {
+        if (mProfiler != nullptr) {
+            mProfiler->AddBytes(bytes);
+        }
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
 private:
-    typedef std::map<std::string,std::chrono::time_point<std::chrono::system_clock>> RegionMap;
-    RegionMap regions;
+    Profiler *mProfiler;
+    std::string mRegion;
 };
 
-}
-}
+} // namespace Profiling
+} // namespace Assimp
 
 #endif // AI_INCLUDED_PROFILER_H
-
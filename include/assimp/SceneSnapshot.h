@@ -0,0 +1,160 @@
+/*
+Open Asset Import Library (assimp)
+----------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the
+following conditions are met:
+
+* Redistributions of source code must retain the above
+  copyright notice, this list of conditions and the
+  following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+  copyright notice, this list of conditions and the
+  following disclaimer in the documentation and/or other
+  materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+  contributors may be used to endorse or promote products
+  derived from this software without specific prior
+  written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+----------------------------------------------------------------------
+*/
+
+/**
+ *  @file  SceneSnapshot.h
+ *  @brief Relocatable in-memory image of an imported scene.
+ */
+#pragma once
+#ifndef AI_SCENESNAPSHOT_H_INC
+#define AI_SCENESNAPSHOT_H_INC
+
+#ifdef __GNUC__
+#   pragma GCC system_header
+#endif
+
+#include <assimp/defs.h>
+
+#include <cstddef>
+#include <cstdint>
+
+struct aiScene;
+
+namespace Assimp {
+
+class IOStream;
+
+// ---------------------------------------------------------------------------
+/** @brief A scene stored as one relocatable block of memory.
+ *
+ *  A snapshot holds the byte images of all scene structures and their arrays
+ *  in a single blob. Pointers are stored as offsets from the start of the blob
+ *  and a relocation table lists where they are. Loading a snapshot is one file
+ *  mapping and one pass adding the base address to these offsets, there is no
+ *  parsing and no allocation per object.
+ *
+ *  Snapshots are meant to be a cache of the same build of the library. They
+ *  store the structures as they are laid out in memory, a snapshot written by
+ *  a build with a different version, compile flags, pointer size or byte order
+ *  is rejected. They are not a format for the exchange of assets.
+ *
+ *  After the relocation the scene is walked once. Every array has to lie
+ *  inside the blob and hold as many elements as its count says, and face
+ *  indices, bone weights and node mesh indices have to be in range, otherwise
+ *  the snapshot is rejected. This is no full validation, see
+ *  #aiProcess_ValidateDataStructure for that.
+ *
+ *  The scene returned by GetScene() lives inside the blob. It is valid until
+ *  the snapshot is closed and must not be modified or deleted, copy it with
+ *  SceneCombiner::CopyScene() to get a scene of your own.
+ *
+ *  @code
+ *  SceneSnapshot::Write(importer.GetScene(), stream);
+ *  ...
+ *  SceneSnapshot snapshot;
+ *  if (snapshot.Open("model.assnap")) {
+ *      const aiScene *scene = snapshot.GetScene();
+ *  }
+ *  @endcode
+ */
+class ASSIMP_API SceneSnapshot {
+public:
+    /// @brief  The class constructor, creates an empty snapshot.
+    SceneSnapshot();
+
+    /// @brief  The class destructor, releases the snapshot memory.
+    ~SceneSnapshot();
+
+    SceneSnapshot(const SceneSnapshot &) = delete;
+    SceneSnapshot &operator=(const SceneSnapshot &) = delete;
+
+    // -------------------------------------------------------------------
+    /** @brief Writes a snapshot of a scene.
+     *  @param scene    The scene to store.
+     *  @param stream   The stream to write to.
+     *  @return false if the snapshot could not be written completely. */
+    static bool Write(const aiScene *scene, IOStream *stream);
+
+    // -------------------------------------------------------------------
+    /** @brief Maps a snapshot file into memory and relocates it.
+     *
+     *  The file is mapped copy-on-write, so only the pages holding pointers
+     *  are copied. Where mapping is not supported the file is read instead.
+     *  @param file     The snapshot file.
+     *  @return false if the file could not be read or is no valid snapshot
+     *          of this build. */
+    bool Open(const char *file);
+
+    // -------------------------------------------------------------------
+    /** @brief Relocates a copy of a snapshot held in memory.
+     *  @param data     The snapshot contents.
+     *  @param size     The size of the snapshot in bytes.
+     *  @return false if the data is no valid snapshot of this build. */
+    bool Load(const void *data, size_t size);
+
+    // -------------------------------------------------------------------
+    /** @brief Releases the snapshot, the scene becomes invalid. */
+    void Close();
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the scene, nullptr if no snapshot is loaded. */
+    const aiScene *GetScene() const {
+        return mScene;
+    }
+
+    // -------------------------------------------------------------------
+    /** @brief Returns the size of the snapshot in bytes. */
+    size_t GetSize() const {
+        return mSize;
+    }
+
+private:
+    bool Relocate();
+
+    uint8_t *mData;
+    size_t mSize;
+    bool mMapped;
+    const aiScene *mScene;
+};
+
+} //!ns Assimp
+
+#endif //AI_SCENESNAPSHOT_H_INC
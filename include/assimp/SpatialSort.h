@@ -141,10 +141,43 @@ public:
     unsigned int GenerateMappingTable(std::vector<unsigned int> &fill,
             ai_real pRadius) const;
 
+    // ------------------------------------------------------------------------------------
+    /** Builds a hashed uniform grid over the positions in addition to the sorted
+     *  array. #FindPositions() with a radius of up to the cell size and
+     *  #FindIdenticalPositions() then only visit the 27 cells around the query
+     *  position instead of scanning a slab along the sorting plane. This keeps
+     *  queries fast for flat or axis-aligned geometry, where many positions have
+     *  nearly the same distance to the plane. The grid is dropped by #Fill().
+     *  The SpatialSort must be finalized.
+     * @param pCellSize Edge length of a grid cell, usually the largest query radius.
+     *   If it is too small for the extent of the data no grid is built. */
+    void BuildGrid(ai_real pCellSize);
+
+    // ------------------------------------------------------------------------------------
+    /** Returns whether a grid is present, see #BuildGrid(). */
+    bool HasGrid() const {
+        return mGridCellSize > 0;
+    }
+
+    // ------------------------------------------------------------------------------------
+    /** Estimates whether queries with the given radius are answered faster by the
+     *  grid than by the sorted array. A few positions are sampled to count how many
+     *  entries the scan along the sorting plane would visit per query.
+     * @param pRadius The radius which will be passed to #FindPositions().
+     * @return true if building a grid is worth it. */
+    bool IsGridPreferable(ai_real pRadius) const;
+
 protected:
     /** Return the distance to the sorting plane. */
     ai_real CalculateDistance(const aiVector3D &pPosition) const;
 
+    /** Computes the grid cell of a position, returns false if it is too far outside. */
+    bool CalculateGridCell(const aiVector3D &pPosition, int *pCell) const;
+
+    /** Calls pVisitor for all grid entries in the 27 cells around a position. */
+    template <typename Visitor>
+    void VisitGridNeighbours(const aiVector3D &pPosition, Visitor pVisitor) const;
+
 protected:
     /** Normal of the sorting plane, normalized.
      */
@@ -182,6 +215,25 @@ protected:
 
     /// false until the Finalize method is called.
     bool mFinalized;
+
+    /** An entry of the hashed grid, the position is duplicated for locality. */
+    struct GridEntry {
+        unsigned int mIndex; ///< The vertex referred by this entry
+        int mCell[3]; ///< Grid cell of the vertex
+        aiVector3D mPosition; ///< Position
+    };
+
+    /// Edge length of a grid cell, 0 if there is no grid.
+    ai_real mGridCellSize;
+
+    /// Position of the corner of cell 0,0,0.
+    aiVector3D mGridOrigin;
+
+    /// Offsets of the hash buckets into mGridEntries, plus the end offset.
+    std::vector<unsigned int> mGridBuckets;
+
+    /// All grid entries, ordered by hash bucket.
+    std::vector<GridEntry> mGridEntries;
 };
 
 } // end of namespace Assimp
@@ -44,13 +44,19 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/ai_assert.h>
 #include <assimp/StringUtils.h>
+#include <assimp/fast_atof.h>
+#include <assimp/ParsingUtils.h>
 #include <assimp/DefaultLogger.hpp>
 
 #include "BaseImporter.h"
 #include "IOStream.hpp"
 
 #include <pugixml.hpp>
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <istream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -87,6 +93,594 @@ public:
 using XmlNode = pugi::xml_node;
 using XmlAttribute = pugi::xml_attribute;
 
+/// @brief A pull parser which reads an xml-file from a stream block by block.
+///
+/// In contrast to TXmlParser the file is never held in memory as a whole. The reader
+/// steps from one start tag, end tag or text run to the next, and the character data
+/// of the current element can be parsed into numbers straight from the read buffer.
+/// Only UTF-8 (and ASCII) encoded files are supported, see isUtf8().
+///
+/// An example:
+/// @code
+/// XmlStreamReader reader(fileStream);
+/// while (reader.next()) {
+///     if (reader.getEvent() == XmlStreamReader::StartElement && reader.getName() == "float_array") {
+///         values.resize(count);
+///         reader.readReals(values.data(), count);
+///     }
+/// }
+/// @endcode
+class XmlStreamReader {
+public:
+    /// @brief The kind of markup the reader is positioned on.
+    enum Event {
+        None,           ///< next() was not called yet.
+        StartElement,   ///< A start tag, name and attributes are valid.
+        EndElement,     ///< An end tag, also reported for empty elements.
+        Text,           ///< Character data, entities are decoded.
+        CData,          ///< A CDATA section.
+        EndDocument,    ///< The end of the file was reached.
+        Error           ///< The file is malformed.
+    };
+
+    using Attribute = std::pair<std::string, std::string>;
+
+    /// @brief The class constructor.
+    /// @param[in] stream       The input stream, must outlive the reader.
+    /// @param[in] blockSize    The number of bytes read from the stream at once.
+    explicit XmlStreamReader(IOStream *stream, size_t blockSize = 1024 * 1024) :
+            mStream(stream), mBlockSize(std::max<size_t>(blockSize, 16)), mBuffer(1, '\0'), mPos(0), mEnd(0),
+            mEof(nullptr == stream), mEvent(None), mPendingEnd(false) {
+        fill(4);
+        // skip the utf-8 byte order mark
+        if (mEnd >= 3 && mBuffer[0] == '\xEF' && mBuffer[1] == '\xBB' && mBuffer[2] == '\xBF') {
+            mPos = 3;
+        }
+    }
+
+    /// @brief  Will return false for utf-16 and utf-32 encoded files, which need to be parsed by TXmlParser.
+    bool isUtf8() const {
+        const size_t available = mEnd - mPos;
+        if (available >= 2 && ((mBuffer[mPos] == '\xFE' && mBuffer[mPos + 1] == '\xFF') || (mBuffer[mPos] == '\xFF' && mBuffer[mPos + 1] == '\xFE'))) {
+            return false;
+        }
+        return available < 2 || (mBuffer[mPos] != '\0' && mBuffer[mPos + 1] != '\0');
+    }
+
+    /// @brief  Will move the unread data into the given buffer, used to hand the file over to another parser.
+    /// @param[out] data    Receives the unread part of the file.
+    void readAll(std::vector<char> &data) {
+        data.assign(mBuffer.begin() + mPos, mBuffer.begin() + mEnd);
+        mPos = mEnd;
+        while (!mEof) {
+            const size_t offset = data.size();
+            data.resize(offset + mBlockSize);
+            const size_t numRead = mStream->Read(&data[offset], 1, mBlockSize);
+            data.resize(offset + numRead);
+            mEof = 0 == numRead;
+        }
+    }
+
+    /// @brief  Will step to the next start tag, end tag or text run.
+    /// @return false at the end of the document or if the file is malformed.
+    bool next() {
+        if (mPendingEnd) {
+            mPendingEnd = false;
+            mEvent = EndElement;
+            mOpen.pop_back();
+            return true;
+        }
+
+        for (;;) {
+            if (!fill(1)) {
+                mEvent = mOpen.empty() ? EndDocument : Error;
+                return false;
+            }
+
+            if (mBuffer[mPos] != '<') {
+                mText.clear();
+                while (fill(1) && mBuffer[mPos] != '<') {
+                    const char *begin = &mBuffer[mPos];
+                    const char *end = static_cast<const char *>(::memchr(begin, '<', mEnd - mPos));
+                    const size_t len = nullptr == end ? mEnd - mPos : end - begin;
+                    mText.append(begin, len);
+                    mPos += len;
+                }
+                // whitespace between the tags is no content
+                if (mText.find_first_not_of(" \t\r\n") == std::string::npos) {
+                    continue;
+                }
+                normalizeLineEnds(mText, false);
+                decodeEntities(mText);
+                mEvent = Text;
+                return true;
+            }
+
+            fill(9);
+            if (startsWith("<!--")) {
+                if (!skipPast("-->")) {
+                    return fail();
+                }
+            } else if (startsWith("<![CDATA[")) {
+                mPos += 9;
+                mText.clear();
+                if (!readPast("]]>", mText)) {
+                    return fail();
+                }
+                mEvent = CData;
+                return true;
+            } else if (startsWith("<?")) {
+                if (!skipPast("?>")) {
+                    return fail();
+                }
+            } else if (startsWith("<!")) {
+                if (!skipDeclaration()) {
+                    return fail();
+                }
+            } else {
+                return readTag();
+            }
+        }
+    }
+
+    /// @brief  Will return the current event.
+    Event getEvent() const {
+        return mEvent;
+    }
+
+    /// @brief  Will return the element name of a start or end tag.
+    const std::string &getName() const {
+        return mName;
+    }
+
+    /// @brief  Will return the character data of a text or CDATA event.
+    const std::string &getText() const {
+        return mText;
+    }
+
+    /// @brief  Will return the attributes of a start tag in document order.
+    const std::vector<Attribute> &getAttributes() const {
+        return mAttributes;
+    }
+
+    /// @brief  Will look up an attribute of the current start tag.
+    /// @param[in]  name    The name of the attribute.
+    /// @param[out] value   Receives the attribute value.
+    /// @return true, if the start tag has this attribute.
+    bool getAttribute(const char *name, std::string &value) const {
+        for (const Attribute &attr : mAttributes) {
+            if (attr.first == name) {
+                value = attr.second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief  Will return the number of open elements.
+    size_t getDepth() const {
+        return mOpen.size();
+    }
+
+    /// @brief  Will parse whitespace separated real numbers from the character data of the
+    ///         element just started. The rest of its character data is skipped.
+    /// @param[out] out     Receives the values, must hold count elements.
+    /// @param[in]  count   The maximum number of values to read.
+    /// @return The number of values read.
+    size_t readReals(ai_real *out, size_t count) {
+        size_t numRead = 0;
+        while (numRead < count && beginContent()) {
+            // the window has to be found first, buffering more data may move the content
+            const size_t window = contentWindow();
+            const char *begin = &mBuffer[mPos];
+            size_t numParsed = 0;
+            const char *end = fast_atoreal_array<ai_real>(begin, begin + window, out + numRead, count - numRead, &numParsed);
+            numRead += numParsed;
+            mPos += end - begin;
+            if (0 == numParsed && end == begin) {
+                break;
+            }
+        }
+        skipContent();
+        return numRead;
+    }
+
+    /// @brief  Will parse whitespace separated indices from the character data of the element
+    ///         just started. Negative values are clamped to zero.
+    /// @param[out] out     The indices are appended to this array.
+    /// @return The number of indices read.
+    size_t readIndices(std::vector<size_t> &out) {
+        const size_t oldSize = out.size();
+        while (beginContent()) {
+            const size_t window = contentWindow();
+            const char *begin = &mBuffer[mPos];
+            const char *end = begin + window;
+            const char *cur = begin;
+            while (cur != end) {
+                if (IsSpaceOrNewLine(*cur)) {
+                    ++cur;
+                    continue;
+                }
+                const char *next = cur;
+                const int value = strtol10(cur, &next);
+                if (next == cur) {
+                    // not a number, step over it
+                    ++cur;
+                    continue;
+                }
+                out.push_back(static_cast<size_t>(std::max(0, value)));
+                cur = next;
+            }
+            mPos += end - begin;
+        }
+        skipContent();
+        return out.size() - oldSize;
+    }
+
+    /// @brief  Will read whitespace separated tokens from the character data of the element
+    ///         just started. The rest of its character data is skipped.
+    /// @param[out] out     The tokens are appended to this array.
+    /// @param[in]  count   The maximum number of tokens to read.
+    /// @return The number of tokens read.
+    size_t readTokens(std::vector<std::string> &out, size_t count) {
+        size_t numRead = 0;
+        while (numRead < count && beginContent()) {
+            const size_t window = contentWindow();
+            const char *begin = &mBuffer[mPos];
+            const char *end = begin + window;
+            const char *cur = begin;
+            while (cur != end && numRead < count) {
+                if (IsSpaceOrNewLine(*cur)) {
+                    ++cur;
+                    continue;
+                }
+                const char *tokenEnd = cur;
+                while (tokenEnd != end && !IsSpaceOrNewLine(*tokenEnd)) {
+                    ++tokenEnd;
+                }
+                out.emplace_back(cur, tokenEnd);
+                decodeEntities(out.back());
+                ++numRead;
+                cur = tokenEnd;
+            }
+            mPos += cur - begin;
+        }
+        skipContent();
+        return numRead;
+    }
+
+    /// @brief  Will skip the rest of the element just started, including its end tag.
+    /// @return false if the file is malformed.
+    bool skipElement() {
+        if (mEvent != StartElement) {
+            return true;
+        }
+        const size_t depth = mOpen.size();
+        while (next()) {
+            if (mEvent == EndElement && mOpen.size() < depth) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief  Will replace the predefined and numeric character references in text.
+    /// @param[in,out] text     The text to decode.
+    static void decodeEntities(std::string &text) {
+        size_t pos = text.find('&');
+        if (pos == std::string::npos) {
+            return;
+        }
+
+        std::string out(text, 0, pos);
+        while (pos < text.size()) {
+            if (text[pos] != '&') {
+                out += text[pos++];
+                continue;
+            }
+            const size_t semicolon = text.find(';', pos);
+            if (semicolon == std::string::npos) {
+                out.append(text, pos, std::string::npos);
+                break;
+            }
+            const std::string entity = text.substr(pos + 1, semicolon - pos - 1);
+            if (entity == "lt") {
+                out += '<';
+            } else if (entity == "gt") {
+                out += '>';
+            } else if (entity == "amp") {
+                out += '&';
+            } else if (entity == "quot") {
+                out += '"';
+            } else if (entity == "apos") {
+                out += '\'';
+            } else if (entity.size() > 1 && entity[0] == '#') {
+                const bool hex = entity[1] == 'x';
+                const unsigned long code = std::strtoul(entity.c_str() + (hex ? 2 : 1), nullptr, hex ? 16 : 10);
+                appendUtf8(out, code);
+            } else {
+                // unknown entities are kept as they are
+                out.append(text, pos, semicolon - pos + 1);
+            }
+            pos = semicolon + 1;
+        }
+        text.swap(out);
+    }
+
+private:
+    bool fail() {
+        mEvent = Error;
+        return false;
+    }
+
+    // Makes sure at least num bytes are buffered, returns false at the end of the file.
+    bool fill(size_t num) {
+        while (mEnd - mPos < num && !mEof) {
+            if (mPos > 0) {
+                std::copy(mBuffer.begin() + mPos, mBuffer.begin() + mEnd, mBuffer.begin());
+                mEnd -= mPos;
+                mPos = 0;
+            }
+            mBuffer.resize(std::max(mBuffer.size(), mEnd + mBlockSize + 1));
+            const size_t numRead = mStream->Read(&mBuffer[mEnd], 1, mBlockSize);
+            mEof = 0 == numRead;
+            mEnd += numRead;
+            // keep the data zero terminated for the number parsers
+            mBuffer[mEnd] = '\0';
+        }
+        return mEnd - mPos >= num;
+    }
+
+    bool startsWith(const char *token) const {
+        const size_t len = ::strlen(token);
+        return mEnd - mPos >= len && 0 == ::strncmp(&mBuffer[mPos], token, len);
+    }
+
+    // Reads up to the given delimiter, which is consumed but not stored.
+    bool readPast(const char *delimiter, std::string &out) {
+        const size_t len = ::strlen(delimiter);
+        for (;;) {
+            const auto begin = mBuffer.begin() + mPos, end = mBuffer.begin() + mEnd;
+            const auto found = std::search(begin, end, delimiter, delimiter + len);
+            if (found != end) {
+                out.append(begin, found);
+                mPos = (found - mBuffer.begin()) + len;
+                return true;
+            }
+            // keep a possible partial delimiter at the end of the buffer
+            const size_t keep = std::min(mEnd - mPos, len - 1);
+            out.append(begin, end - keep);
+            mPos = mEnd - keep;
+            if (!fill(keep + 1)) {
+                return false;
+            }
+        }
+    }
+
+    bool skipPast(const char *delimiter) {
+        std::string ignored;
+        return readPast(delimiter, ignored);
+    }
+
+    // Skips a <!DOCTYPE ...> declaration including an internal subset.
+    bool skipDeclaration() {
+        int brackets = 0;
+        char quote = 0;
+        mPos += 2;
+        while (fill(1)) {
+            const char c = mBuffer[mPos++];
+            if (quote) {
+                quote = c == quote ? 0 : quote;
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '[') {
+                ++brackets;
+            } else if (c == ']') {
+                --brackets;
+            } else if (c == '>' && brackets <= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Returns the offset of the '>' closing the tag at mPos, buffering the whole tag.
+    size_t findTagEnd() {
+        char quote = 0;
+        for (size_t i = 1;; ++i) {
+            if (!fill(i + 1)) {
+                return std::string::npos;
+            }
+            const char c = mBuffer[mPos + i];
+            if (quote) {
+                quote = c == quote ? 0 : quote;
+            } else if (c == '"' || c == '\'') {
+                quote = c;
+            } else if (c == '>') {
+                return i;
+            }
+        }
+    }
+
+    bool readTag() {
+        const size_t tagEnd = findTagEnd();
+        if (tagEnd == std::string::npos) {
+            return fail();
+        }
+        const char *cur = &mBuffer[mPos + 1];
+        const char *end = &mBuffer[mPos + tagEnd];
+        mPos += tagEnd + 1;
+
+        const auto isNameEnd = [](char c) {
+            return IsSpaceOrNewLine(c) || c == '/' || c == '>' || c == '=';
+        };
+
+        if (*cur == '/') {
+            ++cur;
+            const char *nameEnd = cur;
+            while (nameEnd != end && !isNameEnd(*nameEnd)) {
+                ++nameEnd;
+            }
+            mName.assign(cur, nameEnd);
+            if (mOpen.empty() || mOpen.back() != mName) {
+                return fail();
+            }
+            mOpen.pop_back();
+            mEvent = EndElement;
+            return true;
+        }
+
+        const char *nameEnd = cur;
+        while (nameEnd != end && !isNameEnd(*nameEnd)) {
+            ++nameEnd;
+        }
+        if (nameEnd == cur) {
+            return fail();
+        }
+        mName.assign(cur, nameEnd);
+        cur = nameEnd;
+
+        mAttributes.clear();
+        for (;;) {
+            while (cur != end && IsSpaceOrNewLine(*cur)) {
+                ++cur;
+            }
+            if (cur == end) {
+                break;
+            }
+            if (*cur == '/') {
+                mPendingEnd = true;
+                break;
+            }
+
+            const char *attrEnd = cur;
+            while (attrEnd != end && !isNameEnd(*attrEnd)) {
+                ++attrEnd;
+            }
+            if (attrEnd == cur) {
+                return fail();
+            }
+            Attribute attr(std::string(cur, attrEnd), std::string());
+            cur = attrEnd;
+            while (cur != end && IsSpaceOrNewLine(*cur)) {
+                ++cur;
+            }
+            if (cur == end || *cur != '=') {
+                return fail();
+            }
+            ++cur;
+            while (cur != end && IsSpaceOrNewLine(*cur)) {
+                ++cur;
+            }
+            if (cur == end || (*cur != '"' && *cur != '\'')) {
+                return fail();
+            }
+            const char quote = *cur++;
+            const char *valueEnd = std::find(cur, end, quote);
+            if (valueEnd == end) {
+                return fail();
+            }
+            attr.second.assign(cur, valueEnd);
+            normalizeLineEnds(attr.second, true);
+            decodeEntities(attr.second);
+            mAttributes.push_back(std::move(attr));
+            cur = valueEnd + 1;
+        }
+
+        mOpen.push_back(mName);
+        mEvent = StartElement;
+        return true;
+    }
+
+    // Converts line ends to '\n', in attribute values all whitespace becomes a space.
+    static void normalizeLineEnds(std::string &text, bool attribute) {
+        if (text.find_first_of(attribute ? "\r\n\t" : "\r") == std::string::npos) {
+            return;
+        }
+        std::string out;
+        out.reserve(text.size());
+        for (size_t i = 0; i < text.size(); ++i) {
+            char c = text[i];
+            if (c == '\r') {
+                if (i + 1 < text.size() && text[i + 1] == '\n') {
+                    ++i;
+                }
+                c = '\n';
+            }
+            out += (attribute && (c == '\n' || c == '\t')) ? ' ' : c;
+        }
+        text.swap(out);
+    }
+
+    static void appendUtf8(std::string &out, unsigned long code) {
+        if (code < 0x80) {
+            out += static_cast<char>(code);
+        } else if (code < 0x800) {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | ((code >> 18) & 0x07));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    // Buffers the character data of the element just started, returns false once it is exhausted.
+    bool beginContent() {
+        if (mEvent != StartElement || mPendingEnd) {
+            return false;
+        }
+        return fill(1) && mBuffer[mPos] != '<';
+    }
+
+    // Returns the number of buffered content bytes which end on a token boundary.
+    size_t contentWindow() {
+        for (;;) {
+            const char *begin = &mBuffer[mPos];
+            const char *tag = static_cast<const char *>(::memchr(begin, '<', mEnd - mPos));
+            if (nullptr != tag) {
+                return tag - begin;
+            }
+            if (mEof) {
+                return mEnd - mPos;
+            }
+            // do not split the last token
+            size_t len = mEnd - mPos;
+            while (len > 0 && !IsSpaceOrNewLine(begin[len - 1])) {
+                --len;
+            }
+            if (len > 0) {
+                return len;
+            }
+            fill(mEnd - mPos + 1);
+        }
+    }
+
+    void skipContent() {
+        while (beginContent()) {
+            mPos += contentWindow();
+        }
+    }
+
+    IOStream *mStream;
+    size_t mBlockSize;
+    std::vector<char> mBuffer;
+    size_t mPos;
+    size_t mEnd;
+    bool mEof;
+    Event mEvent;
+    bool mPendingEnd;
+    std::string mName;
+    std::string mText;
+    std::vector<Attribute> mAttributes;
+    std::vector<std::string> mOpen;
+};
+
 /// @brief The Xml-Parser class.
 ///
 /// Use this parser if you have to import any kind of xml-format.
@@ -129,6 +723,18 @@ public:
     /// @return true, if the parsing was successful, false if not.
     bool parse(IOStream *stream);
 
+    /// @brief  Will parse an xml-file from a given stream without holding the file in memory.
+    ///
+    /// The document is built from an XmlStreamReader. For each start tag the callback is
+    /// called first with the reader positioned on the tag and the node which becomes the
+    /// parent. If it returns true, it has consumed the element including its end tag, for
+    /// instance by parsing its content straight into the destination buffers and calling
+    /// XmlStreamReader::skipElement. It may append a node for the element on its own.
+    /// @param[in] stream      The input stream.
+    /// @param[in] onElement   The callback, may be empty.
+    /// @return true, if the parsing was successful, false if not.
+    bool parse(IOStream *stream, const std::function<bool(XmlStreamReader &, TNodeType &)> &onElement);
+
     /// @brief  Will parse an xml-file from a stringstream.
     /// @param[in] str      The input istream (note: not "const" to match pugixml param)
     /// @return true, if the parsing was successful, false if not.
@@ -327,6 +933,67 @@ bool TXmlParser<TNodeType>::parse(IOStream *stream) {
     return false;
 }
 
+template <class TNodeType>
+bool TXmlParser<TNodeType>::parse(IOStream *stream, const std::function<bool(XmlStreamReader &, TNodeType &)> &onElement) {
+    if (hasRoot()) {
+        clear();
+    }
+
+    if (nullptr == stream) {
+        ASSIMP_LOG_DEBUG("Stream is nullptr.");
+        return false;
+    }
+
+    XmlStreamReader reader(stream);
+    mDoc = new pugi::xml_document();
+    if (!reader.isUtf8()) {
+        // let pugixml deal with the encoding
+        reader.readAll(mData);
+        mData.push_back('\0');
+        pugi::xml_parse_result parse_result = mDoc->load_buffer(&mData[0], mData.size(), pugi::parse_full);
+        if (parse_result.status == pugi::status_ok) {
+            return true;
+        }
+
+        ASSIMP_LOG_DEBUG("Error while parse xml.", std::string(parse_result.description()), " @ ", parse_result.offset);
+        return false;
+    }
+
+    TNodeType current = mDoc->root();
+    while (reader.next()) {
+        switch (reader.getEvent()) {
+        case XmlStreamReader::StartElement:
+            if (onElement && onElement(reader, current)) {
+                break;
+            }
+            current = current.append_child(reader.getName().c_str());
+            for (const XmlStreamReader::Attribute &attr : reader.getAttributes()) {
+                current.append_attribute(attr.first.c_str()).set_value(attr.second.c_str());
+            }
+            break;
+        case XmlStreamReader::EndElement:
+            current = current.parent();
+            break;
+        case XmlStreamReader::Text:
+            current.append_child(pugi::node_pcdata).set_value(reader.getText().c_str());
+            break;
+        case XmlStreamReader::CData:
+            current.append_child(pugi::node_cdata).set_value(reader.getText().c_str());
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (reader.getEvent() == XmlStreamReader::EndDocument) {
+        return true;
+    }
+
+    ASSIMP_LOG_DEBUG("Error while parse xml.");
+
+    return false;
+}
+
 template <class TNodeType>
 bool TXmlParser<TNodeType>::parse(std::istream &inStream) {
     if (hasRoot()) {
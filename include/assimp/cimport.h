@@ -51,6 +51,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include <assimp/importerdesc.h>
+#include <assimp/postprocess.h>
 #include <assimp/types.h>
 
 #ifdef __cplusplus
@@ -167,6 +168,25 @@ ASSIMP_API const C_STRUCT aiScene *aiImportFileExWithProperties(
         C_STRUCT aiFileIO *pFS,
         const C_STRUCT aiPropertyStore *pProps);
 
+// --------------------------------------------------------------------------------
+/** Same as #aiImportFileExWithProperties, but takes a 64 bit mask of post
+ *  processing steps.
+ *
+ * @param pFile Path and filename of the file to be imported,
+ *   expected to be a null-terminated c-string. NULL is not a valid value.
+ * @param pFlags Optional post processing steps to be executed after
+ *   a successful import, see #aiPostProcessStepMask.
+ * @param pFS aiFileIO structure, may be NULL.
+ * @param pProps #aiPropertyStore instance containing import settings, may be NULL.
+ * @return Pointer to the imported data or NULL if the import failed.
+ * @see aiImportFileExWithProperties
+ */
+ASSIMP_API const C_STRUCT aiScene *aiImportFileExWithProperties64(
+        const char *pFile,
+        aiPostProcessStepMask pFlags,
+        C_STRUCT aiFileIO *pFS,
+        const C_STRUCT aiPropertyStore *pProps);
+
 // --------------------------------------------------------------------------------
 /** Reads the given file from a given memory buffer,
  *
@@ -240,6 +260,19 @@ ASSIMP_API const C_STRUCT aiScene *aiImportFileFromMemoryWithProperties(
         const char *pHint,
         const C_STRUCT aiPropertyStore *pProps);
 
+// --------------------------------------------------------------------------------
+/** Same as #aiImportFileFromMemoryWithProperties, but takes a 64 bit mask of
+ *  post processing steps, see #aiPostProcessStepMask.
+ *
+ * @see aiImportFileFromMemoryWithProperties
+ */
+ASSIMP_API const C_STRUCT aiScene *aiImportFileFromMemoryWithProperties64(
+        const char *pBuffer,
+        unsigned int pLength,
+        aiPostProcessStepMask pFlags,
+        const char *pHint,
+        const C_STRUCT aiPropertyStore *pProps);
+
 // --------------------------------------------------------------------------------
 /** Apply post-processing to an already-imported scene.
  *
@@ -259,6 +292,18 @@ ASSIMP_API const C_STRUCT aiScene *aiApplyPostProcessing(
         const C_STRUCT aiScene *pScene,
         unsigned int pFlags);
 
+// --------------------------------------------------------------------------------
+/** Same as #aiApplyPostProcessing, but takes a 64 bit mask of post processing
+ *  steps, see #aiPostProcessStepMask.
+ *
+ * @param pScene Scene to work on.
+ * @param pFlags Post processing steps to apply.
+ * @return A pointer to the post-processed data, see #aiApplyPostProcessing.
+ */
+ASSIMP_API const C_STRUCT aiScene *aiApplyPostProcessing64(
+        const C_STRUCT aiScene *pScene,
+        aiPostProcessStepMask pFlags);
+
 // --------------------------------------------------------------------------------
 /** Get one of the predefine log streams. This is the quick'n'easy solution to
  *  access Assimp's log system. Attaching a log stream can slightly reduce Assimp's
@@ -22,6 +22,7 @@
 #endif
 
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <stdint.h>
 #include <assimp/defs.h>
@@ -60,6 +61,23 @@ constexpr double fast_atof_table[NumItems] =  {  // we write [16] here instead o
     0.000000000000001
 };
 
+// Powers of ten which are exactly representable as double, used by the exact
+// conversion path of fast_atoreal_array.
+static constexpr int FastAtofMaxExactPow10 = 22;
+
+constexpr double fast_atof_pow10_table[FastAtofMaxExactPow10 + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Integer powers of ten up to the largest one an uint64_t can hold.
+constexpr uint64_t fast_atof_pow10_table_u64[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+    10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+    100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+};
+
 // ------------------------------------------------------------------------------------
 // Convert a string in decimal format to a number
 // ------------------------------------------------------------------------------------
@@ -373,6 +391,145 @@ inline ai_real fast_atof( const char** inout) {
     return ret;
 }
 
+// ------------------------------------------------------------------------------------
+// Scans the run of decimal digits starting at in and returns its length, never
+// looking at end or beyond. value receives the number the digits represent; it is
+// only meaningful for runs of up to 19 digits.
+// ------------------------------------------------------------------------------------
+inline size_t fast_atof_scan_digits(const char* in, const char* end, uint64_t& value) {
+    const char* const begin = in;
+    value = 0;
+    for (; in != end && *in >= '0' && *in <= '9'; ++in) {
+        value = value * 10 + static_cast<uint64_t>(*in - '0');
+    }
+    return static_cast<size_t>(in - begin);
+}
+
+// ------------------------------------------------------------------------------------
+// Converts mantissa * 10^exp10 into a correctly rounded Real. This is Clinger's fast
+// path: both operands are exact doubles, so the single multiplication or division
+// rounds correctly. Returns false if the value is outside of that range.
+// ------------------------------------------------------------------------------------
+template<typename Real>
+inline bool fast_atoreal_exact(uint64_t mantissa, int exp10, bool inv, Real& out) {
+    if (mantissa > (uint64_t(1) << 53) || exp10 < -FastAtofMaxExactPow10 || exp10 > FastAtofMaxExactPow10) {
+        return false;
+    }
+
+    const double m = static_cast<double>(mantissa);
+    const double scale = fast_atof_pow10_table[exp10 < 0 ? -exp10 : exp10];
+    double d = exp10 < 0 ? m / scale : m * scale;
+
+    if (sizeof(Real) < sizeof(double)) {
+        // Rounding to double and then to float is only wrong if the double landed
+        // exactly on a float halfway point. The range above keeps d within the normal
+        // float range, so such a point has the 29 low mantissa bits set to 1000...0.
+        uint64_t bits;
+        ::memcpy(&bits, &d, sizeof(bits));
+        if ((bits & 0x1fffffffu) == 0x10000000u) {
+            // The rounding error of the double operation is exactly representable, its
+            // sign tells on which side of the halfway point the decimal value is.
+            const double error = exp10 < 0 ? -std::fma(d, scale, -m) : std::fma(m, scale, -d);
+            if (error > 0) {
+                d = std::nextafter(d, std::numeric_limits<double>::infinity());
+            } else if (error < 0) {
+                d = std::nextafter(d, 0.0);
+            }
+        }
+    }
+
+    out = static_cast<Real>(inv ? -d : d);
+    return true;
+}
+
+// ------------------------------------------------------------------------------------
+//! Parses up to count whitespace-separated real numbers from [c, end) into out.
+//!
+//! Plain decimal literals whose digits form an integer of at most 2^53 and whose
+//! decimal exponent is within +-22 (which covers nearly everything found in mesh
+//! data) are converted with correct rounding, unlike fast_atoreal_move does. All
+//! other tokens (nan, inf, a leading dot, decimal commas, longer literals) are handed
+//! to fast_atoreal_move and behave exactly as before. Parsing stops at end, at a
+//! terminating zero, or after count values. Like fast_atoreal_move the input must be
+//! terminated by a character that cannot continue a number, usually the zero
+//! terminator of the string.
+//! @param c          Start of the text.
+//! @param end        End of the text.
+//! @param out        Receives the values, must hold at least count elements.
+//! @param count      The maximum number of values to read.
+//! @param numParsed  Optional, receives the number of values written to out.
+//! @return Position behind the last parsed value.
+// ------------------------------------------------------------------------------------
+template<typename Real, typename ExceptionType = DeadlyImportError>
+inline const char* fast_atoreal_array(const char* c, const char* end, Real* out, size_t count, size_t* numParsed = nullptr) {
+    // Digits that always fit into an uint64_t
+    static constexpr size_t MaxMantissaDigits = 19;
+
+    size_t n = 0;
+    for (; n < count; ++n) {
+        while (c != end && (*c == ' ' || *c == '\t' || *c == '\n' || *c == '\r' || *c == '\f')) {
+            ++c;
+        }
+        if (c == end || *c == '\0') {
+            break;
+        }
+
+        const char* const start = c;
+        const char* p = c;
+        const bool inv = (*p == '-');
+        if (inv || *p == '+') {
+            ++p;
+        }
+
+        bool fast = false;
+        uint64_t mantissa = 0;
+        const size_t numDigits = fast_atof_scan_digits(p, end, mantissa);
+        if (numDigits != 0) {
+            p += numDigits;
+
+            size_t numFrac = 0;
+            if (p != end && *p == '.') {
+                ++p;
+                uint64_t frac = 0;
+                numFrac = fast_atof_scan_digits(p, end, frac);
+                p += numFrac;
+                if (numFrac != 0 && numDigits + numFrac <= MaxMantissaDigits) {
+                    mantissa = mantissa * fast_atof_pow10_table_u64[numFrac] + frac;
+                }
+            }
+
+            fast = numDigits + numFrac <= MaxMantissaDigits && (p == end || *p != ',');
+            int exp10 = -static_cast<int>(numFrac);
+            if (fast && p != end && (*p == 'e' || *p == 'E')) {
+                ++p;
+                const bool einv = (p != end && *p == '-');
+                if (p != end && (einv || *p == '+')) {
+                    ++p;
+                }
+                // More than four exponent digits can only mean over- or underflow
+                uint64_t e = 0;
+                const size_t numExp = fast_atof_scan_digits(p, end, e);
+                p += numExp;
+                fast = numExp != 0 && numExp <= 4;
+                exp10 += einv ? -static_cast<int>(e) : static_cast<int>(e);
+            }
+
+            fast = fast && fast_atoreal_exact(mantissa, exp10, inv, out[n]);
+        }
+
+        if (fast) {
+            c = p;
+        } else {
+            c = fast_atoreal_move<Real, ExceptionType>(start, out[n]);
+        }
+    }
+
+    if (numParsed) {
+        *numParsed = n;
+    }
+    return c;
+}
+
 } //! namespace Assimp
 
 #endif // FAST_A_TO_F_H_INCLUDED
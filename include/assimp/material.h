@@ -963,6 +963,18 @@ public:
     static void CopyPropertyList(aiMaterial *pcDest,
             const aiMaterial *pcSrc);
 
+    // ------------------------------------------------------------------------------
+    /** @brief Builds a hashed lookup index for the current property list.
+     *
+     *  Afterwards Get() resolves a (key, type, index) triple without scanning
+     *  all properties. The index is dropped by AddProperty(), RemoveProperty()
+     *  and Clear(). The importer builds it for all materials of an imported
+     *  scene if #AI_CONFIG_IMPORT_MATERIAL_PROPERTY_INDEX is set. Building it
+     *  again is required after the property list was modified directly. The
+     *  index is kept in a table inside the library, the layout of aiMaterial
+     *  is not affected. Lookups take a shared lock while any index exists. */
+    void BuildPropertyIndex();
+
 #endif
 
     /** List of all material properties loaded. */
@@ -616,6 +616,164 @@ enum aiMorphingMethod {
 #endif
 }; //! enum aiMorphingMethod
 
+// ---------------------------------------------------------------------------
+/** @brief Enumerates the storage formats of a packed vertex attribute.
+ *
+ *  Normalized formats are decoded by dividing the stored integer by its
+ *  maximum value (and clamping to -1 for the signed variants). The result
+ *  is then mapped through the aiVertexAttribute::mDecodeScale and
+ *  aiVertexAttribute::mDecodeOffset of the attribute.
+ */
+enum aiVertexFormat {
+    /** 32-bit IEEE float per component */
+    aiVertexFormat_Float32 = 0x0,
+
+    /** 16-bit IEEE half-float per component */
+    aiVertexFormat_Float16 = 0x1,
+
+    /** 16-bit unsigned normalized integer per component */
+    aiVertexFormat_Unorm16 = 0x2,
+
+    /** 16-bit signed normalized integer per component */
+    aiVertexFormat_Snorm16 = 0x3,
+
+    /** 8-bit unsigned normalized integer per component */
+    aiVertexFormat_Unorm8 = 0x4,
+
+    /** 8-bit signed normalized integer per component */
+    aiVertexFormat_Snorm8 = 0x5,
+
+/** This value is not used. It is just here to force the
+     *  compiler to map this enum to a 32 Bit integer.
+     */
+#ifndef SWIG
+    _aiVertexFormat_Force32Bit = INT_MAX
+#endif
+}; //! enum aiVertexFormat
+
+// ---------------------------------------------------------------------------
+/** @brief Enumerates the semantics of a packed vertex attribute.
+ */
+enum aiVertexAttributeType {
+    /** Vertex position, see aiMesh::mVertices */
+    aiVertexAttributeType_Position = 0x0,
+
+    /** Vertex normal, see aiMesh::mNormals. Two components in the
+     *  normalized formats, which hold an octahedral encoding. */
+    aiVertexAttributeType_Normal = 0x1,
+
+    /** Vertex tangent, see aiMesh::mTangents. The last component holds
+     *  the handedness: bitangent = handedness * cross(normal, tangent).
+     *  Three components in the normalized formats, which hold an
+     *  octahedral encoding followed by the handedness. */
+    aiVertexAttributeType_Tangent = 0x2,
+
+    /** Vertex color, see aiMesh::mColors */
+    aiVertexAttributeType_Color = 0x3,
+
+    /** Texture coordinates, see aiMesh::mTextureCoords */
+    aiVertexAttributeType_TextureCoords = 0x4,
+
+/** This value is not used. It is just here to force the
+     *  compiler to map this enum to a 32 Bit integer.
+     */
+#ifndef SWIG
+    _aiVertexAttributeType_Force32Bit = INT_MAX
+#endif
+}; //! enum aiVertexAttributeType
+
+// ---------------------------------------------------------------------------
+/** @brief Describes a single attribute inside an interleaved aiVertexStream.
+ */
+struct aiVertexAttribute {
+    /** Semantic of the attribute. */
+    enum aiVertexAttributeType mType;
+
+    /** Color set or texture coordinate channel, 0 for everything else. */
+    unsigned int mIndex;
+
+    /** Storage format of each component. */
+    enum aiVertexFormat mFormat;
+
+    /** Number of stored components. */
+    unsigned int mNumComponents;
+
+    /** Byte offset of the attribute from the start of a vertex. */
+    unsigned int mOffset;
+
+    /** Decoded component = stored component * mDecodeScale + mDecodeOffset.
+     *  Identity unless positions or texture coordinates are quantized
+     *  relative to their bounds. */
+    C_STRUCT aiVector3D mDecodeScale;
+    C_STRUCT aiVector3D mDecodeOffset;
+
+#ifdef __cplusplus
+    aiVertexAttribute() AI_NO_EXCEPT
+            : mType(aiVertexAttributeType_Position),
+              mIndex(0),
+              mFormat(aiVertexFormat_Float32),
+              mNumComponents(0),
+              mOffset(0),
+              mDecodeScale(1.0f, 1.0f, 1.0f),
+              mDecodeOffset() {
+        // empty
+    }
+#endif // __cplusplus
+};
+
+// ---------------------------------------------------------------------------
+/** @brief An interleaved, GPU-ready copy of the vertex data of a mesh.
+ *
+ *  Produced by the #aiProcess_GenVertexStreams step. Vertex i starts at
+ *  byte i * mStride of mData, every attribute starts on a 4-byte boundary
+ *  and padding bytes are zero.
+ */
+struct aiVertexStream {
+    /** Number of vertices, equal to aiMesh::mNumVertices. */
+    unsigned int mNumVertices;
+
+    /** Size of a single vertex in bytes. */
+    unsigned int mStride;
+
+    /** Number of entries in mAttributes. */
+    unsigned int mNumAttributes;
+
+    /** The attribute layout of a vertex. */
+    C_STRUCT aiVertexAttribute *mAttributes;
+
+    /** mNumVertices * mStride bytes of vertex data. */
+    unsigned char *mData;
+
+#ifdef __cplusplus
+    aiVertexStream() AI_NO_EXCEPT
+            : mNumVertices(0),
+              mStride(0),
+              mNumAttributes(0),
+              mAttributes(nullptr),
+              mData(nullptr) {
+        // empty
+    }
+
+    ~aiVertexStream() {
+        delete[] mAttributes;
+        delete[] mData;
+    }
+
+    //! @brief Look up an attribute of the stream.
+    //! @param type   The attribute semantic.
+    //! @param index  The color set or texture coordinate channel.
+    //! @return The attribute, or nullptr if the stream does not contain it.
+    const aiVertexAttribute *FindAttribute(aiVertexAttributeType type, unsigned int index = 0) const {
+        for (unsigned int i = 0; i < mNumAttributes; ++i) {
+            if (mAttributes[i].mType == type && mAttributes[i].mIndex == index) {
+                return &mAttributes[i];
+            }
+        }
+        return nullptr;
+    }
+#endif // __cplusplus
+};
+
 // ---------------------------------------------------------------------------
 /** @brief A mesh represents a geometry or model with a single material.
  *
@@ -826,6 +984,14 @@ struct aiMesh {
      */
     C_STRUCT aiString **mTextureCoordsNames;
 
+    /**
+     *  Interleaved, optionally quantized copy of the vertex data.
+     *  nullptr unless #aiProcess_GenVertexStreams was requested.
+     *  Post-processing steps applied later, which may change the vertex data,
+     *  delete the stream. Request #aiProcess_GenVertexStreams again to rebuild it.
+     */
+    C_STRUCT aiVertexStream *mVertexStream;
+
 #ifdef __cplusplus
 
     //! The default class constructor.
@@ -848,7 +1014,8 @@ struct aiMesh {
               mAnimMeshes(nullptr),
               mMethod(aiMorphingMethod_UNKNOWN),
               mAABB(),
-              mTextureCoordsNames(nullptr) {
+              mTextureCoordsNames(nullptr),
+              mVertexStream(nullptr) {
         // empty
     }
 
@@ -895,6 +1062,7 @@ struct aiMesh {
         }
 
         delete[] mFaces;
+        delete mVertexStream;
     }
 
     //! @brief Check whether the mesh contains positions. Provided no special
@@ -976,6 +1144,12 @@ struct aiMesh {
         return mBones != nullptr && mNumBones > 0;
     }
 
+    //! @brief Check whether the mesh carries an interleaved vertex stream.
+    //! @return true, if a stream is stored.
+    bool HasVertexStream() const {
+        return mVertexStream != nullptr && mVertexStream->mData != nullptr;
+    }
+
     //! @brief  Check whether the mesh contains a texture coordinate set name
     //! @param pIndex Index of the texture coordinates set
     //! @return true, if texture coordinates for the index exists.
@@ -287,6 +287,10 @@ enum aiPostProcessSteps
      * If you intend to render huge models in hardware, this step might
      * be of interest to you. The <tt>#AI_CONFIG_PP_ICL_PTCACHE_SIZE</tt>
      * importer property can be used to fine-tune the cache optimization.
+     * <tt>#AI_CONFIG_PP_ICL_ALGORITHM</tt> selects Tom Forsyth's optimizer
+     * instead, <tt>#AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD</tt> enables the
+     * overdraw reduction and <tt>#AI_CONFIG_PP_ICL_OPTIMIZE_FETCH</tt>
+     * reorders the vertices for sequential fetches.
      */
     aiProcess_ImproveCacheLocality = 0x800,
 
@@ -605,6 +609,62 @@ enum aiPostProcessSteps
     aiProcess_GenBoundingBoxes = 0x80000000
 };
 
+// ---------------------------------------------------------------------------------------
+/** @typedef aiPostProcessStepMask
+ *  @brief 64 bit combination of post processing steps.
+ *
+ *  All 32 bits of #aiPostProcessSteps are in use. The lower 32 bits of this mask are
+ *  identical to the #aiPostProcessSteps flags, the upper 32 bits hold the steps added
+ *  later on (see #aiProcessExtFlag). Pass such masks to Assimp::Importer::ReadFile64(),
+ *  Assimp::Importer::ApplyPostProcessing64(), #aiImportFileExWithProperties64() or
+ *  #aiApplyPostProcessing64(). The 32 bit entry points can only address the lower half.
+ */
+typedef uint64_t aiPostProcessStepMask;
+
+// ---------------------------------------------------------------------------------------
+/** @def aiProcessExtFlag
+ *  @brief Builds the flag of the n-th post processing step in the upper half of an
+ *  #aiPostProcessStepMask, with n in [0, 31].
+ */
+#define aiProcessExtFlag(n) (((aiPostProcessStepMask)1) << (32 + (n)))
+
+// ---------------------------------------------------------------------------------------
+/** @def aiProcess_GenerateLODs
+ *  @brief Generates simplified levels of detail for all triangle meshes.
+ *
+ *  The meshes are simplified with a quadric error edge collapse simplifier which keeps
+ *  UV and normal seams, bone weight boundaries and open borders, e.g. material borders,
+ *  in place. Every level is added as a new mesh. Each node referencing simplified meshes
+ *  receives one child node per level, named after the node with a "_LODn" suffix, whose
+ *  metadata holds #AI_LOD_METADATA_LEVEL, #AI_LOD_METADATA_RATIO and #AI_LOD_METADATA_ERROR.
+ *  The levels are configured with <tt>#AI_CONFIG_PP_LOD_RATIOS</tt>,
+ *  <tt>#AI_CONFIG_PP_LOD_MAX_ERROR</tt> and <tt>#AI_CONFIG_PP_LOD_LOCK_BORDERS</tt>.
+ *  Combine it with #aiProcess_Triangulate and #aiProcess_JoinIdenticalVertices, the step
+ *  works on indexed triangle meshes only.
+ */
+#define aiProcess_GenerateLODs aiProcessExtFlag(0)
+
+// ---------------------------------------------------------------------------------------
+/** @def aiProcess_GenVertexStreams
+ *  @brief Packs the vertex data of all meshes into interleaved, optionally quantized
+ *  vertex streams which can be uploaded to the GPU as they are.
+ *
+ *  The stream is stored in aiMesh::mVertexStream; the float arrays of the mesh are kept.
+ *  It holds the positions, normals, tangents with handedness, vertex colors and texture
+ *  coordinates of the mesh, each one in the format chosen with
+ *  <tt>#AI_CONFIG_PP_GVS_POSITION_FORMAT</tt>, <tt>#AI_CONFIG_PP_GVS_NORMAL_FORMAT</tt>,
+ *  <tt>#AI_CONFIG_PP_GVS_TANGENT_FORMAT</tt>, <tt>#AI_CONFIG_PP_GVS_COLOR_FORMAT</tt> and
+ *  <tt>#AI_CONFIG_PP_GVS_TEXCOORD_FORMAT</tt>. By default positions and texture coordinates
+ *  are stored as 16 bit values relative to their bounds, normals and tangents as 16 bit
+ *  octahedral vectors and colors as 8 bit values, which takes about a third of the memory
+ *  of the float data. Bone weights and animation meshes are not part of the stream.
+ *  The step runs after all other steps, so combine it with #aiProcess_GenBoundingBoxes to
+ *  reuse the bounding boxes for the position quantization. Steps applied later with
+ *  Assimp::Importer::ApplyPostProcessing() which may change the vertex data delete the
+ *  streams, pass this flag again to rebuild them.
+ */
+#define aiProcess_GenVertexStreams aiProcessExtFlag(1)
+
 
 // ---------------------------------------------------------------------------------------
 /** @def aiProcess_ConvertToLeftHanded
@@ -131,6 +131,18 @@ struct ASSIMP_API aiNode {
       */
     C_STRUCT aiMetadata* mMetaData;
 
+    /** The number of instances of this node's meshes. */
+    unsigned int mNumInstances;
+
+    /** Transformations of the instances of this node's meshes, relative to the node.
+      * If there are any, the meshes are placed once per entry instead of once at the
+      * node itself, e.g. for the glTF EXT_mesh_gpu_instancing extension.
+      * #aiProcess_PreTransformVertices and all exporters except glTF2 replace
+      * the instances by one child node per instance.
+      * nullptr if mNumInstances is 0.
+      */
+    C_STRUCT aiMatrix4x4* mInstanceTransforms;
+
 #ifdef __cplusplus
     /** Constructor */
     aiNode();
@@ -44,6 +44,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "Common/BaseProcess.h"
 #include <assimp/AssertHandler.h>
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
 
 using namespace Assimp;
 
@@ -80,13 +88,18 @@ public:
 
     ~TestingBaseProcess() override = default;
 
-    bool IsActive( unsigned int ) const override {
+    bool IsActive( aiPostProcessStepMask ) const override {
         return true;
     }
 
     void Execute(aiScene*) override {
 
     }
+
+    void RunParallelFor(unsigned int threads, unsigned int count, const std::function<void(unsigned int)> &func) {
+        numThreads = threads;
+        ParallelFor(count, func);
+    }
 };
 TEST_F( BaseProcessTest, constructTest ) {
     bool ok = true;
@@ -108,3 +121,60 @@ TEST_F( BaseProcessTest, executeOnSceneTest ) {
 #endif
 
 }
+
+TEST_F( BaseProcessTest, parallelForVisitsEachIndexOnceTest ) {
+    TestingBaseProcess process;
+    std::vector<int> visited(1000, 0);
+    process.RunParallelFor(4, static_cast<unsigned int>(visited.size()), [&](unsigned int i) {
+        ++visited[i];
+    });
+    for (int v : visited) {
+        EXPECT_EQ(1, v);
+    }
+}
+
+TEST_F( BaseProcessTest, parallelForRethrowsTest ) {
+    TestingBaseProcess process;
+    EXPECT_THROW(process.RunParallelFor(4, 100, [](unsigned int i) {
+        if (i == 42) {
+            throw std::runtime_error("failure");
+        }
+    }), std::runtime_error);
+}
+
+static void ExpectSameVectors(const aiVector3D *a, const aiVector3D *b, unsigned int num) {
+    ASSERT_EQ(a == nullptr, b == nullptr);
+    if (a != nullptr) {
+        EXPECT_EQ(0, ::memcmp(a, b, num * sizeof(aiVector3D)));
+    }
+}
+
+TEST_F( BaseProcessTest, parallelPostProcessingMatchesSerialTest ) {
+    static const unsigned int flags = aiProcess_CalcTangentSpace | aiProcess_GenSmoothNormals | aiProcess_Triangulate |
+            aiProcess_JoinIdenticalVertices | aiProcess_ImproveCacheLocality;
+
+    Importer serial;
+    const aiScene *expected = serial.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, expected);
+
+    Importer parallel;
+    parallel.SetPropertyInteger(AI_CONFIG_PP_NUM_THREADS, 4);
+    const aiScene *scene = parallel.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, scene);
+
+    ASSERT_EQ(expected->mNumMeshes, scene->mNumMeshes);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh *a = expected->mMeshes[i];
+        const aiMesh *b = scene->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        ExpectSameVectors(a->mVertices, b->mVertices, a->mNumVertices);
+        ExpectSameVectors(a->mNormals, b->mNormals, a->mNumVertices);
+        ExpectSameVectors(a->mTangents, b->mTangents, a->mNumVertices);
+        ExpectSameVectors(a->mBitangents, b->mBitangents, a->mNumVertices);
+        for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+            ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+            EXPECT_EQ(0, ::memcmp(a->mFaces[f].mIndices, b->mFaces[f].mIndices, a->mFaces[f].mNumIndices * sizeof(unsigned int)));
+        }
+    }
+}
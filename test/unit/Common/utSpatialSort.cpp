@@ -42,6 +42,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <assimp/SpatialSort.h>
 
+#include <algorithm>
+#include <vector>
+
 using namespace Assimp;
 
 class utSpatialSort : public ::testing::Test {
@@ -118,3 +121,83 @@ TEST_F(utSpatialSort, highlyDisplacedPositionsTest) {
     }
     delete[] positions;
 }
+
+namespace {
+
+// Compares grid and plane search results for all positions
+void ExpectGridMatchesPlaneSearch(const aiVector3D *positions, unsigned int numPositions, ai_real radius) {
+    SpatialSort planeSort(positions, numPositions, sizeof(aiVector3D));
+    SpatialSort gridSort(positions, numPositions, sizeof(aiVector3D));
+    gridSort.BuildGrid(radius);
+    ASSERT_TRUE(gridSort.HasGrid());
+    EXPECT_FALSE(planeSort.HasGrid());
+
+    std::vector<unsigned int> expected, found;
+    for (unsigned int i = 0; i < numPositions; ++i) {
+        planeSort.FindPositions(positions[i], radius, expected);
+        gridSort.FindPositions(positions[i], radius, found);
+        std::sort(expected.begin(), expected.end());
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(expected, found);
+
+        planeSort.FindIdenticalPositions(positions[i], expected);
+        gridSort.FindIdenticalPositions(positions[i], found);
+        std::sort(expected.begin(), expected.end());
+        std::sort(found.begin(), found.end());
+        EXPECT_EQ(expected, found);
+    }
+}
+
+} // namespace
+
+TEST_F(utSpatialSort, gridMatchesPlaneSearchTest) {
+    ExpectGridMatchesPlaneSearch(vecs, 100, 5.0f);
+    ExpectGridMatchesPlaneSearch(vecs, 100, 30.0f);
+
+    // Duplicates and a large offset
+    std::vector<aiVector3D> positions;
+    for (unsigned int i = 0; i < 10; ++i) {
+        for (unsigned int j = 0; j < 10; ++j) {
+            const aiVector3D pos(1000.0f + i * 0.01f, -500.0f, 200.0f + j * 0.01f);
+            positions.push_back(pos);
+            positions.push_back(pos);
+        }
+    }
+    ExpectGridMatchesPlaneSearch(positions.data(), static_cast<unsigned int>(positions.size()), 0.0101f);
+}
+
+TEST_F(utSpatialSort, gridIsPreferredForPlaneAlignedDataTest) {
+    // All positions of this grid have the same distance to the sorting plane,
+    // so the plane search has to visit all of them for every query.
+    const aiVector3D normal = aiVector3D(0.8523f, 0.34321f, 0.5736f).Normalize();
+    const aiVector3D u = (normal ^ aiVector3D(0, 0, 1)).Normalize();
+    const aiVector3D v = (normal ^ u).Normalize();
+    std::vector<aiVector3D> positions;
+    for (unsigned int i = 0; i < 40; ++i) {
+        for (unsigned int j = 0; j < 40; ++j) {
+            positions.push_back(u * static_cast<ai_real>(i) + v * static_cast<ai_real>(j));
+        }
+    }
+    const unsigned int numPositions = static_cast<unsigned int>(positions.size());
+
+    SpatialSort sSort(positions.data(), numPositions, sizeof(aiVector3D));
+    EXPECT_TRUE(sSort.IsGridPreferable(0.1f));
+    ExpectGridMatchesPlaneSearch(positions.data(), numPositions, 0.1f);
+    ExpectGridMatchesPlaneSearch(positions.data(), numPositions, 1.01f);
+
+    // Random positions are spread well along the plane normal
+    std::vector<aiVector3D> random;
+    for (unsigned int i = 0; i < 1000; ++i) {
+        random.emplace_back(static_cast<ai_real>(rand() % 1000), static_cast<ai_real>(rand() % 1000), static_cast<ai_real>(rand() % 1000));
+    }
+    SpatialSort randomSort(random.data(), static_cast<unsigned int>(random.size()), sizeof(aiVector3D));
+    EXPECT_FALSE(randomSort.IsGridPreferable(0.1f));
+}
+
+TEST_F(utSpatialSort, gridRejectsTinyCellsTest) {
+    SpatialSort sSort(vecs, 100, sizeof(aiVector3D));
+    sSort.BuildGrid(1e-9f);
+    EXPECT_FALSE(sSort.HasGrid());
+    sSort.BuildGrid(0.0f);
+    EXPECT_FALSE(sSort.HasGrid());
+}
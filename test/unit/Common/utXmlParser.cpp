@@ -40,6 +40,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/XmlParser.h>
 #include <assimp/DefaultIOStream.h>
 #include <assimp/DefaultIOSystem.h>
+#include <assimp/MemoryIOWrapper.h>
 
 using namespace Assimp;
 
@@ -84,3 +85,87 @@ TEST_F(utXmlParser, parse_xml_and_traverse_test) {
         EXPECT_FALSE(nodeName.empty());
     }
 }
+
+TEST_F(utXmlParser, stream_reader_test) {
+    static const char xml[] =
+            "<?xml version=\"1.0\"?>\n"
+            "<!-- comment -->\n"
+            "<root a=\"1\" b='x &amp; y'>\n"
+            "  <values count=\"5\">1.5 -2 3e2\n 4.25   0.125</values>\n"
+            "  <indices>0 17 -3 42</indices>\n"
+            "  <names>first second</names>\n"
+            "  <empty/>\n"
+            "  <text>a &lt; b</text>\n"
+            "</root>\n";
+    // tiny blocks so that tokens and tags are split between the reads
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(xml), sizeof(xml) - 1);
+    XmlStreamReader reader(&stream, 3);
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(XmlStreamReader::StartElement, reader.getEvent());
+    EXPECT_EQ("root", reader.getName());
+    std::string value;
+    EXPECT_TRUE(reader.getAttribute("b", value));
+    EXPECT_EQ("x & y", value);
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ("values", reader.getName());
+    ai_real values[5] = {};
+    EXPECT_EQ(5u, reader.readReals(values, 5));
+    EXPECT_FLOAT_EQ(1.5f, values[0]);
+    EXPECT_FLOAT_EQ(-2.0f, values[1]);
+    EXPECT_FLOAT_EQ(300.0f, values[2]);
+    EXPECT_FLOAT_EQ(4.25f, values[3]);
+    EXPECT_FLOAT_EQ(0.125f, values[4]);
+    EXPECT_TRUE(reader.skipElement());
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ("indices", reader.getName());
+    std::vector<size_t> indices;
+    EXPECT_EQ(4u, reader.readIndices(indices));
+    EXPECT_EQ(std::vector<size_t>({ 0, 17, 0, 42 }), indices);
+    EXPECT_TRUE(reader.skipElement());
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ("names", reader.getName());
+    std::vector<std::string> names;
+    EXPECT_EQ(2u, reader.readTokens(names, 10));
+    EXPECT_EQ("second", names[1]);
+    EXPECT_TRUE(reader.skipElement());
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ("empty", reader.getName());
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(XmlStreamReader::EndElement, reader.getEvent());
+
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ("text", reader.getName());
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(XmlStreamReader::Text, reader.getEvent());
+    EXPECT_EQ("a < b", reader.getText());
+    ASSERT_TRUE(reader.next());
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(XmlStreamReader::EndElement, reader.getEvent());
+    EXPECT_EQ("root", reader.getName());
+    EXPECT_FALSE(reader.next());
+    EXPECT_EQ(XmlStreamReader::EndDocument, reader.getEvent());
+}
+
+TEST_F(utXmlParser, parse_stream_with_callback_test) {
+    static const char xml[] = "<root><skip><deep>1 2</deep></skip><keep id=\"k\">text</keep></root>";
+    MemoryIOStream stream(reinterpret_cast<const uint8_t *>(xml), sizeof(xml) - 1);
+    XmlParser parser;
+    size_t numSkipped = 0;
+    EXPECT_TRUE(parser.parse(&stream, [&](XmlStreamReader &reader, XmlNode &) {
+        if (reader.getName() != "skip") {
+            return false;
+        }
+        ++numSkipped;
+        return reader.skipElement();
+    }));
+    EXPECT_EQ(1u, numSkipped);
+    XmlNode root = parser.getRootNode().child("root");
+    EXPECT_TRUE(root.child("skip").empty());
+    EXPECT_STREQ("text", root.child("keep").text().as_string());
+    EXPECT_STREQ("k", root.child("keep").attribute("id").as_string());
+}
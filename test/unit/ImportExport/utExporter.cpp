@@ -41,7 +41,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
 #include <assimp/ProgressHandler.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
 
 using namespace Assimp;
 
@@ -102,4 +106,54 @@ TEST_F(ExporterTest, ExporterIdTest) {
     EXPECT_EQ(nullptr, desc) << "More exporters than claimed";
 }
 
+namespace {
+    // What InspectingExport saw of the first mesh
+    struct ExportedMesh {
+        const aiVector3D *mVertices = nullptr;
+        const aiVector3D *mTextureCoords = nullptr;
+        aiVector3D mFirstTexCoord;
+        std::vector<unsigned int> mFirstFace;
+    } gExportedMesh;
+
+    void InspectingExport(const char *, IOSystem *, const aiScene *pScene, const ExportProperties *) {
+        const aiMesh *mesh = pScene->mMeshes[0];
+        const aiFace &face = mesh->mFaces[0];
+        gExportedMesh.mVertices = mesh->mVertices;
+        gExportedMesh.mTextureCoords = mesh->mTextureCoords[0];
+        gExportedMesh.mFirstTexCoord = mesh->mTextureCoords[0][0];
+        gExportedMesh.mFirstFace.assign(face.mIndices, face.mIndices + face.mNumIndices);
+    }
+}
+
+TEST_F(ExporterTest, CopyOnWriteTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/X/test.x", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    const aiMesh *mesh = scene->mMeshes[0];
+    ASSERT_TRUE(mesh->HasTextureCoords(0));
+    const aiVector3D texCoord = mesh->mTextureCoords[0][0];
+    const std::vector<unsigned int> face(mesh->mFaces[0].mIndices, mesh->mFaces[0].mIndices + mesh->mFaces[0].mNumIndices);
+    ASSERT_GT(face.size(), 2u);
+
+    Exporter exporter;
+    exporter.RegisterExporter(Exporter::ExportFormatEntry("inspect", "Inspecting exporter", "none", &InspectingExport));
+    ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_COPY_ON_WRITE, true);
+    EXPECT_EQ(AI_SUCCESS, exporter.Export(scene, "inspect", "unused", aiProcess_FlipUVs | aiProcess_FlipWindingOrder, &properties));
+
+    // the exporter sees the processed data ...
+    EXPECT_FLOAT_EQ(1.0f - texCoord.y, gExportedMesh.mFirstTexCoord.y);
+    EXPECT_EQ(std::vector<unsigned int>(face.rbegin(), face.rend()), gExportedMesh.mFirstFace);
+    EXPECT_NE(mesh->mTextureCoords[0], gExportedMesh.mTextureCoords);
+
+    // ... untouched arrays are shared and the source scene is left alone
+    EXPECT_EQ(mesh->mVertices, gExportedMesh.mVertices);
+    EXPECT_EQ(texCoord, mesh->mTextureCoords[0][0]);
+    EXPECT_EQ(face, std::vector<unsigned int>(mesh->mFaces[0].mIndices, mesh->mFaces[0].mIndices + mesh->mFaces[0].mNumIndices));
+
+    // without the property the exporter works on a full copy
+    EXPECT_EQ(AI_SUCCESS, exporter.Export(scene, "inspect", "unused", aiProcess_FlipUVs));
+    EXPECT_NE(mesh->mVertices, gExportedMesh.mVertices);
+}
+
 #endif
@@ -44,6 +44,11 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Common/Importer.h"
 #include "TestIOSystem.h"
 
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
 using namespace ::Assimp;
 
 class BatchLoaderTest : public ::testing::Test {
@@ -79,3 +84,45 @@ TEST_F( BatchLoaderTest, validateAccessTest ) {
     BatchLoader loader2( m_io, true );
     EXPECT_TRUE( loader2.getValidation() );
 }
+
+TEST_F( BatchLoaderTest, numThreadsAccessTest ) {
+    BatchLoader loader( m_io );
+    EXPECT_EQ( 1u, loader.getNumThreads() );
+    loader.setNumThreads( 3 );
+    EXPECT_EQ( 3u, loader.getNumThreads() );
+}
+
+TEST_F( BatchLoaderTest, loadAllThreadedTest ) {
+    static const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/OBJ/box.obj",
+        ASSIMP_TEST_MODELS_DIR "/PLY/cube.ply",
+        ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl",
+        ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj"
+    };
+    const size_t numFiles = sizeof( files ) / sizeof( files[ 0 ] );
+
+    DefaultIOSystem io;
+    BatchLoader loader( &io, true );
+    loader.setNumThreads( 4 );
+
+    std::vector<unsigned int> ids;
+    for ( size_t i = 0; i < numFiles; ++i ) {
+        ids.push_back( loader.AddLoadRequest( files[ i ] ) );
+    }
+    loader.LoadAll();
+
+    for ( size_t i = 0; i < numFiles; ++i ) {
+        Importer importer;
+        const aiScene *expected = importer.ReadFile( files[ i ], aiProcess_ValidateDataStructure );
+        ASSERT_NE( nullptr, expected );
+
+        aiScene *scene = loader.GetImport( ids[ i ] );
+        ASSERT_NE( nullptr, scene );
+        EXPECT_EQ( expected->mNumMeshes, scene->mNumMeshes );
+        EXPECT_EQ( expected->mNumMaterials, scene->mNumMaterials );
+        for ( unsigned int m = 0; m < std::min( expected->mNumMeshes, scene->mNumMeshes ); ++m ) {
+            EXPECT_EQ( expected->mMeshes[ m ]->mNumVertices, scene->mMeshes[ m ]->mNumVertices );
+        }
+        delete scene;
+    }
+}
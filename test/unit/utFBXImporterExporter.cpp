@@ -48,6 +48,12 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/scene.h>
 #include <assimp/types.h>
 #include <assimp/Importer.hpp>
+#include <assimp/DefaultLogger.hpp>
+#include <assimp/LogStream.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
 
 using namespace Assimp;
 
@@ -461,3 +467,135 @@ TEST_F(utFBXImporterExporter, importSkeletonTest) {
     ASSERT_NE(nullptr, scene);
     ASSERT_TRUE(scene->mRootNode);
 }
+
+TEST_F(utFBXImporterExporter, importWithParallelArrayInflation) {
+    Assimp::Importer serialImporter;
+    const aiScene *serial = serialImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, serial);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+    const aiScene *parallel = parallelImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, parallel);
+
+    ASSERT_EQ(serial->mNumMeshes, parallel->mNumMeshes);
+    for (unsigned int i = 0; i < serial->mNumMeshes; ++i) {
+        const aiMesh *a = serial->mMeshes[i], *b = parallel->mMeshes[i];
+        ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+        ASSERT_EQ(a->mNumBones, b->mNumBones);
+        for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+            EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+        }
+    }
+    ASSERT_EQ(serial->mNumAnimations, parallel->mNumAnimations);
+    for (unsigned int i = 0; i < serial->mNumAnimations; ++i) {
+        EXPECT_EQ(serial->mAnimations[i]->mNumChannels, parallel->mAnimations[i]->mNumChannels);
+    }
+}
+
+TEST_F(utFBXImporterExporter, importWithParallelArrayInflationReadsEveryArray) {
+    struct LogObserver : Assimp::LogStream {
+        bool m_inflated = false;
+        bool m_released = false;
+        void write(const char *message) override {
+            m_inflated = m_inflated || (std::strstr(message, "Inflated ") != nullptr && std::strstr(message, "binary FBX data arrays") != nullptr);
+            m_released = m_released || std::strstr(message, "which were never read") != nullptr;
+        }
+    };
+    LogObserver logObserver;
+
+    Assimp::Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+    DefaultLogger::get()->attachStream(&logObserver, Logger::Debugging);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx", aiProcess_ValidateDataStructure);
+    DefaultLogger::get()->detachStream(&logObserver, Logger::Debugging);
+    ASSERT_NE(nullptr, scene);
+
+    // only the arrays of converted objects are inflated up front, so none is left unread
+    EXPECT_TRUE(logObserver.m_inflated);
+    EXPECT_FALSE(logObserver.m_released);
+}
+
+TEST_F(utFBXImporterExporter, importWithParallelMeshConversion) {
+    const char *files[] = {
+        ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx",
+        ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx",
+        ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx",
+        ASSIMP_TEST_MODELS_DIR "/FBX/cubes_with_names.fbx"
+    };
+    for (const char *file : files) {
+        Assimp::Importer serialImporter;
+        const aiScene *serial = serialImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, serial);
+
+        Assimp::Importer parallelImporter;
+        parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+        const aiScene *parallel = parallelImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, parallel);
+
+        ASSERT_EQ(serial->mNumMeshes, parallel->mNumMeshes);
+        ASSERT_EQ(serial->mNumMaterials, parallel->mNumMaterials);
+        for (unsigned int i = 0; i < serial->mNumMeshes; ++i) {
+            const aiMesh *a = serial->mMeshes[i], *b = parallel->mMeshes[i];
+            EXPECT_EQ(a->mName, b->mName);
+            EXPECT_EQ(a->mMaterialIndex, b->mMaterialIndex);
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            ASSERT_EQ(a->mNumBones, b->mNumBones);
+            for (unsigned int v = 0; v < a->mNumVertices; ++v) {
+                EXPECT_EQ(a->mVertices[v], b->mVertices[v]);
+            }
+            for (unsigned int f = 0; f < a->mNumFaces; ++f) {
+                ASSERT_EQ(a->mFaces[f].mNumIndices, b->mFaces[f].mNumIndices);
+            }
+            for (unsigned int n = 0; n < a->mNumBones; ++n) {
+                EXPECT_EQ(a->mBones[n]->mName, b->mBones[n]->mName);
+                EXPECT_EQ(a->mBones[n]->mNumWeights, b->mBones[n]->mNumWeights);
+            }
+        }
+    }
+}
+
+TEST_F(utFBXImporterExporter, importSkeletonWithParallelMeshConversion) {
+    Assimp::Importer serialImporter;
+    serialImporter.SetPropertyBool(AI_CONFIG_FBX_USE_SKELETON_BONE_CONTAINER, true);
+    const aiScene *serial = serialImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx", 0);
+    ASSERT_NE(nullptr, serial);
+
+    Assimp::Importer parallelImporter;
+    parallelImporter.SetPropertyBool(AI_CONFIG_FBX_USE_SKELETON_BONE_CONTAINER, true);
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+    const aiScene *parallel = parallelImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/huesitos.fbx", 0);
+    ASSERT_NE(nullptr, parallel);
+
+    EXPECT_LT(0u, serial->mNumSkeletons);
+    ASSERT_EQ(serial->mNumSkeletons, parallel->mNumSkeletons);
+    for (unsigned int i = 0; i < serial->mNumSkeletons; ++i) {
+        EXPECT_EQ(serial->mSkeletons[i]->mNumBones, parallel->mSkeletons[i]->mNumBones);
+    }
+}
+
+TEST_F(utFBXImporterExporter, importAsciiFromMemory) {
+    Assimp::Importer fileImporter;
+    const aiScene *fromFile = fileImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/FBX/cubes_with_names.fbx", 0);
+    ASSERT_NE(nullptr, fromFile);
+
+    std::ifstream in(ASSIMP_TEST_MODELS_DIR "/FBX/cubes_with_names.fbx", std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    ASSERT_FALSE(contents.empty());
+
+    // the file ends in a newline and is tokenized in place, a trailing
+    // comment without newline forces the terminated copy
+    const std::string variants[] = { contents, contents + "; trailing comment" };
+    for (const std::string &buffer : variants) {
+        Assimp::Importer memoryImporter;
+        const aiScene *fromMemory = memoryImporter.ReadFileFromMemory(buffer.data(), buffer.size(), 0, "fbx");
+        ASSERT_NE(nullptr, fromMemory);
+        ASSERT_EQ(fromFile->mNumMeshes, fromMemory->mNumMeshes);
+        for (unsigned int i = 0; i < fromFile->mNumMeshes; ++i) {
+            EXPECT_EQ(fromFile->mMeshes[i]->mNumVertices, fromMemory->mMeshes[i]->mNumVertices);
+            EXPECT_EQ(fromFile->mMeshes[i]->mNumFaces, fromMemory->mMeshes[i]->mNumFaces);
+        }
+        EXPECT_EQ(fromFile->mRootNode->mNumChildren, fromMemory->mRootNode->mNumChildren);
+    }
+}
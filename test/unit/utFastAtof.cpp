@@ -41,6 +41,13 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UnitTestPCH.h"
 
 #include <assimp/fast_atof.h>
+#include <assimp/ParsingUtils.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
 
 namespace {
 
@@ -187,3 +194,152 @@ TEST_F(FastAtofTest, FastAtof)
 {
     RunTest<ai_real>(FastAtofWrapper());
 }
+
+struct FastAtofArrayWrapper {
+    ai_real operator()(const char* str) {
+        ai_real value = 0;
+        Assimp::fast_atoreal_array<ai_real>(str, str + strlen(str), &value, 1);
+        return value;
+    }
+};
+
+TEST_F(FastAtofTest, FastAtofArray)
+{
+    RunTest<ai_real>(FastAtofArrayWrapper());
+}
+
+TEST_F(FastAtofTest, FastAtofArrayMultipleValues)
+{
+    const std::string text = "  1.5 -2\t3e2\r\n.25 0,5 nan  4. 1234567890.1234567890123 +7";
+    std::vector<float> values(16, -1.f);
+    size_t numParsed = 0;
+    const char *end = Assimp::fast_atoreal_array<float>(text.c_str(), text.c_str() + text.size(), values.data(), values.size(), &numParsed);
+    EXPECT_EQ(text.c_str() + text.size(), end);
+    ASSERT_EQ(9u, numParsed);
+    EXPECT_EQ(1.5f, values[0]);
+    EXPECT_EQ(-2.f, values[1]);
+    EXPECT_EQ(300.f, values[2]);
+    EXPECT_EQ(0.25f, values[3]);
+    EXPECT_EQ(0.5f, values[4]);
+    EXPECT_TRUE(IsNan(values[5]));
+    EXPECT_EQ(4.f, values[6]);
+    EXPECT_NEAR(1234567890.1234567890123, values[7], 1e3);
+    EXPECT_EQ(7.f, values[8]);
+    EXPECT_EQ(-1.f, values[9]);
+
+    // Stops after count values
+    end = Assimp::fast_atoreal_array<float>(text.c_str(), text.c_str() + text.size(), values.data(), 2, &numParsed);
+    EXPECT_EQ(2u, numParsed);
+    EXPECT_EQ('\t', *end);
+
+    const std::string invalid = "1 2 x";
+    EXPECT_THROW(Assimp::fast_atoreal_array<float>(invalid.c_str(), invalid.c_str() + invalid.size(), values.data(), 3), DeadlyImportError);
+}
+
+namespace {
+
+template <typename Real>
+Real ReferenceAtof(const char *str);
+
+template <>
+float ReferenceAtof<float>(const char *str) {
+    return strtof(str, nullptr);
+}
+
+template <>
+double ReferenceAtof<double>(const char *str) {
+    return strtod(str, nullptr);
+}
+
+template <typename Real>
+void ExpectCorrectlyRounded() {
+    // Up to 15 significant digits and small exponents take the exact conversion path
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(1.0, 1000.0);
+    std::string text;
+    std::vector<std::string> literals;
+    char buffer[64];
+    for (unsigned int i = 0; i < 20000; ++i) {
+        const int precision = static_cast<int>(rng() % 15);
+        const double value = (rng() % 2) ? dist(rng) : -dist(rng);
+        switch (i % 3) {
+        case 0:
+            snprintf(buffer, sizeof(buffer), "%.*f", precision, value);
+            break;
+        case 1:
+            snprintf(buffer, sizeof(buffer), "%.*e", precision, value * std::pow(10.0, static_cast<int>(rng() % 12) - 6));
+            break;
+        default:
+            snprintf(buffer, sizeof(buffer), "%.*g", precision + 1, value);
+            break;
+        }
+        literals.emplace_back(buffer);
+        text += buffer;
+        text += (i % 8) ? ' ' : '\n';
+    }
+    // Values which round to a float halfway point
+    for (const char *literal : { "3.4e10", "16777217", "16777219", "0.1", "-0" }) {
+        literals.emplace_back(literal);
+        text += literal;
+        text += ' ';
+    }
+
+    std::vector<Real> values(literals.size());
+    size_t numParsed = 0;
+    Assimp::fast_atoreal_array<Real>(text.c_str(), text.c_str() + text.size(), values.data(), values.size(), &numParsed);
+    ASSERT_EQ(literals.size(), numParsed);
+    for (size_t i = 0; i < literals.size(); ++i) {
+        EXPECT_EQ(ReferenceAtof<Real>(literals[i].c_str()), values[i]) << literals[i];
+    }
+}
+
+} // Namespace
+
+TEST_F(FastAtofTest, FastAtofArrayIsCorrectlyRounded)
+{
+    ExpectCorrectlyRounded<float>();
+    ExpectCorrectlyRounded<double>();
+}
+
+TEST_F(FastAtofTest, FastAtofArrayBenchmark)
+{
+    // Compares the bulk parser with the scalar loop the importers used so far,
+    // on the kind of data found in a Collada <float_array>.
+    for (const char *format : { "%.6f ", "%.8e " }) {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> dist(-100.f, 100.f);
+        std::string text;
+        char buffer[32];
+        const size_t count = 300000;
+        for (size_t i = 0; i < count; ++i) {
+            snprintf(buffer, sizeof(buffer), format, dist(rng));
+            text += buffer;
+        }
+        const char *begin = text.c_str();
+        const char *end = begin + text.size();
+        std::vector<ai_real> scalar(count), bulk(count);
+
+        const auto t0 = std::chrono::steady_clock::now();
+        const char *cur = begin;
+        for (size_t i = 0; i < count; ++i) {
+            cur = Assimp::fast_atoreal_move<ai_real>(cur, scalar[i]);
+            while (cur != end && Assimp::IsSpaceOrNewLine(*cur)) {
+                ++cur;
+            }
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+        size_t numParsed = 0;
+        Assimp::fast_atoreal_array<ai_real>(begin, end, bulk.data(), count, &numParsed);
+        const auto t2 = std::chrono::steady_clock::now();
+
+        ASSERT_EQ(count, numParsed);
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_NEAR(scalar[i], bulk[i], 1e-4f);
+        }
+
+        const double scalarMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        const double bulkMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+        std::cout << "[   INFO   ] " << count << " values formatted as \"" << format << "\": fast_atoreal_move "
+                  << scalarMs << " ms, fast_atoreal_array " << bulkMs << " ms" << std::endl;
+    }
+}
@@ -0,0 +1,247 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/GenLODsProcess.h"
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include <algorithm>
+
+using namespace Assimp;
+
+class utGenLODsProcess : public ::testing::Test {
+public:
+    void SetUp() override {
+        // a flat grid whose middle column is a UV seam: the vertices there exist twice
+        mMesh = new aiMesh();
+        mMesh->mName.Set("grid");
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        std::vector<aiVector3D> positions, uvs;
+        std::vector<unsigned int> grid[2];
+        for (unsigned int side = 0; side < 2; ++side) {
+            grid[side].resize((Size + 1) * (Size + 1), ~0u);
+            for (unsigned int y = 0; y <= Size; ++y) {
+                for (unsigned int x = side ? Size / 2 : 0; x <= (side ? Size : Size / 2); ++x) {
+                    grid[side][y * (Size + 1) + x] = static_cast<unsigned int>(positions.size());
+                    positions.emplace_back(ai_real(x), ai_real(y), ai_real(0));
+                    uvs.emplace_back(ai_real(x) + side, ai_real(y), ai_real(0));
+                }
+            }
+        }
+        mMesh->mNumVertices = static_cast<unsigned int>(positions.size());
+        mMesh->mVertices = new aiVector3D[mMesh->mNumVertices];
+        mMesh->mTextureCoords[0] = new aiVector3D[mMesh->mNumVertices];
+        mMesh->mNumUVComponents[0] = 2;
+        std::copy(positions.begin(), positions.end(), mMesh->mVertices);
+        std::copy(uvs.begin(), uvs.end(), mMesh->mTextureCoords[0]);
+
+        std::vector<unsigned int> indices;
+        for (unsigned int y = 0; y < Size; ++y) {
+            for (unsigned int x = 0; x < Size; ++x) {
+                const std::vector<unsigned int> &g = grid[x < Size / 2 ? 0 : 1];
+                const unsigned int a = g[y * (Size + 1) + x], b = g[y * (Size + 1) + x + 1];
+                const unsigned int c = g[(y + 1) * (Size + 1) + x], d = g[(y + 1) * (Size + 1) + x + 1];
+                indices.insert(indices.end(), { a, b, d, a, d, c });
+            }
+        }
+        mMesh->mNumFaces = static_cast<unsigned int>(indices.size() / 3);
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        for (unsigned int i = 0; i < mMesh->mNumFaces; ++i) {
+            aiFace &face = mMesh->mFaces[i];
+            face.mIndices = new unsigned int[face.mNumIndices = 3];
+            std::copy(indices.begin() + i * 3, indices.begin() + i * 3 + 3, face.mIndices);
+        }
+
+        // the upper half of the grid is skinned to a second bone
+        mMesh->mNumBones = 2;
+        mMesh->mBones = new aiBone *[2];
+        std::vector<aiVertexWeight> weights[2];
+        for (unsigned int i = 0; i < mMesh->mNumVertices; ++i) {
+            weights[positions[i].y < Size / 2 ? 0 : 1].emplace_back(i, 1.f);
+        }
+        for (unsigned int b = 0; b < 2; ++b) {
+            aiBone *bone = mMesh->mBones[b] = new aiBone();
+            bone->mName.Set(b ? "upper" : "lower");
+            bone->mNumWeights = static_cast<unsigned int>(weights[b].size());
+            bone->mWeights = new aiVertexWeight[bone->mNumWeights];
+            std::copy(weights[b].begin(), weights[b].end(), bone->mWeights);
+        }
+
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh;
+        mScene->mRootNode = new aiNode("root");
+        mScene->mRootNode->mNumMeshes = 1;
+        mScene->mRootNode->mMeshes = new unsigned int[1];
+        mScene->mRootNode->mMeshes[0] = 0;
+    }
+
+    void TearDown() override {
+        delete mScene;
+    }
+
+protected:
+    static const unsigned int Size = 16;
+    aiScene *mScene = nullptr;
+    aiMesh *mMesh = nullptr;
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utGenLODsProcess, generateLODsTest) {
+    Importer importer;
+    importer.SetPropertyString(AI_CONFIG_PP_LOD_RATIOS, "0.25 0.5");
+    GenLODsProcess process;
+    EXPECT_TRUE(process.IsActive(aiProcess_GenerateLODs));
+    process.SetupProperties(&importer);
+    process.Execute(mScene);
+
+    ASSERT_EQ(3u, mScene->mNumMeshes);
+    ASSERT_EQ(2u, mScene->mRootNode->mNumChildren);
+    unsigned int lastFaces = mMesh->mNumFaces;
+    for (unsigned int l = 0; l < 2; ++l) {
+        const aiNode *node = mScene->mRootNode->mChildren[l];
+        EXPECT_EQ(aiString(l ? "root_LOD2" : "root_LOD1"), node->mName);
+        ASSERT_EQ(1u, node->mNumMeshes);
+        EXPECT_EQ(l + 1, node->mMeshes[0]);
+
+        int32_t level = 0;
+        float ratio = 0.f, error = -1.f;
+        ASSERT_NE(nullptr, node->mMetaData);
+        EXPECT_TRUE(node->mMetaData->Get(AI_LOD_METADATA_LEVEL, level));
+        EXPECT_TRUE(node->mMetaData->Get(AI_LOD_METADATA_RATIO, ratio));
+        EXPECT_TRUE(node->mMetaData->Get(AI_LOD_METADATA_ERROR, error));
+        EXPECT_EQ(int32_t(l + 1), level);
+        EXPECT_FLOAT_EQ(l ? 0.25f : 0.5f, ratio);
+        // the grid is flat, so collapses inside it are free
+        EXPECT_NEAR(0.f, error, 1e-5f);
+
+        const aiMesh *lod = mScene->mMeshes[l + 1];
+        EXPECT_LT(lod->mNumFaces, lastFaces);
+        lastFaces = lod->mNumFaces;
+        ASSERT_NE(nullptr, lod->mTextureCoords[0]);
+        EXPECT_EQ(2u, lod->mNumBones);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utGenLODsProcess, constraintsTest) {
+    Importer importer;
+    importer.SetPropertyString(AI_CONFIG_PP_LOD_RATIOS, "0.1");
+    GenLODsProcess process;
+    process.SetupProperties(&importer);
+    process.Execute(mScene);
+    ASSERT_EQ(2u, mScene->mNumMeshes);
+    const aiMesh *lod = mScene->mMeshes[1];
+
+    // vertices are only removed, never moved or mixed up
+    for (unsigned int i = 0; i < lod->mNumVertices; ++i) {
+        const aiVector3D &p = lod->mVertices[i];
+        const ai_real side = lod->mTextureCoords[0][i].x - p.x;
+        EXPECT_TRUE(side == 0 || side == 1);
+        EXPECT_TRUE(side == 0 ? p.x <= Size / 2 : p.x >= Size / 2);
+    }
+
+    // the borders and the seam keep all their vertices
+    const auto contains = [lod](const aiVector3D &p, ai_real u) {
+        for (unsigned int i = 0; i < lod->mNumVertices; ++i) {
+            if (lod->mVertices[i] == p && lod->mTextureCoords[0][i].x == u) {
+                return true;
+            }
+        }
+        return false;
+    };
+    for (unsigned int i = 0; i <= Size; ++i) {
+        const ai_real t = ai_real(i);
+        EXPECT_TRUE(contains(aiVector3D(t, 0, 0), t < Size / 2 ? t : t + 1));
+        EXPECT_TRUE(contains(aiVector3D(0, t, 0), 0));
+        EXPECT_TRUE(contains(aiVector3D(Size, t, 0), Size + 1));
+        EXPECT_TRUE(contains(aiVector3D(Size / 2, t, 0), Size / 2));
+        EXPECT_TRUE(contains(aiVector3D(Size / 2, t, 0), Size / 2 + 1));
+    }
+
+    // no face spans both bones except along the rows next to the bone boundary
+    const aiBone *lower = lod->mBones[0];
+    std::vector<bool> isLower(lod->mNumVertices, false);
+    for (unsigned int w = 0; w < lower->mNumWeights; ++w) {
+        isLower[lower->mWeights[w].mVertexId] = true;
+    }
+    for (unsigned int i = 0; i < lod->mNumVertices; ++i) {
+        const ai_real y = lod->mVertices[i].y;
+        EXPECT_EQ(y < Size / 2, isLower[i]);
+    }
+    for (unsigned int f = 0; f < lod->mNumFaces; ++f) {
+        ai_real lowest = Size, highest = 0;
+        for (unsigned int k = 0; k < 3; ++k) {
+            lowest = std::min(lowest, lod->mVertices[lod->mFaces[f].mIndices[k]].y);
+            highest = std::max(highest, lod->mVertices[lod->mFaces[f].mIndices[k]].y);
+        }
+        if (lowest < Size / 2 && highest >= Size / 2) {
+            EXPECT_EQ(ai_real(Size / 2 - 1), lowest);
+            EXPECT_EQ(ai_real(Size / 2), highest);
+        }
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utGenLODsProcess, importWithLODsTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    const unsigned int numMeshes = scene->mNumMeshes;
+    unsigned int numFaces = 0;
+    for (unsigned int i = 0; i < numMeshes; ++i) {
+        numFaces += scene->mMeshes[i]->mNumFaces;
+    }
+
+    scene = importer.ApplyPostProcessing64(aiProcess_GenerateLODs | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_GT(scene->mNumMeshes, numMeshes);
+    unsigned int numLODFaces = 0;
+    for (unsigned int i = numMeshes; i < scene->mNumMeshes; ++i) {
+        numLODFaces += scene->mMeshes[i]->mNumFaces;
+    }
+    // two levels by default
+    EXPECT_LT(numLODFaces, numFaces * 3 / 2);
+}
@@ -0,0 +1,345 @@
+/*
+---------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+---------------------------------------------------------------------------
+*/
+#include "UnitTestPCH.h"
+
+#include "PostProcessing/GenVertexStreamsProcess.h"
+#include <assimp/cexport.h>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <assimp/Exporter.hpp>
+#include <assimp/Importer.hpp>
+
+#include <cmath>
+#include <cstring>
+
+using namespace Assimp;
+
+class utGenVertexStreamsProcess : public ::testing::Test {
+public:
+    void SetUp() override {
+        mMesh = new aiMesh();
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mMesh->mNumVertices = NumVertices;
+        mMesh->mVertices = new aiVector3D[NumVertices];
+        mMesh->mNormals = new aiVector3D[NumVertices];
+        mMesh->mTangents = new aiVector3D[NumVertices];
+        mMesh->mBitangents = new aiVector3D[NumVertices];
+        mMesh->mColors[0] = new aiColor4D[NumVertices];
+        mMesh->mTextureCoords[0] = new aiVector3D[NumVertices];
+        mMesh->mNumUVComponents[0] = 2;
+        for (unsigned int i = 0; i < NumVertices; ++i) {
+            const float a = 0.37f * i, b = 0.91f * i;
+            mMesh->mVertices[i] = aiVector3D(-3.0f + 0.5f * i, std::sin(a) * 10.0f, 0.25f * (i % 5));
+            aiVector3D n(std::cos(a) * std::sin(b), std::sin(a) * std::sin(b), std::cos(b));
+            mMesh->mNormals[i] = n.Normalize();
+            aiVector3D t = (std::fabs(n.x) < 0.9f ? aiVector3D(1, 0, 0) : aiVector3D(0, 1, 0)) ^ n;
+            mMesh->mTangents[i] = t.Normalize();
+            mMesh->mBitangents[i] = (n ^ t) * (i % 2 ? -1.0f : 1.0f);
+            mMesh->mColors[0][i] = aiColor4D(0.1f * (i % 11), 1.0f - 0.05f * i, 0.5f, i % 3 ? 1.0f : 0.25f);
+            mMesh->mTextureCoords[0][i] = aiVector3D(0.125f * i, 2.0f - 0.3f * i, 0.0f);
+        }
+        mMesh->mNumFaces = NumVertices / 3;
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        for (unsigned int i = 0; i < mMesh->mNumFaces; ++i) {
+            aiFace &face = mMesh->mFaces[i];
+            face.mIndices = new unsigned int[face.mNumIndices = 3];
+            face.mIndices[0] = i * 3;
+            face.mIndices[1] = i * 3 + 1;
+            face.mIndices[2] = i * 3 + 2;
+        }
+    }
+
+    void TearDown() override {
+        delete mMesh;
+    }
+
+protected:
+    // Decodes component c of attribute attr of vertex i, without the decode transform.
+    float ReadComponent(const aiVertexAttribute &attr, unsigned int i, unsigned int c) const {
+        const aiVertexStream *stream = mMesh->mVertexStream;
+        const unsigned char *src = stream->mData + i * stream->mStride + attr.mOffset;
+        switch (attr.mFormat) {
+        case aiVertexFormat_Float32: {
+            float f;
+            memcpy(&f, src + c * 4, 4);
+            return f;
+        }
+        case aiVertexFormat_Float16: {
+            uint16_t h;
+            memcpy(&h, src + c * 2, 2);
+            const int exponent = (h >> 10) & 0x1f;
+            const float mantissa = static_cast<float>(h & 0x3ff);
+            const float value = exponent ? std::ldexp(1024.0f + mantissa, exponent - 25) : std::ldexp(mantissa, -24);
+            return (h & 0x8000) ? -value : value;
+        }
+        case aiVertexFormat_Unorm16: {
+            uint16_t u;
+            memcpy(&u, src + c * 2, 2);
+            return u / 65535.0f;
+        }
+        case aiVertexFormat_Snorm16: {
+            int16_t s;
+            memcpy(&s, src + c * 2, 2);
+            return std::max(s / 32767.0f, -1.0f);
+        }
+        case aiVertexFormat_Unorm8:
+            return src[c] / 255.0f;
+        case aiVertexFormat_Snorm8:
+            return std::max(static_cast<int8_t>(src[c]) / 127.0f, -1.0f);
+        default:
+            return 0.0f;
+        }
+    }
+
+    aiVector3D ReadVector(const aiVertexAttribute &attr, unsigned int i) const {
+        aiVector3D v;
+        for (unsigned int c = 0; c < attr.mNumComponents && c < 3; ++c) {
+            v[c] = ReadComponent(attr, i, c) * attr.mDecodeScale[c] + attr.mDecodeOffset[c];
+        }
+        return v;
+    }
+
+    aiVector3D ReadOctahedral(const aiVertexAttribute &attr, unsigned int i) const {
+        float x = ReadComponent(attr, i, 0), y = ReadComponent(attr, i, 1);
+        const float z = 1.0f - std::fabs(x) - std::fabs(y);
+        if (z < 0.0f) {
+            const float fx = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            y = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = fx;
+        }
+        return aiVector3D(x, y, z).Normalize();
+    }
+
+    static const unsigned int NumVertices = 24;
+    aiMesh *mMesh = nullptr;
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utGenVertexStreamsProcess, defaultFormatsTest) {
+    Importer importer;
+    GenVertexStreamsProcess process;
+    EXPECT_TRUE(process.IsActive(aiProcess_GenVertexStreams));
+    EXPECT_FALSE(process.IsActive(aiProcess_GenBoundingBoxes));
+    process.SetupProperties(&importer);
+    ASSERT_TRUE(process.ProcessMesh(mMesh));
+    ASSERT_TRUE(mMesh->HasVertexStream());
+
+    // 8 bytes position, 4 normal, 8 tangent, 4 color and 4 texture coordinates
+    const aiVertexStream *stream = mMesh->mVertexStream;
+    EXPECT_EQ(mMesh->mNumVertices, stream->mNumVertices);
+    EXPECT_EQ(28u, stream->mStride);
+    ASSERT_EQ(5u, stream->mNumAttributes);
+
+    const aiVertexAttribute *position = stream->FindAttribute(aiVertexAttributeType_Position);
+    ASSERT_NE(nullptr, position);
+    EXPECT_EQ(aiVertexFormat_Unorm16, position->mFormat);
+    EXPECT_EQ(0u, position->mOffset);
+    for (unsigned int i = 0; i < NumVertices; ++i) {
+        const aiVector3D p = ReadVector(*position, i);
+        EXPECT_NEAR(mMesh->mVertices[i].x, p.x, 1e-3);
+        EXPECT_NEAR(mMesh->mVertices[i].y, p.y, 1e-3);
+        EXPECT_NEAR(mMesh->mVertices[i].z, p.z, 1e-3);
+        // the padding after the three components stays zero
+        EXPECT_EQ(0, stream->mData[i * stream->mStride + 6]);
+        EXPECT_EQ(0, stream->mData[i * stream->mStride + 7]);
+    }
+
+    const aiVertexAttribute *normal = stream->FindAttribute(aiVertexAttributeType_Normal);
+    ASSERT_NE(nullptr, normal);
+    EXPECT_EQ(aiVertexFormat_Snorm16, normal->mFormat);
+    EXPECT_EQ(2u, normal->mNumComponents);
+    const aiVertexAttribute *tangent = stream->FindAttribute(aiVertexAttributeType_Tangent);
+    ASSERT_NE(nullptr, tangent);
+    EXPECT_EQ(3u, tangent->mNumComponents);
+    for (unsigned int i = 0; i < NumVertices; ++i) {
+        EXPECT_GT(ReadOctahedral(*normal, i) * mMesh->mNormals[i], 0.9999f);
+        EXPECT_GT(ReadOctahedral(*tangent, i) * mMesh->mTangents[i], 0.9999f);
+        EXPECT_EQ(i % 2 ? -1.0f : 1.0f, ReadComponent(*tangent, i, 2));
+    }
+
+    const aiVertexAttribute *color = stream->FindAttribute(aiVertexAttributeType_Color);
+    ASSERT_NE(nullptr, color);
+    EXPECT_EQ(aiVertexFormat_Unorm8, color->mFormat);
+    const aiVertexAttribute *uv = stream->FindAttribute(aiVertexAttributeType_TextureCoords);
+    ASSERT_NE(nullptr, uv);
+    EXPECT_EQ(2u, uv->mNumComponents);
+    EXPECT_EQ(nullptr, stream->FindAttribute(aiVertexAttributeType_TextureCoords, 1));
+    for (unsigned int i = 0; i < NumVertices; ++i) {
+        const aiColor4D &c = mMesh->mColors[0][i];
+        EXPECT_NEAR(std::min(std::max(c.r, 0.0f), 1.0f), ReadComponent(*color, i, 0), 0.51 / 255);
+        EXPECT_NEAR(std::min(std::max(c.g, 0.0f), 1.0f), ReadComponent(*color, i, 1), 0.51 / 255);
+        EXPECT_NEAR(c.a, ReadComponent(*color, i, 3), 0.51 / 255);
+
+        const aiVector3D t = ReadVector(*uv, i);
+        EXPECT_NEAR(mMesh->mTextureCoords[0][i].x, t.x, 1e-4);
+        EXPECT_NEAR(mMesh->mTextureCoords[0][i].y, t.y, 1e-4);
+    }
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utGenVertexStreamsProcess, configuredFormatsTest) {
+    Importer importer;
+    importer.SetPropertyInteger(AI_CONFIG_PP_GVS_POSITION_FORMAT, aiVertexFormat_Float16);
+    importer.SetPropertyInteger(AI_CONFIG_PP_GVS_NORMAL_FORMAT, aiVertexFormat_Unorm8);
+    importer.SetPropertyInteger(AI_CONFIG_PP_GVS_TANGENT_FORMAT, -1);
+    importer.SetPropertyInteger(AI_CONFIG_PP_GVS_COLOR_FORMAT, aiVertexFormat_Float32);
+    importer.SetPropertyInteger(AI_CONFIG_PP_GVS_TEXCOORD_FORMAT, 42);
+    GenVertexStreamsProcess process;
+    process.SetupProperties(&importer);
+    ASSERT_TRUE(process.ProcessMesh(mMesh));
+
+    // 8 bytes position, 4 normal, 16 color and 4 texture coordinates
+    const aiVertexStream *stream = mMesh->mVertexStream;
+    EXPECT_EQ(32u, stream->mStride);
+    ASSERT_EQ(4u, stream->mNumAttributes);
+    EXPECT_EQ(nullptr, stream->FindAttribute(aiVertexAttributeType_Tangent));
+
+    // half-floats store the positions as they are
+    const aiVertexAttribute *position = stream->FindAttribute(aiVertexAttributeType_Position);
+    ASSERT_NE(nullptr, position);
+    EXPECT_EQ(aiVector3D(1.0f, 1.0f, 1.0f), position->mDecodeScale);
+    EXPECT_EQ(aiVector3D(), position->mDecodeOffset);
+    for (unsigned int i = 0; i < NumVertices; ++i) {
+        const aiVector3D p = ReadVector(*position, i);
+        for (unsigned int c = 0; c < 3; ++c) {
+            EXPECT_NEAR(mMesh->mVertices[i][c], p[c], std::fabs(mMesh->mVertices[i][c]) / 1024.0f);
+        }
+    }
+
+    // unsigned normal formats are replaced by the signed ones
+    const aiVertexAttribute *normal = stream->FindAttribute(aiVertexAttributeType_Normal);
+    ASSERT_NE(nullptr, normal);
+    EXPECT_EQ(aiVertexFormat_Snorm8, normal->mFormat);
+    EXPECT_EQ(8u, normal->mOffset);
+    for (unsigned int i = 0; i < NumVertices; ++i) {
+        EXPECT_GT(ReadOctahedral(*normal, i) * mMesh->mNormals[i], 0.99f);
+    }
+
+    const aiVertexAttribute *color = stream->FindAttribute(aiVertexAttributeType_Color);
+    ASSERT_NE(nullptr, color);
+    for (unsigned int i = 0; i < NumVertices; ++i) {
+        EXPECT_EQ(mMesh->mColors[0][i].g, ReadComponent(*color, i, 1));
+    }
+
+    // unknown formats fall back to the default
+    const aiVertexAttribute *uv = stream->FindAttribute(aiVertexAttributeType_TextureCoords);
+    ASSERT_NE(nullptr, uv);
+    EXPECT_EQ(aiVertexFormat_Unorm16, uv->mFormat);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utGenVertexStreamsProcess, importWithStreamsTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile64(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_GenBoundingBoxes |
+            aiProcess_GenVertexStreams | aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        const aiMesh *mesh = scene->mMeshes[i];
+        ASSERT_TRUE(mesh->HasVertexStream());
+        EXPECT_EQ(mesh->mNumVertices, mesh->mVertexStream->mNumVertices);
+
+        // the positions are quantized relative to the bounding box of the mesh
+        const aiVertexAttribute *position = mesh->mVertexStream->FindAttribute(aiVertexAttributeType_Position);
+        ASSERT_NE(nullptr, position);
+        EXPECT_EQ(mesh->mAABB.mMin, position->mDecodeOffset);
+        EXPECT_EQ(mesh->mAABB.mMax - mesh->mAABB.mMin, position->mDecodeScale);
+    }
+
+    // copies own their stream
+    aiScene *copy = nullptr;
+    aiCopyScene(scene, &copy);
+    ASSERT_NE(nullptr, copy);
+    const aiVertexStream *a = scene->mMeshes[0]->mVertexStream, *b = copy->mMeshes[0]->mVertexStream;
+    ASSERT_NE(a, b);
+    ASSERT_EQ(a->mStride, b->mStride);
+    EXPECT_NE(a->mData, b->mData);
+    EXPECT_EQ(0, memcmp(a->mData, b->mData, static_cast<size_t>(a->mStride) * a->mNumVertices));
+    aiFreeScene(copy);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utGenVertexStreamsProcess, staleStreamsTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile64(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_Triangulate | aiProcess_GenVertexStreams);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_TRUE(scene->mMeshes[0]->HasVertexStream());
+
+    // steps which leave the vertices alone keep the streams
+    scene = importer.ApplyPostProcessing(aiProcess_GenBoundingBoxes);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(scene->mMeshes[0]->HasVertexStream());
+
+    // the others delete them, unless they are requested again
+    scene = importer.ApplyPostProcessing(aiProcess_FlipUVs);
+    ASSERT_NE(nullptr, scene);
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
+        EXPECT_EQ(nullptr, scene->mMeshes[i]->mVertexStream);
+    }
+    scene = importer.ApplyPostProcessing64(aiProcess_FlipUVs | aiProcess_GenVertexStreams);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_TRUE(scene->mMeshes[0]->HasVertexStream());
+}
+
+#ifndef ASSIMP_BUILD_NO_EXPORT
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utGenVertexStreamsProcess, exportSharedStreamsTest) {
+    Importer importer;
+    const aiScene *scene = importer.ReadFile64(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj",
+            aiProcess_Triangulate | aiProcess_GenVertexStreams);
+    ASSERT_NE(nullptr, scene);
+    const aiVertexStream *stream = scene->mMeshes[0]->mVertexStream;
+    ASSERT_NE(nullptr, stream);
+
+    // the copy of the export shares the streams with the source scene and must leave them alone
+    ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_COPY_ON_WRITE, true);
+    Exporter exporter;
+    for (const aiPostProcessStepMask pp : { aiPostProcessStepMask(aiProcess_FlipWindingOrder), aiPostProcessStepMask(aiProcess_FlipUVs) }) {
+        ASSERT_NE(nullptr, exporter.ExportToBlob(scene, "obj", static_cast<unsigned int>(pp), &properties));
+        ASSERT_EQ(stream, scene->mMeshes[0]->mVertexStream);
+        EXPECT_EQ(scene->mMeshes[0]->mNumVertices, stream->mNumVertices);
+    }
+}
+
+#endif // ASSIMP_BUILD_NO_EXPORT
@@ -42,10 +42,17 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "../../include/assimp/postprocess.h"
 #include "../../include/assimp/scene.h"
+#include "SceneDiffer.h"
 #include "TestIOSystem.h"
+#include "Common/BaseProcess.h"
+#include "Common/ImportCache.h"
 #include <assimp/BaseImporter.h>
 #include <assimp/DefaultIOSystem.h>
 #include <assimp/Importer.hpp>
+#include <assimp/Profiler.h>
+#include <assimp/config.h>
+
+#include <filesystem>
 
 using namespace ::std;
 using namespace ::Assimp;
@@ -181,6 +188,46 @@ TEST_F(ImporterTest, testMemoryRead) {
     EXPECT_EQ(12U, sc->mMeshes[0]->mNumFaces);
 }
 
+// ------------------------------------------------------------------------------------------------
+// Post processing step living in the upper half of the 64 bit step mask
+class ExtendedFlagProcess : public BaseProcess {
+public:
+    explicit ExtendedFlagProcess(unsigned int &executed) : mExecuted(executed) {}
+
+    bool IsActive(aiPostProcessStepMask pFlags) const override {
+        return (pFlags & aiProcessExtFlag(30)) != 0;
+    }
+
+    void Execute(aiScene *) override {
+        ++mExecuted;
+    }
+
+private:
+    unsigned int &mExecuted;
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testExtendedStepMask) {
+    unsigned int executed = 0;
+    pImp->RegisterPPStep(new ExtendedFlagProcess(executed));
+
+    EXPECT_TRUE(pImp->ValidateFlags64(aiProcessExtFlag(30) | aiProcess_Triangulate));
+    EXPECT_FALSE(pImp->ValidateFlags64(aiProcessExtFlag(31)));
+
+    // The 32 bit entry points cannot reach the extended step
+    ASSERT_NE(nullptr, pImp->ReadFileFromMemory(InputData_abRawBlock, InputData_BLOCK_SIZE,
+            aiProcess_Triangulate, "3ds"));
+    EXPECT_EQ(0U, executed);
+
+    const aiScene *sc = pImp->ReadFileFromMemory64(InputData_abRawBlock, InputData_BLOCK_SIZE,
+            aiProcessExtFlag(30) | aiProcess_Triangulate, "3ds");
+    ASSERT_NE(nullptr, sc);
+    EXPECT_EQ(1U, executed);
+
+    EXPECT_EQ(sc, pImp->ApplyPostProcessing64(aiProcessExtFlag(30)));
+    EXPECT_EQ(2U, executed);
+}
+
 // ------------------------------------------------------------------------------------------------
 TEST_F(ImporterTest, testIntProperty) {
     bool b = pImp->SetPropertyInteger("quakquak", 1503);
@@ -275,6 +322,175 @@ TEST_F(ImporterTest, testMultipleReads) {
     //EXPECT_TRUE(pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/X/dwarf.x",flags)); # is in nonbsd
 }
 
+// ------------------------------------------------------------------------------------------------
+static size_t CountCacheEntries(const std::filesystem::path &directory) {
+    size_t count = 0;
+    for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+        count += entry.path().extension() == ".assnap" ? 1 : 0;
+    }
+    return count;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testImportCache) {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "assimp_import_cache_test";
+    std::filesystem::remove_all(directory);
+
+    const char *file = ASSIMP_TEST_MODELS_DIR "/X/test.x";
+    const unsigned int flags = aiProcess_Triangulate | aiProcess_JoinIdenticalVertices | aiProcess_ValidateDataStructure;
+    Importer reference;
+    const aiScene *expected = reference.ReadFile(file, flags);
+    ASSERT_NE(nullptr, expected);
+
+    pImp->SetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY, directory.string());
+    pImp->SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+    ASSERT_NE(nullptr, pImp->ReadFile(file, flags));
+    EXPECT_EQ(1u, CountCacheEntries(directory));
+    const int importerIndex = pImp->GetPropertyInteger("importerIndex", -1);
+    EXPECT_NE(-1, importerIndex);
+
+    // the second import is served from the cache
+    pImp->SetPropertyInteger("importerIndex", -1);
+    const aiScene *cached = pImp->ReadFile(file, flags);
+    ASSERT_NE(nullptr, cached);
+    EXPECT_EQ(importerIndex, pImp->GetPropertyInteger("importerIndex", -1));
+    Profiling::ProfileReport report;
+    ASSERT_TRUE(pImp->GetProfileReport(report));
+    EXPECT_NE(nullptr, report.Find("total/cache"));
+    EXPECT_EQ(nullptr, report.Find("total/import"));
+    SceneDiffer differ;
+    EXPECT_TRUE(differ.isEqual(expected, cached));
+    EXPECT_EQ(1u, CountCacheEntries(directory));
+
+    // other flags and properties are other entries
+    ASSERT_NE(nullptr, pImp->ReadFile(file, flags | aiProcess_GenSmoothNormals));
+    EXPECT_EQ(2u, CountCacheEntries(directory));
+    pImp->SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS, aiComponent_NORMALS);
+    ASSERT_NE(nullptr, pImp->ReadFile(file, flags));
+    EXPECT_EQ(3u, CountCacheEntries(directory));
+
+    std::filesystem::remove_all(directory);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testImportCacheEviction) {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "assimp_import_cache_eviction";
+    std::filesystem::remove_all(directory);
+
+    const aiScene *scene = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/X/test.x", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, scene);
+    DefaultIOSystem io;
+    const RecordingIOSystem files(&io);
+    ImportCache unbounded(directory.string(), ~0ull);
+    ASSERT_TRUE(unbounded.Store("first", scene, files, 0));
+    const uint64_t size = std::filesystem::file_size(directory / "first.assnap");
+
+    // room for two entries, the least recently used one is dropped
+    ImportCache cache(directory.string(), size * 2 + size / 2);
+    ASSERT_TRUE(cache.Store("second", scene, files, 0));
+    int importerIndex = -1;
+    aiScene *loaded = cache.Load("first", &io, importerIndex);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ(0, importerIndex);
+    delete loaded;
+    ASSERT_TRUE(cache.Store("third", scene, files, 0));
+    EXPECT_TRUE(std::filesystem::exists(directory / "first.assnap"));
+    EXPECT_FALSE(std::filesystem::exists(directory / "second.assnap"));
+    EXPECT_FALSE(std::filesystem::exists(directory / "second.deps"));
+    EXPECT_TRUE(std::filesystem::exists(directory / "third.assnap"));
+    EXPECT_EQ(nullptr, cache.Load("second", &io, importerIndex));
+
+    std::filesystem::remove_all(directory);
+}
+
+// ------------------------------------------------------------------------------------------------
+static void WriteTextFile(const std::filesystem::path &path, const char *text) {
+    FILE *file = fopen(path.string().c_str(), "wb");
+    ASSERT_NE(nullptr, file);
+    fputs(text, file);
+    fclose(file);
+}
+
+// ------------------------------------------------------------------------------------------------
+static aiColor3D GetDiffuse(const aiScene *scene) {
+    aiColor3D diffuse;
+    for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+        if (scene->mMaterials[i]->GetName() == aiString("color")) {
+            scene->mMaterials[i]->Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);
+        }
+    }
+    return diffuse;
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testImportCacheDependencies) {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "assimp_import_cache_dependencies";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory / "cache");
+    const std::string file = (directory / "triangle.obj").string();
+    WriteTextFile(file, "mtllib triangle.mtl\nv 0 0 0\nv 1 0 0\nv 0 1 0\nusemtl color\nf 1 2 3\n");
+    WriteTextFile(directory / "triangle.mtl", "newmtl color\nKd 1 0 0\n");
+
+    pImp->SetPropertyString(AI_CONFIG_IMPORT_CACHE_DIRECTORY, (directory / "cache").string());
+    pImp->SetPropertyBool(AI_CONFIG_GLOB_MEASURE_TIME, true);
+    const unsigned int flags = aiProcess_ValidateDataStructure;
+    const aiScene *scene = pImp->ReadFile(file, flags);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(aiColor3D(1, 0, 0), GetDiffuse(scene));
+
+    // the material library is part of the entry, changing it imports the file again
+    WriteTextFile(directory / "triangle.mtl", "newmtl color\nKd 0 1 0\n");
+    scene = pImp->ReadFile(file, flags);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(aiColor3D(0, 1, 0), GetDiffuse(scene));
+    Profiling::ProfileReport report;
+    ASSERT_TRUE(pImp->GetProfileReport(report));
+    EXPECT_NE(nullptr, report.Find("total/import"));
+
+    scene = pImp->ReadFile(file, flags);
+    ASSERT_NE(nullptr, scene);
+    EXPECT_EQ(aiColor3D(0, 1, 0), GetDiffuse(scene));
+    ASSERT_TRUE(pImp->GetProfileReport(report));
+    EXPECT_EQ(nullptr, report.Find("total/import"));
+
+    // so is a file which was read and is gone now
+    std::filesystem::remove(directory / "triangle.mtl");
+    scene = pImp->ReadFile(file, flags);
+    ASSERT_NE(nullptr, scene);
+    ASSERT_TRUE(pImp->GetProfileReport(report));
+    EXPECT_NE(nullptr, report.Find("total/import"));
+
+    std::filesystem::remove_all(directory);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(ImporterTest, testMaterialPropertyIndex) {
+    // the index is opt-in, lookups resolve to the same properties with and without it
+    const unsigned int flags = aiProcess_ValidateDataStructure;
+    Importer reference;
+    const aiScene *expected = reference.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, expected);
+    pImp->SetPropertyBool(AI_CONFIG_IMPORT_MATERIAL_PROPERTY_INDEX, true);
+    const aiScene *scene = pImp->ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", flags);
+    ASSERT_NE(nullptr, scene);
+
+    ASSERT_EQ(expected->mNumMaterials, scene->mNumMaterials);
+    for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
+        const aiMaterial *a = expected->mMaterials[i], *b = scene->mMaterials[i];
+        ASSERT_EQ(a->mNumProperties, b->mNumProperties);
+        for (unsigned int p = 0; p < b->mNumProperties; ++p) {
+            const aiMaterialProperty *key = b->mProperties[p];
+            const aiMaterialProperty *propA = nullptr, *propB = nullptr;
+            ASSERT_EQ(AI_SUCCESS, aiGetMaterialProperty(a, key->mKey.data, key->mSemantic, key->mIndex, &propA));
+            ASSERT_EQ(AI_SUCCESS, aiGetMaterialProperty(b, key->mKey.data, key->mSemantic, key->mIndex, &propB));
+            ASSERT_EQ(propA->mDataLength, propB->mDataLength);
+            EXPECT_EQ(0, memcmp(propA->mData, propB->mData, propA->mDataLength));
+        }
+        aiString name;
+        EXPECT_EQ(AI_FAILURE, b->Get("$mat.nonexistent", 0, 0, name));
+    }
+}
+
 TEST_F(ImporterTest, SearchFileHeaderForTokenTest) {
     //DefaultIOSystem ioSystem;
     //    BaseImporter::SearchFileHeaderForToken( &ioSystem, assetPath, Token, 2 )
@@ -40,3 +40,262 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "UnitTestPCH.h"
+
+#include "PostProcessing/ImproveCacheLocality.h"
+
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+
+#include <algorithm>
+#include <array>
+
+using namespace Assimp;
+
+class utImproveCacheLocality : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // a grid of quads with shuffled faces and vertices, so the input has a bad ACMR
+        const unsigned int size = 40;
+        const unsigned int numVertices = (size + 1) * (size + 1);
+        std::vector<unsigned int> shuffle(numVertices);
+        for (unsigned int i = 0; i < numVertices; ++i) {
+            shuffle[i] = i;
+        }
+        unsigned int seed = 1234567;
+        const auto next = [&seed]() {
+            seed = seed * 1103515245u + 12345u;
+            return seed >> 8;
+        };
+        for (unsigned int i = numVertices - 1; i > 0; --i) {
+            std::swap(shuffle[i], shuffle[next() % (i + 1)]);
+        }
+
+        mMesh = new aiMesh();
+        mMesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mMesh->mNumVertices = numVertices;
+        mMesh->mVertices = new aiVector3D[numVertices];
+        mMesh->mNormals = new aiVector3D[numVertices];
+        mMesh->mTextureCoords[0] = new aiVector3D[numVertices];
+        for (unsigned int y = 0; y <= size; ++y) {
+            for (unsigned int x = 0; x <= size; ++x) {
+                const unsigned int v = shuffle[y * (size + 1) + x];
+                mMesh->mVertices[v] = aiVector3D(ai_real(x), ai_real(y), ai_real((x * y) % 7));
+                mMesh->mNormals[v] = aiVector3D(ai_real(x), ai_real(y), 1);
+                mMesh->mTextureCoords[0][v] = aiVector3D(ai_real(y), ai_real(x), 0);
+            }
+        }
+
+        std::vector<std::array<unsigned int, 3>> faces;
+        for (unsigned int y = 0; y < size; ++y) {
+            for (unsigned int x = 0; x < size; ++x) {
+                const unsigned int a = shuffle[y * (size + 1) + x], b = shuffle[y * (size + 1) + x + 1];
+                const unsigned int c = shuffle[(y + 1) * (size + 1) + x], d = shuffle[(y + 1) * (size + 1) + x + 1];
+                faces.push_back({ { a, b, d } });
+                faces.push_back({ { a, d, c } });
+            }
+        }
+        for (size_t i = faces.size() - 1; i > 0; --i) {
+            std::swap(faces[i], faces[next() % (i + 1)]);
+        }
+        mMesh->mNumFaces = static_cast<unsigned int>(faces.size());
+        mMesh->mFaces = new aiFace[mMesh->mNumFaces];
+        for (unsigned int i = 0; i < mMesh->mNumFaces; ++i) {
+            aiFace &face = mMesh->mFaces[i];
+            face.mIndices = new unsigned int[face.mNumIndices = 3];
+            std::copy(faces[i].begin(), faces[i].end(), face.mIndices);
+        }
+
+        // one bone influencing every second vertex and a morph target
+        mMesh->mNumBones = 1;
+        mMesh->mBones = new aiBone *[1];
+        aiBone *bone = mMesh->mBones[0] = new aiBone();
+        bone->mNumWeights = numVertices / 2;
+        bone->mWeights = new aiVertexWeight[bone->mNumWeights];
+        for (unsigned int i = 0; i < bone->mNumWeights; ++i) {
+            bone->mWeights[i] = aiVertexWeight(i * 2, 1.f);
+        }
+        mMesh->mNumAnimMeshes = 1;
+        mMesh->mAnimMeshes = new aiAnimMesh *[1];
+        aiAnimMesh *animMesh = mMesh->mAnimMeshes[0] = new aiAnimMesh();
+        animMesh->mNumVertices = numVertices;
+        animMesh->mVertices = new aiVector3D[numVertices];
+        for (unsigned int i = 0; i < numVertices; ++i) {
+            animMesh->mVertices[i] = mMesh->mVertices[i] + aiVector3D(0, 0, 1);
+        }
+
+        mScene = new aiScene();
+        mScene->mNumMeshes = 1;
+        mScene->mMeshes = new aiMesh *[1];
+        mScene->mMeshes[0] = mMesh;
+
+        // a skeleton bone influencing every third vertex
+        mScene->mNumSkeletons = 1;
+        mScene->mSkeletons = new aiSkeleton *[1];
+        aiSkeleton *skeleton = mScene->mSkeletons[0] = new aiSkeleton();
+        skeleton->mNumBones = 1;
+        skeleton->mBones = new aiSkeletonBone *[1];
+        aiSkeletonBone *skeletonBone = skeleton->mBones[0] = new aiSkeletonBone();
+        skeletonBone->mMeshId = mMesh;
+        skeletonBone->mNumnWeights = numVertices / 3;
+        skeletonBone->mWeights = new aiVertexWeight[skeletonBone->mNumnWeights];
+        for (unsigned int i = 0; i < skeletonBone->mNumnWeights; ++i) {
+            skeletonBone->mWeights[i] = aiVertexWeight(i * 3, 1.f);
+        }
+
+        mInputFaces = getFacePositions();
+        mInputACMR = getACMR();
+        for (unsigned int i = 0; i < bone->mNumWeights; ++i) {
+            mWeightPositions.push_back(mMesh->mVertices[bone->mWeights[i].mVertexId]);
+        }
+        for (unsigned int i = 0; i < skeletonBone->mNumnWeights; ++i) {
+            mSkeletonWeightPositions.push_back(mMesh->mVertices[skeletonBone->mWeights[i].mVertexId]);
+        }
+    }
+
+    void TearDown() override {
+        delete mScene;
+    }
+
+    std::vector<std::array<ai_real, 9>> getFacePositions() const {
+        std::vector<std::array<ai_real, 9>> out;
+        for (unsigned int i = 0; i < mMesh->mNumFaces; ++i) {
+            std::array<ai_real, 9> face;
+            for (unsigned int k = 0; k < 3; ++k) {
+                const aiVector3D &p = mMesh->mVertices[mMesh->mFaces[i].mIndices[k]];
+                face[k * 3] = p.x;
+                face[k * 3 + 1] = p.y;
+                face[k * 3 + 2] = p.z;
+            }
+            out.push_back(face);
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    float getACMR() const {
+        std::vector<unsigned int> stamps(mMesh->mNumVertices, 0);
+        unsigned int stamp = PP_ICL_PTCACHE_SIZE + 1, misses = 0;
+        for (unsigned int i = 0; i < mMesh->mNumFaces; ++i) {
+            for (unsigned int k = 0; k < 3; ++k) {
+                const unsigned int v = mMesh->mFaces[i].mIndices[k];
+                if (stamp - stamps[v] > PP_ICL_PTCACHE_SIZE) {
+                    stamps[v] = stamp++;
+                    ++misses;
+                }
+            }
+        }
+        return float(misses) / mMesh->mNumFaces;
+    }
+
+    void process(unsigned int algorithm, float overdrawThreshold, bool optimizeFetch) {
+        Importer importer;
+        importer.SetPropertyInteger(AI_CONFIG_PP_ICL_ALGORITHM, algorithm);
+        importer.SetPropertyFloat(AI_CONFIG_PP_ICL_OVERDRAW_THRESHOLD, overdrawThreshold);
+        importer.SetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_FETCH, optimizeFetch);
+
+        ImproveCacheLocalityProcess process;
+        process.SetupProperties(&importer);
+        process.Execute(mScene);
+    }
+
+    void checkVertexData() const {
+        // all streams must still belong to the same vertices
+        for (unsigned int i = 0; i < mMesh->mNumVertices; ++i) {
+            const aiVector3D &p = mMesh->mVertices[i];
+            EXPECT_EQ(aiVector3D(p.x, p.y, 1), mMesh->mNormals[i]);
+            EXPECT_EQ(aiVector3D(p.y, p.x, 0), mMesh->mTextureCoords[0][i]);
+            EXPECT_EQ(p + aiVector3D(0, 0, 1), mMesh->mAnimMeshes[0]->mVertices[i]);
+        }
+        const aiBone *bone = mMesh->mBones[0];
+        for (unsigned int i = 0; i < bone->mNumWeights; ++i) {
+            EXPECT_EQ(mWeightPositions[i], mMesh->mVertices[bone->mWeights[i].mVertexId]);
+        }
+        const aiSkeletonBone *skeletonBone = mScene->mSkeletons[0]->mBones[0];
+        for (unsigned int i = 0; i < skeletonBone->mNumnWeights; ++i) {
+            EXPECT_EQ(mSkeletonWeightPositions[i], mMesh->mVertices[skeletonBone->mWeights[i].mVertexId]);
+        }
+    }
+
+    void checkFetchOrder() const {
+        // the vertices are referenced in ascending order
+        unsigned int nextVertex = 0;
+        for (unsigned int i = 0; i < mMesh->mNumFaces; ++i) {
+            for (unsigned int k = 0; k < 3; ++k) {
+                const unsigned int v = mMesh->mFaces[i].mIndices[k];
+                ASSERT_LE(v, nextVertex);
+                if (v == nextVertex) {
+                    ++nextVertex;
+                }
+            }
+        }
+        EXPECT_EQ(mMesh->mNumVertices, nextVertex);
+    }
+
+    aiScene *mScene = nullptr;
+    aiMesh *mMesh = nullptr;
+    std::vector<std::array<ai_real, 9>> mInputFaces;
+    std::vector<aiVector3D> mWeightPositions;
+    std::vector<aiVector3D> mSkeletonWeightPositions;
+    float mInputACMR = 0.f;
+};
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utImproveCacheLocality, tipsifyTest) {
+    process(AI_ICL_ALGORITHM_TIPSIFY, 0.f, false);
+
+    EXPECT_EQ(mInputFaces, getFacePositions());
+    EXPECT_LT(getACMR(), mInputACMR * 0.5f);
+    checkVertexData();
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utImproveCacheLocality, forsythTest) {
+    process(AI_ICL_ALGORITHM_FORSYTH, 0.f, false);
+
+    EXPECT_EQ(mInputFaces, getFacePositions());
+    EXPECT_LT(getACMR(), mInputACMR * 0.5f);
+    checkVertexData();
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utImproveCacheLocality, overdrawAndFetchTest) {
+    process(AI_ICL_ALGORITHM_FORSYTH, 1.05f, true);
+
+    EXPECT_EQ(mInputFaces, getFacePositions());
+    EXPECT_LT(getACMR(), mInputACMR * 0.5f);
+    checkVertexData();
+    checkFetchOrder();
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(utImproveCacheLocality, fetchWithinCacheTest) {
+    // the mesh fits into the cache, the faces keep their order but the vertices are still reordered
+    Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_PP_ICL_OPTIMIZE_FETCH, true);
+    importer.SetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE, mMesh->mNumVertices);
+
+    std::vector<std::array<ai_real, 9>> faces;
+    for (unsigned int i = 0; i < mMesh->mNumFaces; ++i) {
+        std::array<ai_real, 9> face;
+        for (unsigned int k = 0; k < 3; ++k) {
+            const aiVector3D &p = mMesh->mVertices[mMesh->mFaces[i].mIndices[k]];
+            face[k * 3] = p.x;
+            face[k * 3 + 1] = p.y;
+            face[k * 3 + 2] = p.z;
+        }
+        faces.push_back(face);
+    }
+
+    ImproveCacheLocalityProcess process;
+    process.SetupProperties(&importer);
+    process.Execute(mScene);
+
+    for (unsigned int i = 0; i < mMesh->mNumFaces; ++i) {
+        for (unsigned int k = 0; k < 3; ++k) {
+            const aiVector3D &p = mMesh->mVertices[mMesh->mFaces[i].mIndices[k]];
+            ASSERT_EQ(aiVector3D(faces[i][k * 3], faces[i][k * 3 + 1], faces[i][k * 3 + 2]), p);
+        }
+    }
+    checkVertexData();
+    checkFetchOrder();
+}
@@ -0,0 +1,133 @@
+/*-------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+-------------------------------------------------------------------------*/
+#include "UnitTestPCH.h"
+
+#include <assimp/MMapIOSystem.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ::Assimp;
+
+class utMMapIOSystem : public ::testing::Test {
+protected:
+    // Imports the file once through the default and once through the mapping IO system
+    // and checks that both scenes have the same geometry.
+    static void CompareWithDefaultIO(const std::string &file) {
+        Importer defaultImporter;
+        const aiScene *expected = defaultImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, expected);
+
+        Importer mappedImporter;
+        mappedImporter.SetIOHandler(new MMapIOSystem);
+        const aiScene *actual = mappedImporter.ReadFile(file, aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, actual);
+
+        ASSERT_EQ(expected->mNumMeshes, actual->mNumMeshes);
+        for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = actual->mMeshes[i];
+            ASSERT_EQ(a->mNumVertices, b->mNumVertices);
+            ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+            EXPECT_EQ(0, memcmp(a->mVertices, b->mVertices, sizeof(aiVector3D) * a->mNumVertices));
+        }
+    }
+};
+
+TEST_F(utMMapIOSystem, readAndSeekTest) {
+    MMapIOSystem io;
+    const std::string file = ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl";
+    IOStream *stream = io.Open(file.c_str(), "rb");
+    ASSERT_NE(nullptr, stream);
+
+    const size_t size = stream->FileSize();
+    ASSERT_GT(size, 84u);
+
+    std::vector<uint8_t> contents(size);
+    EXPECT_EQ(1u, stream->Read(contents.data(), size, 1));
+    EXPECT_EQ(size, stream->Tell());
+    EXPECT_EQ(0u, stream->Read(contents.data(), 1, 1));
+
+    EXPECT_EQ(AI_SUCCESS, stream->Seek(80, aiOrigin_SET));
+    uint32_t numFaces = 0;
+    EXPECT_EQ(1u, stream->Read(&numFaces, sizeof(numFaces), 1));
+    EXPECT_EQ(0, memcmp(&numFaces, &contents[80], sizeof(numFaces)));
+    EXPECT_EQ(AI_FAILURE, stream->Seek(size + 1, aiOrigin_SET));
+
+    const uint8_t *mapped = stream->GetMappedData();
+#if !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+    ASSERT_NE(nullptr, mapped);
+#endif
+    if (mapped != nullptr) {
+        EXPECT_EQ(0, memcmp(mapped, contents.data(), size));
+    }
+
+    io.Close(stream);
+}
+
+TEST_F(utMMapIOSystem, missingFileTest) {
+    MMapIOSystem io;
+    EXPECT_EQ(nullptr, io.Open(ASSIMP_TEST_MODELS_DIR "/STL/does_not_exist.stl", "rb"));
+}
+
+TEST_F(utMMapIOSystem, importBinarySTLTest) {
+    CompareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl");
+}
+
+TEST_F(utMMapIOSystem, importAsciiSTLTest) {
+    CompareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl");
+}
+
+TEST_F(utMMapIOSystem, importBinaryFBXTest) {
+    CompareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/FBX/spider.fbx");
+}
+
+TEST_F(utMMapIOSystem, importGLBTest) {
+    CompareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb");
+}
+
+TEST_F(utMMapIOSystem, importGLTFWithExternalBufferTest) {
+    CompareWithDefaultIO(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF/BoxTextured.gltf");
+}
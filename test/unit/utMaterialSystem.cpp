@@ -279,6 +279,64 @@ TEST_F(MaterialSystemTest, testMaterialTextureTypeEnum) {
     EXPECT_EQ(maxTextureType, AI_TEXTURE_TYPE_MAX) << "AI_TEXTURE_TYPE_MAX macro must be equal to the largest valid aiTextureType_XXX";
 }
 
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testPropertyIndex) {
+    for (int i = 0; i < 40; ++i) {
+        const std::string key = "indexKey" + std::to_string(i);
+        pcMat->AddProperty(&i, 1, key.c_str(), 0, static_cast<unsigned int>(i % 3));
+    }
+    const int dup = 4711;
+    pcMat->AddProperty(&dup, 1, "indexKey7", aiTextureType_DIFFUSE, 5);
+    pcMat->BuildPropertyIndex();
+
+    for (int i = 0; i < 40; ++i) {
+        const std::string key = "indexKey" + std::to_string(i);
+        int value = -1;
+        EXPECT_EQ(AI_SUCCESS, pcMat->Get(key.c_str(), 0, static_cast<unsigned int>(i % 3), value));
+        EXPECT_EQ(i, value);
+        EXPECT_EQ(AI_FAILURE, pcMat->Get(key.c_str(), 1, static_cast<unsigned int>(i % 3), value));
+    }
+
+    int value = -1;
+    EXPECT_EQ(AI_SUCCESS, pcMat->Get("indexKey7", aiTextureType_DIFFUSE, 5, value));
+    EXPECT_EQ(dup, value);
+
+    // keys are compared exactly, not by prefix
+    EXPECT_EQ(AI_FAILURE, pcMat->Get("indexKey", 0, 0, value));
+
+    // modifications drop the index, lookups keep working
+    const int changed = 42;
+    pcMat->AddProperty(&changed, 1, "indexKey3", 0, 0);
+    EXPECT_EQ(AI_SUCCESS, pcMat->Get("indexKey3", 0, 0, value));
+    EXPECT_EQ(changed, value);
+    EXPECT_EQ(AI_SUCCESS, pcMat->RemoveProperty("indexKey3", 0, 0));
+    pcMat->BuildPropertyIndex();
+    EXPECT_EQ(AI_FAILURE, pcMat->Get("indexKey3", 0, 0, value));
+
+    // wild-card queries bypass the index
+    const aiMaterialProperty *prop = nullptr;
+    EXPECT_EQ(AI_SUCCESS, aiGetMaterialProperty(pcMat, "indexKey7", UINT_MAX, UINT_MAX, &prop));
+    ASSERT_NE(nullptr, prop);
+    EXPECT_EQ(1u, prop->mIndex);
+}
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(MaterialSystemTest, testPropertyIndexLifetime) {
+    // the index is dropped with its material, a material reusing the address starts without one
+    for (int i = 0; i < 4; ++i) {
+        aiMaterial *mat = new aiMaterial();
+        const std::string key = "lifetimeKey" + std::to_string(i);
+        mat->AddProperty(&i, 1, key.c_str(), 0, 0);
+        int value = -1;
+        EXPECT_EQ(AI_SUCCESS, mat->Get(key.c_str(), 0, 0, value));
+        EXPECT_EQ(i, value);
+        mat->BuildPropertyIndex();
+        EXPECT_EQ(AI_SUCCESS, mat->Get(key.c_str(), 0, 0, value));
+        EXPECT_EQ(i, value);
+        delete mat;
+    }
+}
+
 #if defined(_MSC_VER)
 __pragma (warning(pop))
 #endif
@@ -42,11 +42,14 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractImportExportBase.h"
 #include "SceneDiffer.h"
 #include "UnitTestPCH.h"
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <string>
+
 using namespace Assimp;
 
 static const float VertComponents[24 * 3] = {
@@ -539,3 +542,76 @@ TEST_F(utObjImportExport, issue2355_mtl_texture_prefix) {
     // The MTL file is in `folder`, the image path should have been prefixed with the folder
     EXPECT_STREQ("folder/image.jpg", texturePath.C_Str());
 }
+
+static void expectParallelParsingMatchesSerial(const aiScene *(*read)(Importer &)) {
+    Importer serialImporter;
+    const aiScene *expected = read(serialImporter);
+    ASSERT_NE(nullptr, expected);
+
+    Importer parallelImporter;
+    parallelImporter.SetPropertyInteger(AI_CONFIG_IMPORT_NUM_THREADS, 4);
+    const aiScene *actual = read(parallelImporter);
+    ASSERT_NE(nullptr, actual);
+
+    SceneDiffer differ;
+    EXPECT_TRUE(differ.isEqual(expected, actual));
+    differ.showReport();
+    ASSERT_EQ(expected->mRootNode->mNumChildren, actual->mRootNode->mNumChildren);
+    for (unsigned int i = 0; i < expected->mRootNode->mNumChildren; ++i) {
+        EXPECT_EQ(expected->mRootNode->mChildren[i]->mName, actual->mRootNode->mChildren[i]->mName);
+        EXPECT_EQ(expected->mRootNode->mChildren[i]->mNumMeshes, actual->mRootNode->mChildren[i]->mNumMeshes);
+    }
+}
+
+TEST_F(utObjImportExport, parallel_parsing_of_files_Test) {
+    expectParallelParsingMatchesSerial([](Importer &importer) {
+        return importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/WusonOBJ.obj", aiProcess_ValidateDataStructure);
+    });
+    expectParallelParsingMatchesSerial([](Importer &importer) {
+        return importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/regr01.obj", aiProcess_ValidateDataStructure);
+    });
+    expectParallelParsingMatchesSerial([](Importer &importer) {
+        return importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/OBJ/spider.obj", aiProcess_ValidateDataStructure);
+    });
+}
+
+// Groups, materials, relative indices, vertex colors and continued lines spread over several chunks
+static std::string createLargeObjModel() {
+    std::string model = "# generated\n";
+    for (int i = 0; i < 6000; ++i) {
+        if (i % 700 == 0) {
+            model += "o object" + std::to_string(i / 700) + "\n";
+        }
+        if (i % 250 == 0) {
+            model += "g group" + std::to_string(i / 250 % 5) + "\n";
+            model += "usemtl material" + std::to_string(i / 250 % 3) + "\n";
+            model += "s 1\n";
+        }
+        const std::string x = std::to_string(i), y = std::to_string(i % 17), z = std::to_string(i % 5);
+        if (i >= 3000 && i % 2 == 0) {
+            model += "v " + x + " " + y + " " + z + " 0.5 0.25 1\n";
+        } else {
+            model += "v " + x + " " + y + " " + z + "\n";
+        }
+        model += "vt 0." + y + " 0." + z + "\n";
+        model += "vn 0 0 1\n";
+        if (i >= 2) {
+            if (i % 3 == 0) {
+                model += "f -3/-3/-3 -2/-2/-2 \\\n -1/-1/-1\n";
+            } else {
+                const std::string a = std::to_string(i - 1), b = std::to_string(i), c = std::to_string(i + 1);
+                model += "f " + a + "/" + a + "/" + a + " " + b + "/" + b + "/" + b + " " + c + "/" + c + "/" + c + "\n";
+            }
+        }
+    }
+    model += "l 1 2 3\np 4 5\n";
+    return model;
+}
+
+TEST_F(utObjImportExport, parallel_parsing_from_memory_Test) {
+    static const std::string model = createLargeObjModel();
+    ASSERT_GT(model.size(), 4u * 64u * 1024u);
+    expectParallelParsingMatchesSerial([](Importer &importer) {
+        return importer.ReadFileFromMemory(model.data(), model.size(), aiProcess_ValidateDataStructure, "obj");
+    });
+}
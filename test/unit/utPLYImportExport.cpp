@@ -46,6 +46,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <sstream>
+
 using namespace ::Assimp;
 
 class utPLYImportExport : public AbstractImportExportBase {
@@ -261,3 +263,96 @@ TEST_F(utPLYImportExport, parseInvalidDoubleCustomProperty) {
     const aiScene *scene = importer.ReadFileFromMemory(data, sizeof(data), 0);
     EXPECT_EQ(nullptr, scene);
 }
+
+// Binary vertex and face records are decoded straight into the mesh, make sure this
+// matches the ascii path for both byte orders
+TEST_F(utPLYImportExport, importBinaryMatchesAscii) {
+    const float positions[4][3] = { { 0.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, { 1.f, 1.f, 0.f }, { 0.f, 1.f, 0.5f } };
+    const unsigned char colors[4][3] = { { 255, 0, 0 }, { 0, 255, 0 }, { 0, 0, 255 }, { 128, 128, 128 } };
+    const int faces[2][3] = { { 0, 1, 2 }, { 0, 2, 3 } };
+    const std::string header = "element vertex 4\n"
+                               "property float x\n"
+                               "property float y\n"
+                               "property float z\n"
+                               "property short quality\n"
+                               "property uchar red\n"
+                               "property uchar green\n"
+                               "property uchar blue\n"
+                               "property float nx\n"
+                               "property float ny\n"
+                               "property float nz\n"
+                               "element face 2\n"
+                               "property list uchar int vertex_indices\n"
+                               "property uchar flags\n"
+                               "end_header\n";
+
+    std::ostringstream ascii;
+    ascii << "ply\nformat ascii 1.0\n" << header;
+    for (unsigned int i = 0; i < 4; ++i) {
+        ascii << positions[i][0] << " " << positions[i][1] << " " << positions[i][2] << " 7 "
+              << int(colors[i][0]) << " " << int(colors[i][1]) << " " << int(colors[i][2]) << " 0 0 1\n";
+    }
+    for (unsigned int i = 0; i < 2; ++i) {
+        ascii << "3 " << faces[i][0] << " " << faces[i][1] << " " << faces[i][2] << " 1\n";
+    }
+
+    const auto binary = [&](bool bigEndian) {
+        std::string out = std::string("ply\nformat ") + (bigEndian ? "binary_big_endian" : "binary_little_endian") + " 1.0\n" + header;
+        const auto append = [&](const void *data, size_t size) {
+            const char *bytes = static_cast<const char *>(data);
+            for (size_t i = 0; i < size; ++i) {
+                out.push_back(bytes[bigEndian ? size - 1 - i : i]);
+            }
+        };
+        const float normal[3] = { 0.f, 0.f, 1.f };
+        const int16_t quality = 7;
+        const uint8_t count = 3, flags = 1;
+        for (unsigned int i = 0; i < 4; ++i) {
+            for (float f : positions[i]) {
+                append(&f, sizeof(f));
+            }
+            append(&quality, sizeof(quality));
+            out.append(reinterpret_cast<const char *>(colors[i]), 3);
+            for (float f : normal) {
+                append(&f, sizeof(f));
+            }
+        }
+        for (unsigned int i = 0; i < 2; ++i) {
+            append(&count, sizeof(count));
+            for (int index : faces[i]) {
+                append(&index, sizeof(index));
+            }
+            append(&flags, sizeof(flags));
+        }
+        return out;
+    };
+
+    Assimp::Importer asciiImporter;
+    const std::string asciiData = ascii.str();
+    const aiScene *expected = asciiImporter.ReadFileFromMemory(asciiData.data(), asciiData.size(), aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+    const aiMesh *expectedMesh = expected->mMeshes[0];
+
+    for (bool bigEndian : { false, true }) {
+        Assimp::Importer importer;
+        const std::string data = binary(bigEndian);
+        const aiScene *scene = importer.ReadFileFromMemory(data.data(), data.size(), aiProcess_ValidateDataStructure);
+        ASSERT_NE(nullptr, scene);
+        const aiMesh *mesh = scene->mMeshes[0];
+        ASSERT_EQ(expectedMesh->mNumVertices, mesh->mNumVertices);
+        ASSERT_TRUE(mesh->HasNormals());
+        ASSERT_TRUE(mesh->HasVertexColors(0));
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            EXPECT_EQ(expectedMesh->mVertices[i], mesh->mVertices[i]);
+            EXPECT_EQ(expectedMesh->mNormals[i], mesh->mNormals[i]);
+            EXPECT_EQ(expectedMesh->mColors[0][i], mesh->mColors[0][i]);
+        }
+        ASSERT_EQ(expectedMesh->mNumFaces, mesh->mNumFaces);
+        for (unsigned int i = 0; i < mesh->mNumFaces; ++i) {
+            ASSERT_EQ(3u, mesh->mFaces[i].mNumIndices);
+            for (unsigned int j = 0; j < 3; ++j) {
+                EXPECT_EQ(expectedMesh->mFaces[i].mIndices[j], mesh->mFaces[i].mIndices[j]);
+            }
+        }
+    }
+}
@@ -43,6 +43,8 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PostProcessing/PretransformVertices.h"
 #include <assimp/scene.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace Assimp;
 
@@ -155,3 +157,42 @@ TEST_F(PretransformVerticesTest, testProcessKeepHierarchy) {
     EXPECT_EQ(5U, mScene->mNumMaterials);
     EXPECT_EQ(49U, mScene->mNumMeshes); // see note on mesh 12 above
 }
+
+// ------------------------------------------------------------------------------------------------
+TEST_F(PretransformVerticesTest, testProcessInstances) {
+    aiScene scene;
+    scene.mMaterials = new aiMaterial *[scene.mNumMaterials = 1];
+    scene.mMaterials[0] = new aiMaterial();
+    scene.mMeshes = new aiMesh *[scene.mNumMeshes = 1];
+    aiMesh *mesh = scene.mMeshes[0] = new aiMesh();
+    mesh->mPrimitiveTypes = aiPrimitiveType_POINT;
+    mesh->mVertices = new aiVector3D[mesh->mNumVertices = 1];
+    mesh->mFaces = new aiFace[mesh->mNumFaces = 1];
+    mesh->mFaces[0].mIndices = new unsigned int[mesh->mFaces[0].mNumIndices = 1];
+    mesh->mFaces[0].mIndices[0] = 0;
+
+    // one node placing the mesh three times
+    scene.mRootNode = new aiNode("Root");
+    aiNode *node = new aiNode("Instanced");
+    node->mParent = scene.mRootNode;
+    scene.mRootNode->addChildren(1, &node);
+    node->mMeshes = new unsigned int[node->mNumMeshes = 1];
+    node->mMeshes[0] = 0;
+    node->mInstanceTransforms = new aiMatrix4x4[node->mNumInstances = 3];
+    for (unsigned int i = 0; i < node->mNumInstances; ++i) {
+        aiMatrix4x4::Translation(aiVector3D(ai_real(i + 1), 0, 0), node->mInstanceTransforms[i]);
+    }
+
+    mProcess->KeepHierarchy(false);
+    mProcess->Execute(&scene);
+
+    ASSERT_EQ(1U, scene.mNumMeshes);
+    mesh = scene.mMeshes[0];
+    ASSERT_EQ(3U, mesh->mNumVertices);
+    std::vector<ai_real> x;
+    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+        x.push_back(mesh->mVertices[i].x);
+    }
+    std::sort(x.begin(), x.end());
+    EXPECT_EQ(std::vector<ai_real>({ 1, 2, 3 }), x);
+}
@@ -44,6 +44,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UTLogStream.h"
 #include <assimp/Profiler.h>
 #include <assimp/DefaultLogger.hpp>
+#include <assimp/Importer.hpp>
+#include <assimp/config.h>
+#include <assimp/postprocess.h>
 
 using namespace ::Assimp;
 using namespace ::Assimp::Profiling;
@@ -75,3 +78,79 @@ TEST_F( utProfiler, addRegion_success ) {
     //UTLogStream *stream( (UTLogStream*) m_stream );
     //EXPECT_FALSE( stream->m_messages.empty() );
 }
+
+TEST_F( utProfiler, nestedRegions_success ) {
+    Profiler myProfiler;
+    myProfiler.BeginRegion( "outer" );
+    for ( int i=0; i<2; i++ ) {
+        ProfileScope scope( &myProfiler, "inner" );
+        scope.AddBytes( 10 );
+    }
+    myProfiler.EndRegion( "outer" );
+
+    const ProfileReport report = myProfiler.GetReport();
+    const ProfileEntry *outer = report.Find( "outer" );
+    ASSERT_NE( nullptr, outer );
+    EXPECT_EQ( 1u, outer->calls );
+    EXPECT_EQ( 0u, outer->bytes );
+
+    const ProfileEntry *inner = report.Find( "outer/inner" );
+    ASSERT_NE( nullptr, inner );
+    EXPECT_EQ( 2u, inner->calls );
+    EXPECT_EQ( 20u, inner->bytes );
+    EXPECT_LE( inner->seconds, outer->seconds );
+    EXPECT_EQ( nullptr, report.Find( "inner" ) );
+
+    ASSERT_EQ( 3u, report.events.size() );
+    EXPECT_EQ( "outer", report.events[ 2 ].name );
+    EXPECT_EQ( 0u, report.events[ 2 ].depth );
+    EXPECT_EQ( 1u, report.events[ 0 ].depth );
+}
+
+TEST_F( utProfiler, endOuterRegionClosesInner_success ) {
+    Profiler myProfiler;
+    myProfiler.BeginRegion( "outer" );
+    myProfiler.BeginRegion( "inner" );
+    myProfiler.EndRegion( "outer" );
+    myProfiler.EndRegion( "unknown" );
+
+    const ProfileReport report = myProfiler.GetReport();
+    ASSERT_NE( nullptr, report.Find( "outer/inner" ) );
+    EXPECT_EQ( 1u, report.Find( "outer/inner" )->calls );
+    EXPECT_EQ( 1u, report.Find( "outer" )->calls );
+}
+
+TEST_F( utProfiler, export_success ) {
+    Profiler myProfiler;
+    myProfiler.BeginRegion( "a \"quoted\" region" );
+    myProfiler.EndRegion( "a \"quoted\" region" );
+
+    const ProfileReport report = myProfiler.GetReport();
+    const std::string json = report.ToJSON();
+    EXPECT_NE( std::string::npos, json.find( "\"name\":\"a \\\"quoted\\\" region\"" ) );
+    EXPECT_NE( std::string::npos, json.find( "\"calls\":1" ) );
+
+    const std::string trace = report.ToChromeTrace();
+    EXPECT_EQ( 0u, trace.find( "{\"traceEvents\":[{" ) );
+    EXPECT_NE( std::string::npos, trace.find( "\"ph\":\"X\"" ) );
+}
+
+TEST_F( utProfiler, importerReport_success ) {
+    Importer importer;
+    ProfileReport report;
+    EXPECT_FALSE( importer.GetProfileReport( report ) );
+
+    importer.SetPropertyBool( AI_CONFIG_GLOB_MEASURE_TIME, true );
+    const aiScene *scene = importer.ReadFile( ASSIMP_TEST_MODELS_DIR "/FBX/box.fbx", aiProcess_Triangulate );
+    ASSERT_NE( nullptr, scene );
+    ASSERT_TRUE( importer.GetProfileReport( report ) );
+
+    ASSERT_NE( nullptr, report.Find( "total" ) );
+    EXPECT_EQ( 1u, report.Find( "total" )->calls );
+    ASSERT_NE( nullptr, report.Find( "total/import/FBX tokenize" ) );
+    EXPECT_GT( report.Find( "total/import/FBX tokenize" )->bytes, 0u );
+    EXPECT_NE( nullptr, report.Find( "total/import/FBX parse" ) );
+    EXPECT_NE( nullptr, report.Find( "total/import/FBX convert" ) );
+    EXPECT_NE( nullptr, report.Find( "total/preprocess" ) );
+    EXPECT_NE( nullptr, report.Find( "total/postprocess/TriangulateProcess" ) );
+}
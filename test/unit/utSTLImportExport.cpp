@@ -47,6 +47,9 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <assimp/Exporter.hpp>
 #include <assimp/Importer.hpp>
 
+#include <array>
+#include <cmath>
+#include <cstring>
 #include <vector>
 
 using namespace Assimp;
@@ -99,6 +102,163 @@ TEST_F(utSTLImporterExporter, test_with_empty_solid) {
     EXPECT_EQ(nullptr, scene2);
 }
 
+static void checkWeldedSpider(const char *file, float epsilon) {
+    Assimp::Importer plain;
+    const aiScene *unwelded = plain.ReadFile(file, aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, unwelded);
+
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_STL_WELD_VERTICES, true);
+    importer.SetPropertyFloat(AI_CONFIG_IMPORT_STL_WELD_EPSILON, epsilon);
+    const aiScene *welded = importer.ReadFile(file, aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, welded);
+    ASSERT_EQ(unwelded->mNumMeshes, welded->mNumMeshes);
+
+    for (unsigned int m = 0; m < welded->mNumMeshes; ++m) {
+        const aiMesh *a = unwelded->mMeshes[m];
+        const aiMesh *b = welded->mMeshes[m];
+        ASSERT_EQ(a->mNumFaces, b->mNumFaces);
+        EXPECT_EQ(nullptr, b->mNormals);
+        for (unsigned int f = 0; f < b->mNumFaces; ++f) {
+            ASSERT_EQ(3u, b->mFaces[f].mNumIndices);
+            for (unsigned int c = 0; c < 3; ++c) {
+                const aiVector3D &pa = a->mVertices[a->mFaces[f].mIndices[c]];
+                const aiVector3D &pb = b->mVertices[b->mFaces[f].mIndices[c]];
+                EXPECT_LE((pa - pb).Length(), epsilon);
+            }
+        }
+    }
+}
+
+// Binary STL of a closed UV sphere, the corners of each vertex are moved by up to jitter.
+static std::vector<char> makeSphere(unsigned int slices, unsigned int stacks, float jitter) {
+    std::vector<aiVector3f> vertices;
+    vertices.emplace_back(0.0f, 0.0f, 1.0f);
+    for (unsigned int j = 1; j < stacks; ++j) {
+        const float theta = AI_MATH_PI_F * j / stacks;
+        for (unsigned int i = 0; i < slices; ++i) {
+            const float phi = AI_MATH_TWO_PI_F * i / slices;
+            vertices.emplace_back(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+        }
+    }
+    vertices.emplace_back(0.0f, 0.0f, -1.0f);
+    const auto ring = [slices](unsigned int j, unsigned int i) {
+        return 1 + (j - 1) * slices + i % slices;
+    };
+    std::vector<std::array<unsigned int, 3>> triangles;
+    for (unsigned int i = 0; i < slices; ++i) {
+        triangles.push_back({ { 0, ring(1, i), ring(1, i + 1) } });
+        for (unsigned int j = 1; j + 1 < stacks; ++j) {
+            triangles.push_back({ { ring(j, i), ring(j + 1, i), ring(j + 1, i + 1) } });
+            triangles.push_back({ { ring(j, i), ring(j + 1, i + 1), ring(j, i + 1) } });
+        }
+        triangles.push_back({ { ring(stacks - 1, i), static_cast<unsigned int>(vertices.size() - 1), ring(stacks - 1, i + 1) } });
+    }
+
+    std::vector<char> data(84 + triangles.size() * 50, 0);
+    const uint32_t numFacets = static_cast<uint32_t>(triangles.size());
+    ::memcpy(&data[80], &numFacets, 4);
+    unsigned int seed = 4711;
+    for (size_t t = 0; t < triangles.size(); ++t) {
+        aiVector3f corners[4];
+        for (unsigned int c = 0; c < 3; ++c) {
+            corners[c + 1] = vertices[triangles[t][c]];
+            for (unsigned int axis = 0; axis < 3; ++axis) {
+                seed = seed * 1103515245u + 12345u;
+                corners[c + 1][axis] += jitter * (static_cast<float>((seed >> 8) & 0xffff) / 32767.5f - 1.0f);
+            }
+        }
+        corners[0] = ((corners[2] - corners[1]) ^ (corners[3] - corners[1])).Normalize();
+        ::memcpy(&data[84 + t * 50], corners, sizeof(corners));
+    }
+    return data;
+}
+
+static void checkWeldedSphere(float jitter, float epsilon) {
+    const unsigned int slices = 32, stacks = 16;
+    const std::vector<char> sphere = makeSphere(slices, stacks, jitter);
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_STL_WELD_VERTICES, true);
+    importer.SetPropertyFloat(AI_CONFIG_IMPORT_STL_WELD_EPSILON, epsilon);
+    const aiScene *scene = importer.ReadFileFromMemory(sphere.data(), sphere.size(), aiProcess_ValidateDataStructure, "stl");
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(1u, scene->mNumMeshes);
+    const aiMesh *mesh = scene->mMeshes[0];
+    ASSERT_EQ(2 * slices * (stacks - 1), mesh->mNumFaces);
+
+    // a closed mesh without holes has two vertices more than half its triangles
+    EXPECT_EQ(mesh->mNumFaces / 2 + 2, mesh->mNumVertices);
+    EXPECT_EQ(nullptr, mesh->mNormals);
+}
+
+TEST_F(utSTLImporterExporter, test_weld_vertices_binary) {
+    checkWeldedSpider(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", 0.0f);
+}
+
+TEST_F(utSTLImporterExporter, test_weld_vertices_ascii) {
+    checkWeldedSpider(ASSIMP_TEST_MODELS_DIR "/STL/Spider_ascii.stl", 0.0f);
+}
+
+TEST_F(utSTLImporterExporter, test_weld_vertices_epsilon) {
+    checkWeldedSpider(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl", 1e-3f);
+}
+
+TEST_F(utSTLImporterExporter, test_weld_vertices_closed_sphere) {
+    checkWeldedSphere(0.0f, 0.0f);
+}
+
+TEST_F(utSTLImporterExporter, test_weld_vertices_closed_sphere_epsilon) {
+    checkWeldedSphere(1e-5f, 1e-4f);
+}
+
+TEST_F(utSTLImporterExporter, test_weld_vertices_flat_normals) {
+    // unit cube, two facets per side
+    std::string cube = "solid cube\n";
+    for (int axis = 0; axis < 3; ++axis) {
+        for (int side = 0; side < 2; ++side) {
+            aiVector3D normal, u, v, origin;
+            normal[axis] = side ? 1.0f : -1.0f;
+            u[(axis + 1) % 3] = 1.0f;
+            v[(axis + 2) % 3] = 1.0f;
+            origin[axis] = side ? 1.0f : 0.0f;
+            const aiVector3D corners[4] = { origin, origin + u, origin + u + v, origin + v };
+            static const int tris[2][3] = { { 0, 1, 2 }, { 0, 2, 3 } };
+            for (const auto &tri : tris) {
+                cube += "facet normal " + std::to_string(normal.x) + " " + std::to_string(normal.y) + " " + std::to_string(normal.z) + "\nouter loop\n";
+                for (int c : tri) {
+                    cube += "vertex " + std::to_string(corners[c].x) + " " + std::to_string(corners[c].y) + " " + std::to_string(corners[c].z) + "\n";
+                }
+                cube += "endloop\nendfacet\n";
+            }
+        }
+    }
+    cube += "endsolid cube\n";
+
+    // the corners of the cube are shared by all sides
+    Assimp::Importer importer;
+    importer.SetPropertyBool(AI_CONFIG_IMPORT_STL_WELD_VERTICES, true);
+    const aiScene *scene = importer.ReadFileFromMemory(cube.c_str(), cube.size(), aiProcess_ValidateDataStructure, "stl");
+    ASSERT_NE(nullptr, scene);
+    ASSERT_EQ(1u, scene->mNumMeshes);
+    EXPECT_EQ(8u, scene->mMeshes[0]->mNumVertices);
+    EXPECT_EQ(nullptr, scene->mMeshes[0]->mNormals);
+
+    // flat normals split them again where needed
+    scene = importer.ReadFileFromMemory(cube.c_str(), cube.size(), aiProcess_ValidateDataStructure | aiProcess_GenNormals, "stl");
+    ASSERT_NE(nullptr, scene);
+    const aiMesh *mesh = scene->mMeshes[0];
+    ASSERT_EQ(12u, mesh->mNumFaces);
+    ASSERT_NE(nullptr, mesh->mNormals);
+    for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+        const aiFace &face = mesh->mFaces[f];
+        const aiVector3D &a = mesh->mVertices[face.mIndices[0]];
+        const aiVector3D facetNormal = ((mesh->mVertices[face.mIndices[1]] - a) ^ (mesh->mVertices[face.mIndices[2]] - a)).Normalize();
+        for (unsigned int c = 0; c < face.mNumIndices; ++c) {
+            EXPECT_NEAR(1.0f, std::fabs(mesh->mNormals[face.mIndices[c]] * facetNormal), 1e-5f);
+        }
+    }
+}
+
 #ifndef ASSIMP_BUILD_NO_EXPORT
 
 TEST_F(utSTLImporterExporter, exporterTest) {
@@ -0,0 +1,258 @@
+/*-------------------------------------------------------------------------
+Open Asset Import Library (assimp)
+---------------------------------------------------------------------------
+
+Copyright (c) 2006-2025, assimp team
+
+
+
+All rights reserved.
+
+Redistribution and use of this software in source and binary forms,
+with or without modification, are permitted provided that the following
+conditions are met:
+
+* Redistributions of source code must retain the above
+copyright notice, this list of conditions and the
+following disclaimer.
+
+* Redistributions in binary form must reproduce the above
+copyright notice, this list of conditions and the
+following disclaimer in the documentation and/or other
+materials provided with the distribution.
+
+* Neither the name of the assimp team, nor the names of its
+contributors may be used to endorse or promote products
+derived from this software without specific prior
+written permission of the assimp team.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+-------------------------------------------------------------------------*/
+#include "UnitTestPCH.h"
+#include "SceneDiffer.h"
+#include "UnitTestFileGenerator.h"
+
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/cexport.h>
+#include <assimp/SceneSnapshot.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ::Assimp;
+
+class utSceneSnapshot : public ::testing::Test {
+protected:
+    // Writes a snapshot of the imported file, maps it again and compares both scenes.
+    static void RoundTrip(const std::string &file, aiPostProcessStepMask flags) {
+        Importer importer;
+        const aiScene *expected = importer.ReadFile64(file.c_str(), flags);
+        ASSERT_NE(nullptr, expected);
+
+        const std::string path = TMP_PATH "snapshot.assnap";
+        DefaultIOSystem io;
+        IOStream *stream = io.Open(path.c_str(), "wb");
+        ASSERT_NE(nullptr, stream);
+        EXPECT_TRUE(SceneSnapshot::Write(expected, stream));
+        io.Close(stream);
+
+        SceneSnapshot snapshot;
+        ASSERT_TRUE(snapshot.Open(path.c_str()));
+        std::remove(path.c_str());
+        const aiScene *actual = snapshot.GetScene();
+        ASSERT_NE(nullptr, actual);
+
+        SceneDiffer differ;
+        EXPECT_TRUE(differ.isEqual(expected, actual));
+        CompareNodes(expected->mRootNode, actual->mRootNode, nullptr);
+
+        ASSERT_EQ(expected->mNumAnimations, actual->mNumAnimations);
+        for (unsigned int i = 0; i < expected->mNumAnimations; ++i) {
+            const aiAnimation *a = expected->mAnimations[i];
+            const aiAnimation *b = actual->mAnimations[i];
+            ASSERT_EQ(a->mNumChannels, b->mNumChannels);
+            for (unsigned int c = 0; c < a->mNumChannels; ++c) {
+                ASSERT_EQ(a->mChannels[c]->mNumRotationKeys, b->mChannels[c]->mNumRotationKeys);
+                EXPECT_EQ(0, memcmp(a->mChannels[c]->mRotationKeys, b->mChannels[c]->mRotationKeys, sizeof(aiQuatKey) * a->mChannels[c]->mNumRotationKeys));
+            }
+            ASSERT_EQ(a->mNumMorphMeshChannels, b->mNumMorphMeshChannels);
+            for (unsigned int c = 0; c < a->mNumMorphMeshChannels; ++c) {
+                ASSERT_EQ(a->mMorphMeshChannels[c]->mNumKeys, b->mMorphMeshChannels[c]->mNumKeys);
+                for (unsigned int k = 0; k < a->mMorphMeshChannels[c]->mNumKeys; ++k) {
+                    const aiMeshMorphKey &ka = a->mMorphMeshChannels[c]->mKeys[k];
+                    const aiMeshMorphKey &kb = b->mMorphMeshChannels[c]->mKeys[k];
+                    ASSERT_EQ(ka.mNumValuesAndWeights, kb.mNumValuesAndWeights);
+                    EXPECT_EQ(0, memcmp(ka.mWeights, kb.mWeights, sizeof(double) * ka.mNumValuesAndWeights));
+                }
+            }
+        }
+
+        for (unsigned int i = 0; i < expected->mNumMeshes; ++i) {
+            const aiMesh *a = expected->mMeshes[i];
+            const aiMesh *b = actual->mMeshes[i];
+            ASSERT_EQ(a->mNumBones, b->mNumBones);
+            for (unsigned int j = 0; j < a->mNumBones; ++j) {
+                EXPECT_EQ(a->mBones[j]->mName, b->mBones[j]->mName);
+                ASSERT_EQ(a->mBones[j]->mNumWeights, b->mBones[j]->mNumWeights);
+                EXPECT_EQ(0, memcmp(a->mBones[j]->mWeights, b->mBones[j]->mWeights, sizeof(aiVertexWeight) * a->mBones[j]->mNumWeights));
+#ifndef ASSIMP_BUILD_NO_ARMATUREPOPULATE_PROCESS
+                // links into the node hierarchy point into the snapshot
+                ASSERT_EQ(nullptr == a->mBones[j]->mNode, nullptr == b->mBones[j]->mNode);
+                if (nullptr != b->mBones[j]->mNode) {
+                    EXPECT_EQ(b->mBones[j]->mNode, actual->mRootNode->FindNode(b->mBones[j]->mNode->mName));
+                }
+#endif
+            }
+            ASSERT_EQ(a->mNumAnimMeshes, b->mNumAnimMeshes);
+            for (unsigned int j = 0; j < a->mNumAnimMeshes; ++j) {
+                ASSERT_EQ(a->mAnimMeshes[j]->mNumVertices, b->mAnimMeshes[j]->mNumVertices);
+                EXPECT_EQ(0, memcmp(a->mAnimMeshes[j]->mVertices, b->mAnimMeshes[j]->mVertices, sizeof(aiVector3D) * a->mAnimMeshes[j]->mNumVertices));
+            }
+            ASSERT_EQ(a->HasVertexStream(), b->HasVertexStream());
+            if (a->HasVertexStream()) {
+                const aiVertexStream *sa = a->mVertexStream, *sb = b->mVertexStream;
+                ASSERT_EQ(sa->mStride, sb->mStride);
+                ASSERT_EQ(sa->mNumAttributes, sb->mNumAttributes);
+                EXPECT_EQ(0, memcmp(sa->mAttributes, sb->mAttributes, sizeof(aiVertexAttribute) * sa->mNumAttributes));
+                EXPECT_EQ(0, memcmp(sa->mData, sb->mData, static_cast<size_t>(sa->mStride) * sa->mNumVertices));
+            }
+        }
+    }
+
+    static void CompareNodes(const aiNode *a, const aiNode *b, const aiNode *parent) {
+        ASSERT_NE(nullptr, b);
+        EXPECT_EQ(a->mName, b->mName);
+        EXPECT_EQ(a->mTransformation, b->mTransformation);
+        EXPECT_EQ(parent, b->mParent);
+        ASSERT_EQ(a->mNumMeshes, b->mNumMeshes);
+        EXPECT_EQ(0, memcmp(a->mMeshes, b->mMeshes, sizeof(unsigned int) * a->mNumMeshes));
+        ASSERT_EQ(nullptr == a->mMetaData, nullptr == b->mMetaData);
+        if (nullptr != a->mMetaData) {
+            EXPECT_EQ(*a->mMetaData, *b->mMetaData);
+        }
+        ASSERT_EQ(a->mNumChildren, b->mNumChildren);
+        for (unsigned int i = 0; i < a->mNumChildren; ++i) {
+            CompareNodes(a->mChildren[i], b->mChildren[i], b);
+        }
+    }
+};
+
+TEST_F(utSceneSnapshot, roundTripSkinnedFBXTest) {
+    RoundTrip(ASSIMP_TEST_MODELS_DIR "/FBX/animation_with_skeleton.fbx", aiProcess_ValidateDataStructure | aiProcess_PopulateArmatureData);
+}
+
+TEST_F(utSceneSnapshot, roundTripMorphGLTFTest) {
+    RoundTrip(ASSIMP_TEST_MODELS_DIR "/glTF2/AnimatedMorphCube/glTF/AnimatedMorphCube.gltf", aiProcess_ValidateDataStructure);
+}
+
+TEST_F(utSceneSnapshot, roundTripVertexStreamsTest) {
+    RoundTrip(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb",
+            aiProcess_ValidateDataStructure | aiProcess_CalcTangentSpace | aiProcess_GenBoundingBoxes | aiProcess_GenVertexStreams);
+}
+
+TEST_F(utSceneSnapshot, loadFromMemoryTest) {
+    Importer importer;
+    const aiScene *expected = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    const std::string path = TMP_PATH "snapshot_memory.assnap";
+    DefaultIOSystem io;
+    IOStream *stream = io.Open(path.c_str(), "wb");
+    ASSERT_NE(nullptr, stream);
+    EXPECT_TRUE(SceneSnapshot::Write(expected, stream));
+    io.Close(stream);
+
+    stream = io.Open(path.c_str(), "rb");
+    ASSERT_NE(nullptr, stream);
+    std::vector<uint8_t> contents(stream->FileSize());
+    EXPECT_EQ(1u, stream->Read(contents.data(), contents.size(), 1));
+    io.Close(stream);
+    std::remove(path.c_str());
+
+    SceneSnapshot snapshot;
+    ASSERT_TRUE(snapshot.Load(contents.data(), contents.size()));
+    EXPECT_EQ(contents.size(), snapshot.GetSize());
+    const aiScene *actual = snapshot.GetScene();
+    ASSERT_NE(nullptr, actual);
+    SceneDiffer differ;
+    EXPECT_TRUE(differ.isEqual(expected, actual));
+    ASSERT_EQ(expected->mNumTextures, actual->mNumTextures);
+    for (unsigned int i = 0; i < expected->mNumTextures; ++i) {
+        ASSERT_EQ(expected->mTextures[i]->mWidth, actual->mTextures[i]->mWidth);
+        EXPECT_EQ(0, memcmp(expected->mTextures[i]->pcData, actual->mTextures[i]->pcData, expected->mTextures[i]->mWidth));
+    }
+
+    // the material lookup works without the property index
+    aiColor4D color;
+    EXPECT_EQ(expected->mMaterials[0]->Get(AI_MATKEY_COLOR_DIFFUSE, color), actual->mMaterials[0]->Get(AI_MATKEY_COLOR_DIFFUSE, color));
+
+    // the snapshot can be copied into a scene of its own
+    aiScene *copy = nullptr;
+    aiCopyScene(actual, &copy);
+    ASSERT_NE(nullptr, copy);
+    EXPECT_TRUE(differ.isEqual(expected, copy));
+    aiFreeScene(copy);
+}
+
+TEST_F(utSceneSnapshot, rejectInvalidDataTest) {
+    SceneSnapshot snapshot;
+    const std::vector<uint8_t> garbage(4096, 0x42);
+    EXPECT_FALSE(snapshot.Load(garbage.data(), garbage.size()));
+    EXPECT_EQ(nullptr, snapshot.GetScene());
+    EXPECT_FALSE(snapshot.Open(ASSIMP_TEST_MODELS_DIR "/STL/Spider_binary.stl"));
+    EXPECT_FALSE(snapshot.Open(ASSIMP_TEST_MODELS_DIR "/STL/does_not_exist.stl"));
+}
+
+TEST_F(utSceneSnapshot, rejectDamagedCountsTest) {
+    Importer importer;
+    const aiScene *expected = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/BoxTextured-glTF-Binary/BoxTextured.glb", aiProcess_ValidateDataStructure);
+    ASSERT_NE(nullptr, expected);
+
+    const std::string path = TMP_PATH "snapshot_damaged.assnap";
+    DefaultIOSystem io;
+    IOStream *stream = io.Open(path.c_str(), "wb");
+    ASSERT_NE(nullptr, stream);
+    EXPECT_TRUE(SceneSnapshot::Write(expected, stream));
+    io.Close(stream);
+
+    stream = io.Open(path.c_str(), "rb");
+    ASSERT_NE(nullptr, stream);
+    std::vector<uint8_t> contents(stream->FileSize());
+    EXPECT_EQ(1u, stream->Read(contents.data(), contents.size(), 1));
+    io.Close(stream);
+    std::remove(path.c_str());
+
+    // every word in turn is made huge, a snapshot which still loads has to stay inside
+    // its blob, the copy reads all arrays up to their counts
+    unsigned int rejected = 0;
+    for (size_t offset = 0; offset + sizeof(uint32_t) <= contents.size(); offset += sizeof(uint32_t)) {
+        std::vector<uint8_t> damaged = contents;
+        const uint32_t huge = 0x7fffffff;
+        memcpy(&damaged[offset], &huge, sizeof(huge));
+
+        SceneSnapshot snapshot;
+        if (!snapshot.Load(damaged.data(), damaged.size())) {
+            ++rejected;
+            continue;
+        }
+        aiScene *copy = nullptr;
+        aiCopyScene(snapshot.GetScene(), &copy);
+        ASSERT_NE(nullptr, copy);
+        aiFreeScene(copy);
+    }
+    EXPECT_GT(rejected, 0u);
+}
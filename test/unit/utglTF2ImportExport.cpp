@@ -920,6 +920,297 @@ TEST_F(utglTF2ImportExport, import_dracoEncoded) {
 #endif
 }
 
+/////////////////////////////////
+// EXT_meshopt_compression and KHR_mesh_quantization decoding
+
+TEST_F(utglTF2ImportExport, import_meshoptCompressedQuantized) {
+    // The same box, once with meshopt compressed and quantized attributes, once with floats.
+    // The first mesh uses the triangle index codec, the second the index sequence codec.
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/MeshoptCompression/BoxMeshopt.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+
+    Assimp::Importer referenceImporter;
+    const aiScene *reference = referenceImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/MeshoptCompression/BoxUncompressed.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(reference, nullptr);
+
+    ASSERT_EQ(reference->mNumMeshes, 2u);
+    ASSERT_EQ(scene->mNumMeshes, reference->mNumMeshes);
+    for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        const aiMesh *expected = reference->mMeshes[m];
+        ASSERT_EQ(mesh->mNumVertices, expected->mNumVertices);
+        ASSERT_EQ(mesh->mNumFaces, expected->mNumFaces);
+        ASSERT_TRUE(mesh->HasNormals());
+        ASSERT_TRUE(mesh->HasTextureCoords(0));
+        ASSERT_TRUE(mesh->HasTextureCoords(1));
+        EXPECT_EQ(mesh->mNumUVComponents[0], 2u);
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            EXPECT_TRUE(mesh->mVertices[i].Equal(expected->mVertices[i]));
+            EXPECT_TRUE(mesh->mNormals[i].Equal(expected->mNormals[i]));
+            EXPECT_TRUE(mesh->mTextureCoords[0][i].Equal(expected->mTextureCoords[0][i]));
+            EXPECT_TRUE(mesh->mTextureCoords[1][i].Equal(expected->mTextureCoords[1][i]));
+        }
+        // the triangle codec may rotate the vertices of a triangle, keeping the winding order
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            ASSERT_EQ(mesh->mFaces[f].mNumIndices, 3u);
+            const unsigned int *indices = mesh->mFaces[f].mIndices;
+            const unsigned int *expectedIndices = expected->mFaces[f].mIndices;
+            unsigned int rotation = 0;
+            while (rotation < 3 && indices[rotation] != expectedIndices[0]) {
+                ++rotation;
+            }
+            ASSERT_LT(rotation, 3u);
+            for (unsigned int i = 0; i < 3; ++i) {
+                EXPECT_EQ(indices[(rotation + i) % 3], expectedIndices[i]);
+            }
+        }
+    }
+}
+
+static void compareMeshoptExport(const aiScene *scene, const aiScene *expected, ai_real positionTolerance, ai_real normalTolerance) {
+    ASSERT_EQ(scene->mNumMeshes, expected->mNumMeshes);
+    for (unsigned int m = 0; m < scene->mNumMeshes; ++m) {
+        const aiMesh *mesh = scene->mMeshes[m];
+        const aiMesh *reference = expected->mMeshes[m];
+        ASSERT_EQ(mesh->mNumVertices, reference->mNumVertices);
+        ASSERT_EQ(mesh->mNumFaces, reference->mNumFaces);
+        ASSERT_EQ(mesh->HasNormals(), reference->HasNormals());
+        for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
+            // the error of the exponential filter is relative to the largest component of the vertex
+            const aiVector3D &v = reference->mVertices[i];
+            const ai_real scale = std::max(std::max(std::abs(v.x), std::abs(v.y)), std::max(std::abs(v.z), ai_real(1e-6)));
+            ASSERT_TRUE(mesh->mVertices[i].Equal(v, positionTolerance * scale));
+            if (mesh->HasNormals()) {
+                ASSERT_TRUE(mesh->mNormals[i].Equal(reference->mNormals[i], normalTolerance));
+            }
+        }
+        for (unsigned int f = 0; f < mesh->mNumFaces; ++f) {
+            ASSERT_EQ(mesh->mFaces[f].mNumIndices, reference->mFaces[f].mNumIndices);
+        }
+    }
+}
+
+TEST_F(utglTF2ImportExport, export_meshoptCompression) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine.glb",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+
+    Assimp::Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "glb2");
+    ASSERT_NE(blob, nullptr);
+    const size_t uncompressedSize = blob->size;
+    Assimp::Importer referenceImporter;
+    const aiScene *reference = referenceImporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "glb");
+    ASSERT_NE(reference, nullptr);
+
+    // lossless
+    ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_MESHOPT_COMPRESSION, true);
+    blob = exporter.ExportToBlob(scene, "glb2", 0, &properties);
+    ASSERT_NE(blob, nullptr);
+    EXPECT_LT(blob->size, uncompressedSize);
+    Assimp::Importer losslessImporter;
+    const aiScene *lossless = losslessImporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "glb");
+    ASSERT_NE(lossless, nullptr);
+    compareMeshoptExport(lossless, reference, 0, 0);
+
+    // quantized, which also needs KHR_mesh_quantization for the normals
+    properties.SetPropertyInteger(AI_CONFIG_EXPORT_GLTF_MESHOPT_POSITION_BITS, 14);
+    properties.SetPropertyInteger(AI_CONFIG_EXPORT_GLTF_MESHOPT_NORMAL_BITS, 8);
+    properties.SetPropertyInteger(AI_CONFIG_EXPORT_GLTF_MESHOPT_TEXCOORD_BITS, 12);
+    const size_t losslessSize = blob->size;
+    blob = exporter.ExportToBlob(scene, "glb2", 0, &properties);
+    ASSERT_NE(blob, nullptr);
+    EXPECT_LT(blob->size, losslessSize);
+    Assimp::Importer quantizedImporter;
+    const aiScene *quantized = quantizedImporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "glb");
+    ASSERT_NE(quantized, nullptr);
+    compareMeshoptExport(quantized, reference, ai_real(1.0 / 4096), ai_real(0.02));
+
+    // the fallback buffer of a .gltf file has no .bin file of its own
+    ASSERT_EQ(aiReturn_SUCCESS, exporter.Export(scene, "gltf2",
+            ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine_meshopt_out.gltf", 0, &properties));
+    Assimp::Importer textImporter;
+    const aiScene *text = textImporter.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/2CylinderEngine-glTF-Binary/2CylinderEngine_meshopt_out.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(text, nullptr);
+    compareMeshoptExport(text, reference, ai_real(1.0 / 4096), ai_real(0.02));
+}
+
+static void checkInstancedTriangle(const aiScene *scene) {
+    ASSERT_NE(scene, nullptr);
+    const aiNode *node = scene->mRootNode->FindNode("instances");
+    ASSERT_NE(node, nullptr);
+    ASSERT_EQ(node->mNumMeshes, 1u);
+    ASSERT_EQ(node->mNumInstances, 3u);
+    ASSERT_NE(node->mInstanceTransforms, nullptr);
+
+    const ai_real s = std::sqrt(ai_real(0.5));
+    const aiMatrix4x4 expected[3] = {
+        aiMatrix4x4(),
+        aiMatrix4x4(aiVector3D(2, 2, 2), aiQuaternion(s, 0, 0, s), aiVector3D(2, 0, 0)),
+        aiMatrix4x4(aiVector3D(1, ai_real(0.5), 1), aiQuaternion(0, 0, 1, 0), aiVector3D(0, 3, 0))
+    };
+    for (unsigned int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(node->mInstanceTransforms[i].Equal(expected[i], ai_real(1e-5)));
+    }
+
+    // the instances are relative to the node
+    EXPECT_FLOAT_EQ(node->mTransformation.c4, 5.0f);
+}
+
+TEST_F(utglTF2ImportExport, import_meshGpuInstancing) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/MeshGpuInstancing/TriangleInstanced.gltf",
+            aiProcess_ValidateDataStructure);
+    checkInstancedTriangle(scene);
+
+    Assimp::Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "glb2");
+    ASSERT_NE(blob, nullptr);
+    Assimp::Importer reimporter;
+    checkInstancedTriangle(reimporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "glb"));
+}
+
+// World space positions of all vertices of all instances of the node "instances"
+static std::vector<aiVector3D> getInstancedPositions(const aiScene *scene) {
+    std::vector<aiVector3D> out;
+    const aiNode *node = scene->mRootNode->FindNode("instances");
+    if (nullptr == node) {
+        return out;
+    }
+    aiMatrix4x4 global = node->mTransformation;
+    for (const aiNode *parent = node->mParent; parent; parent = parent->mParent) {
+        global = parent->mTransformation * global;
+    }
+    for (unsigned int i = 0; i < node->mNumInstances; ++i) {
+        const aiMatrix4x4 transform = global * node->mInstanceTransforms[i];
+        for (unsigned int m = 0; m < node->mNumMeshes; ++m) {
+            const aiMesh *mesh = scene->mMeshes[node->mMeshes[m]];
+            for (unsigned int v = 0; v < mesh->mNumVertices; ++v) {
+                out.push_back(transform * mesh->mVertices[v]);
+            }
+        }
+    }
+    return out;
+}
+
+TEST_F(utglTF2ImportExport, import_meshGpuInstancingConverted) {
+    Assimp::Importer plain;
+    const aiScene *reference = plain.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/MeshGpuInstancing/TriangleInstanced.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(reference, nullptr);
+    const std::vector<aiVector3D> expected = getInstancedPositions(reference);
+    ASSERT_EQ(expected.size(), 9u);
+
+    // the instances are mirrored at the Z axis and scaled like the meshes
+    Assimp::Importer importer;
+    importer.SetPropertyFloat(AI_CONFIG_GLOBAL_SCALE_FACTOR_KEY, 2.0f);
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/MeshGpuInstancing/TriangleInstanced.gltf",
+            aiProcess_ValidateDataStructure | aiProcess_MakeLeftHanded | aiProcess_GlobalScale);
+    ASSERT_NE(scene, nullptr);
+    const std::vector<aiVector3D> actual = getInstancedPositions(scene);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        const aiVector3D converted(expected[i].x * 2, expected[i].y * 2, expected[i].z * -2);
+        EXPECT_TRUE(actual[i].Equal(converted, ai_real(1e-4))) << i;
+    }
+}
+
+TEST_F(utglTF2ImportExport, export_meshGpuInstancingExpanded) {
+    Assimp::Importer importer;
+    const aiScene *scene = importer.ReadFile(ASSIMP_TEST_MODELS_DIR "/glTF2/MeshGpuInstancing/TriangleInstanced.gltf",
+            aiProcess_ValidateDataStructure);
+    ASSERT_NE(scene, nullptr);
+    const aiNode *source = scene->mRootNode->FindNode("instances");
+    ASSERT_NE(source, nullptr);
+
+    // formats without instances get one child node per instance
+    Assimp::Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene, "assbin");
+    ASSERT_NE(blob, nullptr);
+    Assimp::Importer reimporter;
+    const aiScene *expanded = reimporter.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "assbin");
+    ASSERT_NE(expanded, nullptr);
+    const aiNode *node = expanded->mRootNode->FindNode("instances");
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->mNumMeshes, 0u);
+    EXPECT_EQ(node->mNumInstances, 0u);
+    ASSERT_EQ(node->mNumChildren, source->mNumChildren + source->mNumInstances);
+    for (unsigned int i = 0; i < source->mNumInstances; ++i) {
+        const aiNode *child = node->mChildren[source->mNumChildren + i];
+        EXPECT_EQ(std::string(child->mName.C_Str()), "instances_instance" + std::to_string(i));
+        EXPECT_TRUE(child->mTransformation.Equal(source->mInstanceTransforms[i]));
+        ASSERT_EQ(child->mNumMeshes, source->mNumMeshes);
+        EXPECT_EQ(child->mMeshes[0], source->mMeshes[0]);
+    }
+
+    // the source scene keeps its instances
+    EXPECT_EQ(source->mNumInstances, 3u);
+}
+
+TEST_F(utglTF2ImportExport, export_meshGpuInstancing) {
+    // a root with four nodes placing the same triangle and one placing another mesh
+    std::unique_ptr<aiScene> scene(new aiScene);
+    scene->mNumMaterials = 1;
+    scene->mMaterials = new aiMaterial *[1]{ new aiMaterial };
+    scene->mNumMeshes = 2;
+    scene->mMeshes = new aiMesh *[2];
+    for (unsigned int m = 0; m < 2; ++m) {
+        aiMesh *mesh = scene->mMeshes[m] = new aiMesh;
+        mesh->mPrimitiveTypes = aiPrimitiveType_TRIANGLE;
+        mesh->mNumVertices = 3;
+        mesh->mVertices = new aiVector3D[3]{ aiVector3D(0, 0, 0), aiVector3D(1, 0, 0), aiVector3D(0, ai_real(m + 1), 0) };
+        mesh->mNumFaces = 1;
+        mesh->mFaces = new aiFace[1];
+        mesh->mFaces[0].mNumIndices = 3;
+        mesh->mFaces[0].mIndices = new unsigned int[3]{ 0, 1, 2 };
+    }
+
+    const unsigned int numChildren = 5;
+    scene->mRootNode = new aiNode("root");
+    scene->mRootNode->mNumChildren = numChildren;
+    scene->mRootNode->mChildren = new aiNode *[numChildren];
+    for (unsigned int i = 0; i < numChildren; ++i) {
+        aiNode *child = scene->mRootNode->mChildren[i] = new aiNode("child" + std::to_string(i));
+        child->mParent = scene->mRootNode;
+        child->mNumMeshes = 1;
+        child->mMeshes = new unsigned int[1]{ i == 2 ? 1u : 0u };
+        aiMatrix4x4::Translation(aiVector3D(ai_real(i), 0, 0), child->mTransformation);
+    }
+
+    ExportProperties properties;
+    properties.SetPropertyBool(AI_CONFIG_EXPORT_GLTF_GPU_INSTANCING, true);
+    Assimp::Exporter exporter;
+    const aiExportDataBlob *blob = exporter.ExportToBlob(scene.get(), "glb2", 0, &properties);
+    ASSERT_NE(blob, nullptr);
+
+    Assimp::Importer importer;
+    const aiScene *imported = importer.ReadFileFromMemory(blob->data, blob->size, aiProcess_ValidateDataStructure, "glb");
+    ASSERT_NE(imported, nullptr);
+    ASSERT_EQ(imported->mRootNode->mNumChildren, 2u);
+
+    const aiNode *instanced = imported->mRootNode->mChildren[0];
+    EXPECT_STREQ(instanced->mName.C_Str(), "child0");
+    EXPECT_TRUE(instanced->mTransformation.IsIdentity());
+    ASSERT_EQ(instanced->mNumInstances, 4u);
+    const ai_real positions[4] = { 0, 1, 3, 4 };
+    for (unsigned int i = 0; i < 4; ++i) {
+        aiMatrix4x4 expected;
+        aiMatrix4x4::Translation(aiVector3D(positions[i], 0, 0), expected);
+        EXPECT_TRUE(instanced->mInstanceTransforms[i].Equal(expected));
+    }
+
+    const aiNode *single = imported->mRootNode->mChildren[1];
+    EXPECT_STREQ(single->mName.C_Str(), "child2");
+    EXPECT_EQ(single->mNumInstances, 0u);
+    EXPECT_FLOAT_EQ(single->mTransformation.a4, 2.0f);
+}
+
 TEST_F(utglTF2ImportExport, wrongTypes) {
     // Deliberately broken version of the BoxTextured.gltf asset.
     using tup_T = std::tuple<std::string, std::string, std::string, std::string>;